@@ -0,0 +1,128 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.99.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "vectornav/LinearAlgebra.hpp"
+#include "vectornav/TemplateLibrary/Matrix.hpp"
+
+using namespace VN;
+using namespace VN::Math;
+
+/*
+This micro-benchmark compares the fixed-size 4x4 kernels (mat_mul, mat_mul_add, mat_mul_transpose_lhs and inverse) against the generic
+implementations they replace for that size, in float and double. Each operation is applied to a batch of random matrices, and the fastest of
+several passes is reported in nanoseconds per operation, along with the largest relative difference between the two results.
+
+Build it with optimizations enabled (the CMakeLists defaults to Release). Defining VN_MATRIX_BOUNDS_CHECK_ENABLE=false measures both sides
+without the bounds checks in Matrix::operator().
+*/
+
+constexpr size_t batchSize = 1024;
+constexpr int passes = 9;
+
+volatile double sink = 0;
+
+template <typename Operation>
+double nsPerOp(Operation&& operation)
+{
+    double best = INFINITY;
+    for (int pass = 0; pass < passes; pass++)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < batchSize; i++) { operation(i); }
+        const auto stop = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::nano>(stop - start).count() / batchSize);
+    }
+    return best;
+}
+
+template <uint16_t m, uint16_t n, typename T>
+double relativeDifference(const Matrix<m, n, T>& result, const Matrix<m, n, T>& reference)
+{
+    double difference = 0;
+    double scale = 0;
+    for (uint16_t i = 0; i < m * n; i++)
+    {
+        difference = std::max(difference, static_cast<double>(std::abs(result[i] - reference[i])));
+        scale = std::max(scale, static_cast<double>(std::abs(reference[i])));
+    }
+    return (scale > 0) ? difference / scale : difference;
+}
+
+template <typename T, typename Fixed, typename Generic>
+void compare(const char* name, Fixed&& fixed, Generic&& generic)
+{
+    double worst = 0;
+    for (size_t i = 0; i < batchSize; i++) { worst = std::max(worst, relativeDifference(fixed(i), generic(i))); }
+
+    // Every result is stored, so no part of either computation can be skipped
+    std::vector<decltype(fixed(0))> results(batchSize);
+    const double genericNs = nsPerOp([&](const size_t i) { results[i] = generic(i); });
+    sink = sink + results[batchSize - 1][0];
+    const double fixedNs = nsPerOp([&](const size_t i) { results[i] = fixed(i); });
+    sink = sink + results[batchSize - 1][0];
+    std::printf("  %-26s %8.1f %8.1f %7.2fx   %.1e\n", name, genericNs, fixedNs, genericNs / fixedNs, worst);
+}
+
+template <typename T>
+void run(const char* typeName)
+{
+    std::mt19937 generator(1);
+    std::uniform_real_distribution<T> distribution(-1, 1);
+    std::vector<Matrix<4, 4, T>> a(batchSize), b(batchSize), c(batchSize);
+    std::vector<Matrix<4, 1, T>> v(batchSize);
+    for (size_t i = 0; i < batchSize; i++)
+    {
+        for (uint16_t j = 0; j < 16; j++)
+        {
+            a[i][j] = distribution(generator);
+            b[i][j] = distribution(generator);
+            c[i][j] = distribution(generator);
+        }
+        for (uint16_t j = 0; j < 4; j++) { v[i][j] = distribution(generator); }
+    }
+
+    std::printf("%s:\n  %-26s %8s %8s %8s   %s\n", typeName, "operation (ns/op)", "generic", "fixed", "speedup", "rel. diff");
+    compare<T>("mat_mul 4x4 * 4x4", [&](const size_t i) { return mat_mul(a[i], b[i]); }, [&](const size_t i) { return mat_mul<4, 4, 4>(a[i], b[i]); });
+    compare<T>("mat_mul 4x4 * 4x1", [&](const size_t i) { return mat_mul(a[i], v[i]); }, [&](const size_t i) { return mat_mul<4, 4, 1>(a[i], v[i]); });
+    compare<T>(
+        "mat_mul_add 4x4", [&](const size_t i) { return mat_mul_add(a[i], b[i], c[i]); },
+        [&](const size_t i) { return mat_mul<4, 4, 4>(a[i], b[i]) + c[i]; });
+    compare<T>(
+        "mat_mul_transpose_lhs 4x4", [&](const size_t i) { return mat_mul_transpose_lhs(a[i], b[i]); },
+        [&](const size_t i) { return mat_mul<4, 4, 4>(transpose(a[i]), b[i]); });
+    compare<T>("inverse 4x4", [&](const size_t i) { return inverse(a[i]); }, [&](const size_t i) { return inverse<4>(a[i]); });
+}
+
+int main()
+{
+    run<float>("float");
+    run<double>("double");
+    return 0;
+}
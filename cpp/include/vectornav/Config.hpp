@@ -82,6 +82,7 @@ namespace PacketFinders
 constexpr uint64_t mainBufferCapacity = 4096;
 constexpr uint64_t packetMaxLength = 3000;
 constexpr uint8_t maxNumPacketFinders = 3;  // FA , Ascii and FB
+constexpr uint8_t syncByteCapacity = 2;     // Longest sync signature of any packet finder
 
 // Fa
 constexpr uint16_t faPacketMaxLength = 2000;
@@ -105,9 +106,14 @@ namespace PacketDispatchers
 constexpr EnabledMeasurements cdEnabledMeasTypes = {
     TIME_GROUP_ENABLE, IMU_GROUP_ENABLE, GNSS_GROUP_ENABLE, ATTITUDE_GROUP_ENABLE, INS_GROUP_ENABLE, GNSS2_GROUP_ENABLE, 0, 0, 0, 0, 0, GNSS3_GROUP_ENABLE};
 constexpr uint8_t compositeDataQueueCapacity = 100;
+constexpr uint16_t sharedPacketPoolGrowth = 64;  // Buffers a shared packet pool allocates at a time, up to the capacity of its subscriber queues
+constexpr uint16_t compactCompositeDataValueCapacity = 256;  // Bytes of packed measurement values held by each CompactCompositeData
+constexpr uint8_t compactCompositeDataFieldCapacity = 32;    // Measurement fields held by each CompactCompositeData
 
 // Fa
-constexpr uint8_t faPacketSubscriberCapacity = 5;
+constexpr uint8_t faPacketSubscriberCapacity = 5;  // Initial capacity, grows as needed
+constexpr uint8_t faRouteCacheCapacity = 16;       // Distinct binary headers whose matching subscribers are remembered
+constexpr uint8_t measurementReducerWindowCapacity = 4;  // Distinct binary outputs whose decimation or averaging windows are tracked at once
 
 // Ascii
 constexpr uint8_t asciiPacketSubscriberCapacity = 5;
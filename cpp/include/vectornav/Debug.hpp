@@ -85,72 +85,20 @@ static std::vector<std::string> LIGHTWEIGHT_DEBUG_VECTOR;
 #endif
 
 #if (VN_PROFILING_ENABLE)
-#include "vectornav/HAL/Timer.hpp"
-
-struct TimeThings
-{
-    uint64_t timeElapsedNs = 0;
-    uint64_t count = 0;
-};
-
-#include <array>
-#include <map>
-#include <unordered_map>
-
-inline std::unordered_map<uint32_t, TimeThings> timers{};
-inline std::unordered_map<uint32_t, std::string> timer_names{};
-
-#define VN_PROFILER_ADD_STRING_ONCE(key, value) \
-    do {                                        \
-        static bool added_##key = false;        \
-        if (!added_##key)                       \
-        {                                       \
-            (timer_names)[key] = value;         \
-            added_##key = true;                 \
-        }                                       \
-    } while (0)
-
-class ScopedStopwatch : public VN::Timer
-{
-public:
-    ScopedStopwatch(uint32_t timerId) : Timer(), _timerId(timerId) { start(); }
-    ~ScopedStopwatch()
-    {
-        timers[_timerId].timeElapsedNs += timeElapsed().count();
-        ++timers[_timerId].count;
-    }
+#include "vectornav/Implementation/Profiler.hpp"
 
-private:
-    uint32_t _timerId;
-};
-
-constexpr uint32_t fnv1a(const char* str, uint32_t hash = 2166136261u)
-{
-    return (*str == '\0') ? hash : fnv1a(str + 1, (hash ^ static_cast<uint32_t>(*str)) * 16777619u);
-}
-
-#define VN_PROFILER_S1(x) #x
-#define VN_PROFILER_S2(x) VN_PROFILER_S1(x)
-#define VN_PROFILER_FILE_AND_LINE __FILE__ "-" VN_PROFILER_S2(__LINE__)
-
-#define VN_PROFILER_TIME_CURRENT_SCOPE()                               \
-    constexpr uint32_t hashed_id = fnv1a(VN_PROFILER_FILE_AND_LINE);   \
-    VN_PROFILER_ADD_STRING_ONCE(hashed_id, VN_PROFILER_FILE_AND_LINE); \
-    ScopedStopwatch SCOPED_STOPWATCH_##hashed_id(hashed_id);
-
-#define VN_PROFILER_PRINT_TIMERS()                                                                                                                 \
-    std::map<std::string, TimeThings> ordered_timers{};                                                                                            \
-    for (const auto& timer : timers) { ordered_timers[timer_names[timer.first]] = timer.second; }                                                  \
-    size_t idx = 0;                                                                                                                                \
-    for (const auto& timer : ordered_timers)                                                                                                       \
-    {                                                                                                                                              \
-        std::cout << std::to_string(idx++) << ": " << timer.first << std::endl;                                                                    \
-        std::cout << "    Total time (ms): " << std::to_string(float(timer.second.timeElapsedNs) * 1e-6) << std::endl;                             \
-        std::cout << "    Hit count      : " << std::to_string(timer.second.count) << std::endl;                                                   \
-        std::cout << "    Avg time   (us): " << std::to_string(float(timer.second.timeElapsedNs) / float(timer.second.count) * 1e-3) << std::endl; \
-    }
+#define VN_PROFILER_TIME_CURRENT_SCOPE() VN_PROFILER_TIME_SCOPE(__func__)
+
+#define VN_PROFILER_SET_THREAD_NAME(name) VN::Profiler::setThreadName(name)
+
+#define VN_PROFILER_PRINT_TIMERS() VN::Profiler::printReport(std::cout)
+
+#define VN_PROFILER_WRITE_CHROME_TRACE(outputStream) VN::Profiler::writeChromeTrace(outputStream)
 #else
+#define VN_PROFILER_TIME_SCOPE(name)
 #define VN_PROFILER_TIME_CURRENT_SCOPE()
+#define VN_PROFILER_SET_THREAD_NAME(name)
 #define VN_PROFILER_PRINT_TIMERS()
+#define VN_PROFILER_WRITE_CHROME_TRACE(outputStream)
 #endif
 #endif  // VN_DEBUG_HPP_
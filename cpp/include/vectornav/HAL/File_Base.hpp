@@ -85,6 +85,11 @@ public:
     /// @return An error occurred.
     virtual Errored open(const Filesystem::FilePath& filePath) = 0;
 
+    /// @brief Opens the specified file for writing, keeping its contents and writing after them.
+    /// @param filePath The file to open.
+    /// @return An error occurred.
+    virtual Errored openAppend(const Filesystem::FilePath& filePath) = 0;
+
     /// @brief Closes the file.
     virtual void close() = 0;
 
@@ -163,6 +163,12 @@ public:
         return !_file.good();
     }
 
+    virtual Errored openAppend(const Filesystem::FilePath& filePath) override final
+    {
+        _file.open(filePath.c_str(), std::ios_base::binary | std::ios_base::app);
+        return !_file.good();
+    }
+
     virtual void close() override final
     {
         if (_file.is_open())
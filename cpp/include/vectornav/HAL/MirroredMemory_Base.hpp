@@ -0,0 +1,56 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.99.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef VN_MIRROREDMEMORY_BASE_HPP_
+#define VN_MIRROREDMEMORY_BASE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace VN
+{
+
+/// @brief Memory whose capacity bytes are mapped twice, back to back, so that data()[i + capacity()] aliases data()[i]. Backs a ByteBuffer with
+/// Layout::Mirrored. The capacity is rounded up to a whole number of pages. Where the platform cannot map it, or the mapping fails, data() is
+/// nullptr and the caller should fall back to an ordinary ring ByteBuffer.
+class MirroredMemory_Base
+{
+public:
+    MirroredMemory_Base() {}
+
+    MirroredMemory_Base(const MirroredMemory_Base&) = delete;
+    MirroredMemory_Base& operator=(const MirroredMemory_Base&) = delete;
+    MirroredMemory_Base(MirroredMemory_Base&&) = delete;
+    MirroredMemory_Base& operator=(MirroredMemory_Base&&) = delete;
+
+    uint8_t* data() const noexcept { return _data; }
+    size_t capacity() const noexcept { return _capacity; }
+
+protected:
+    uint8_t* _data = nullptr;
+    size_t _capacity = 0;
+};
+
+}  // namespace VN
+
+#endif  // VN_MIRROREDMEMORY_BASE_HPP_
@@ -0,0 +1,83 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.99.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef VN_MIRROREDMEMORY_LINUX_HPP_
+#define VN_MIRROREDMEMORY_LINUX_HPP_
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "vectornav/HAL/MirroredMemory_Base.hpp"
+
+namespace VN
+{
+
+/// @brief Maps a memfd twice over one reserved region.
+class MirroredMemory : public MirroredMemory_Base
+{
+public:
+    explicit MirroredMemory(const size_t capacity) noexcept
+    {
+        const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        const size_t mappedCapacity = (capacity + pageSize - 1) / pageSize * pageSize;
+        if (mappedCapacity == 0) { return; }
+
+        const int fileDescriptor = memfd_create("vn_bytebuffer", MFD_CLOEXEC);
+        if (fileDescriptor < 0) { return; }
+        if (ftruncate(fileDescriptor, static_cast<off_t>(mappedCapacity)) != 0)
+        {
+            close(fileDescriptor);
+            return;
+        }
+
+        // Reserve both halves at once, then map the same file over each
+        void* region = mmap(nullptr, 2 * mappedCapacity, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (region == MAP_FAILED)
+        {
+            close(fileDescriptor);
+            return;
+        }
+        uint8_t* first = static_cast<uint8_t*>(region);
+        const int protection = PROT_READ | PROT_WRITE;
+        const int flags = MAP_SHARED | MAP_FIXED;
+        const bool firstMapped = mmap(first, mappedCapacity, protection, flags, fileDescriptor, 0) != MAP_FAILED;
+        const bool secondMapped = firstMapped && mmap(first + mappedCapacity, mappedCapacity, protection, flags, fileDescriptor, 0) != MAP_FAILED;
+        close(fileDescriptor);  // The mappings keep the memory alive
+        if (!secondMapped)
+        {
+            munmap(region, 2 * mappedCapacity);
+            return;
+        }
+        _data = first;
+        _capacity = mappedCapacity;
+    }
+
+    ~MirroredMemory()
+    {
+        if (_data) { munmap(_data, 2 * _capacity); }
+    }
+};
+
+}  // namespace VN
+
+#endif  // VN_MIRROREDMEMORY_LINUX_HPP_
@@ -46,6 +46,11 @@ public:
     {
     }
 
+    bool isPlausiblePacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) const noexcept override
+    {
+        return AsciiPacketProtocol::isPlausiblePacket(byteBuffer, syncByteIndex);
+    }
+
     PacketDispatcher::FindPacketRetVal findPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept override;
 
     Error dispatchPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept override;
@@ -79,11 +84,10 @@ private:
     Subscribers _subscribers;
     bool _parseToCD;
 
-    Error _tryPushToCompositeDataQueue(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const AsciiPacketProtocol::Metadata& metadata,
-                                       AsciiPacketProtocol::AsciiMeasurementHeader measEnum) noexcept;
+    Error _tryPushToCompositeDataQueue(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const AsciiPacketProtocol::Metadata& metadata) noexcept;
     Error _invokeSubscribers(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const AsciiPacketProtocol::Metadata& metadata) noexcept;
     Error _tryPushToSubscriber(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const AsciiPacketProtocol::Metadata& metadata,
-                               Subscriber& subscriber) noexcept;
+                               Subscriber& subscriber, SharedPacketPool::Ref& shared) noexcept;
 };
 }  // namespace VN
 
@@ -24,6 +24,7 @@
 #ifndef VN_ASCIIPACKETPROTOCOL_HPP_
 #define VN_ASCIIPACKETPROTOCOL_HPP_
 
+#include <array>
 #include <cstddef>
 
 #include "vectornav/Config.hpp"
@@ -71,9 +72,27 @@ using DelimiterIndices = Vector<uint16_t, Config::PacketFinders::asciiMaxFieldCo
 using AsciiParameter = String<Config::PacketFinders::asciiFieldMaxLength>;
 using Validity = PacketDispatcher::FindPacketRetVal::Validity;
 
+/// @brief One measurement within an ASCII message, addressed the same way as the binary output groups.
+struct AsciiMeasurementField
+{
+    uint8_t measGroupIndex;
+    uint8_t measTypeIndex;
+};
+
+/// @brief Static parse table for one ASCII measurement message. Resolved once per packet by findPacket and carried in its Metadata.
+struct AsciiMeasurementDescriptor
+{
+    std::array<char, 3> name;  ///< Header characters following "VN"
+    AsciiMeasurementHeader header;
+    uint8_t numParameters;  ///< Comma separated values before any appended fields
+    uint8_t numFields;      ///< Used entries of fields; zero for messages that are recognized but not parsed
+    std::array<AsciiMeasurementField, 9> fields;
+};
+
 struct Metadata : public PacketMetadata<AsciiHeader>
 {
     DelimiterIndices delimiterIndices;
+    const AsciiMeasurementDescriptor* measurement = nullptr;  ///< Null unless the header is a known VN measurement message
 };
 
 struct FindPacketReturn
@@ -84,12 +103,21 @@ struct FindPacketReturn
 
 AsciiMeasurementHeader getMeasHeader(AsciiHeader headerChars);
 
+const AsciiMeasurementDescriptor* findMeasurementDescriptor(const AsciiHeader& header) noexcept;
+
+const AsciiMeasurementDescriptor* findMeasurementDescriptor(const AsciiMeasurementHeader header) noexcept;
+
 std::optional<EnabledMeasurements> asciiHeaderToMeasHeader(const AsciiMeasurementHeader header) noexcept;
 
 FindPacketReturn findPacket(const ByteBuffer& byteBuffer) noexcept;
 
+/// @brief Checks that the header begins with an uppercase letter, once it has been received.
+bool isPlausiblePacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept;
+
 FindPacketReturn findPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept;
 
+std::optional<CompositeData> parsePacket(const ByteBuffer& buffer, const size_t syncByteIndex, const Metadata& metadata) noexcept;
+
 std::optional<CompositeData> parsePacket(const ByteBuffer& buffer, const size_t syncByteIndex, const Metadata& metadata,
                                          AsciiMeasurementHeader measEnum) noexcept;
 
@@ -24,9 +24,14 @@
 #ifndef VN_FAPACKETDISPATCHER_HPP_
 #define VN_FAPACKETDISPATCHER_HPP_
 
+#include <array>
+#include <memory>
+#include <optional>
+
 #include "vectornav/Config.hpp"
 #include "vectornav/Implementation/BinaryHeader.hpp"
 #include "vectornav/Implementation/FaPacketProtocol.hpp"
+#include "vectornav/Implementation/MeasurementReducer.hpp"
 #include "vectornav/Implementation/PacketDispatcher.hpp"
 #include "vectornav/Implementation/QueueDefinitions.hpp"
 #include "vectornav/TemplateLibrary/ByteBuffer.hpp"
@@ -38,9 +43,17 @@ namespace VN
 class FaPacketDispatcher : public PacketDispatcher
 {
 public:
-    FaPacketDispatcher(MeasurementQueue* measurementQueue, EnabledMeasurements enabledMeasurements, bool parseToCD = true)
+    /// subscriberCapacity is only the initial capacity; it grows as subscribers are added.
+    FaPacketDispatcher(MeasurementQueue* measurementQueue, EnabledMeasurements enabledMeasurements, bool parseToCD = true,
+                       const uint16_t subscriberCapacity = Config::PacketDispatchers::faPacketSubscriberCapacity)
         : PacketDispatcher({0xFA}), _compositeDataQueue(measurementQueue), _enabledMeasurements(enabledMeasurements), _parseToCD{parseToCD}
     {
+        _reserveSubscribers(subscriberCapacity);
+    }
+
+    bool isPlausiblePacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) const noexcept override
+    {
+        return FaPacketProtocol::isPlausiblePacket(byteBuffer, syncByteIndex);
     }
 
     PacketDispatcher::FindPacketRetVal findPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept override;
@@ -56,32 +69,67 @@ public:
         NotExactMatch
     };
 
-    Error addSubscriber(PacketQueue_Interface* subscriber, EnabledMeasurements headerToUse, SubscriberFilterType filterType) noexcept;
+    /// decimation > 1 pushes only every decimation-th packet matching the filter to this subscriber.
+    Error addSubscriber(PacketQueue_Interface* subscriber, EnabledMeasurements headerToUse, SubscriberFilterType filterType,
+                        const uint16_t decimation = 1) noexcept;
 
     void removeSubscriber(PacketQueue_Interface* subscriberToRemove) noexcept;
     void removeSubscriber(PacketQueue_Interface* subscriberToRemove, const EnabledMeasurements& headerToUse) noexcept;
 
+    uint16_t numSubscribers() const noexcept { return _numSubscribers; }
+
+    /// Sets how measurements are reduced before they reach the MeasurementQueue. See MeasurementReducer.
+    void setMeasurementReduction(const MeasurementReducer::Mode mode, const uint16_t factor) noexcept { _measurementReducer.configure(mode, factor); }
+
 protected:
     struct Subscriber
     {
         PacketQueue_Interface* queueToPush;
         EnabledMeasurements headerFilter;
         SubscriberFilterType filterType;
+        uint16_t decimation = 1;
+        uint16_t skipped = 0;  // Matching packets not pushed since the last one that was
     };
 
-    static const auto SUBSCRIBER_CAPACITY = Config::PacketDispatchers::faPacketSubscriberCapacity;
-    using Subscribers = Vector<Subscriber, SUBSCRIBER_CAPACITY>;
-    Subscribers _subscribers;
+    std::unique_ptr<Subscriber[]> _subscribers;
+    uint16_t _numSubscribers = 0;
+    uint16_t _subscriberCapacity = 0;
+
+    /// Everything dispatch needs to know about one distinct binary header, so subscriber filters are only evaluated when a header is
+    /// first seen or the subscribers change.
+    struct Route
+    {
+        BinaryHeader header;
+        uint32_t hash = 0;
+        bool valid = false;
+        std::optional<EnabledMeasurements> measurementHeader;
+        bool parseToCD = false;
+        uint16_t numMatches = 0;
+        const uint16_t* matches = nullptr;  // Indices into _subscribers
+    };
+
+    static constexpr uint8_t ROUTE_CACHE_CAPACITY = Config::PacketDispatchers::faRouteCacheCapacity;
+    static_assert((ROUTE_CACHE_CAPACITY & (ROUTE_CACHE_CAPACITY - 1)) == 0, "ROUTE_CACHE_CAPACITY must be a power of two.");
+    std::array<Route, ROUTE_CACHE_CAPACITY> _routes;
+    std::unique_ptr<uint16_t[]> _routeMatches;  // ROUTE_CACHE_CAPACITY rows of _subscriberCapacity entries
 
     MeasurementQueue* _compositeDataQueue;
     EnabledMeasurements _enabledMeasurements;
     FaPacketProtocol::Metadata _latestPacketMetadata;
+    MeasurementReducer _measurementReducer;
     bool _parseToCD;
 
+    const Route& _findRoute(const BinaryHeader& header) noexcept;
+    void _invalidateRoutes() noexcept;
+    void _reserveSubscribers(const uint16_t capacity) noexcept;
+    void _eraseSubscriber(const uint16_t index) noexcept;
+    static bool _subscriberMatches(const Subscriber& subscriber, const EnabledMeasurements& packetHeader) noexcept;
+
     Error _tryPushToCompositeDataQueue(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const FaPacketProtocol::Metadata& packetDetails) noexcept;
-    Error _invokeSubscribers(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const FaPacketProtocol::Metadata& packetDetails) noexcept;
+    Error _invokeSubscribers(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const FaPacketProtocol::Metadata& packetDetails,
+                             const Route& route) noexcept;
     Error _tryPushToSubscriber(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const FaPacketProtocol::Metadata& metadata,
-                               Subscriber& subscriber) noexcept;
+                               Subscriber& subscriber, SharedPacketPool::Ref& shared) noexcept;
 };
 
 }  // namespace VN
@@ -31,6 +31,7 @@
 #include "vectornav/Implementation/BinaryHeader.hpp"
 #include "vectornav/Implementation/MeasurementDatatypes.hpp"
 #include "vectornav/Implementation/PacketDispatcher.hpp"
+#include "vectornav/Interface/CompactCompositeData.hpp"
 #include "vectornav/Interface/CompositeData.hpp"
 #include "vectornav/TemplateLibrary/ByteBuffer.hpp"
 
@@ -49,11 +50,18 @@ struct FindPacketReturn
     Metadata metadata;
 };
 
+/// @brief Checks the group bytes and the first type word, as far as they have been received, against the known groups and types.
+bool isPlausiblePacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept;
+
 FindPacketReturn findPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept;
 
 std::optional<CompositeData> parsePacket(const ByteBuffer& buffer, const size_t syncByteIndex, const Metadata& metadata,
                                          const EnabledMeasurements& measurementsToParse) noexcept;
 
+/// @brief Parses the packet in place into compactData, which is reset first. Errors when the packet is malformed, no field was stored, or an
+/// enabled field did not fit in compactData.
+Errored parsePacket(const ByteBuffer& buffer, const size_t syncByteIndex, const Metadata& metadata, CompactCompositeData& compactData) noexcept;
+
 }  // namespace FaPacketProtocol
 
 class FaPacketExtractor
@@ -90,12 +98,12 @@ public:
     Errored discard(const uint8_t group, const uint8_t field) noexcept
     {
         uint16_t numDiscard = 0;
-        if ((group == 3 || group == 6) && (field == 14 || field == 16))
+        if ((group == 3 || group == 6 || group == 12) && (field == 14 || field == 16))
         {
             if (field == 14)
             {
                 const uint8_t numSats = _buffer.peek_unchecked(_index);
-                numDiscard += 2 + 10 * numSats;
+                numDiscard += 2 + 8 * numSats;
             }
             else
             {
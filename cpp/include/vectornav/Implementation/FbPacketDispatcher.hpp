@@ -40,15 +40,20 @@ class FbPacketDispatcher : public PacketDispatcher
 {
 public:
     FbPacketDispatcher(FaPacketDispatcher* faSubsciberInvoker, const size_t byteBufferCapacity)
-        : PacketDispatcher({0xFB}), _faPacketDispatcher(faSubsciberInvoker), _fbByteBuffer(byteBufferCapacity)
+        : PacketDispatcher({0xFB, 0x00}), _faPacketDispatcher(faSubsciberInvoker), _fbByteBuffer(byteBufferCapacity)
     {
     }
 
     FbPacketDispatcher(FaPacketDispatcher* faSubsciberInvoker, uint8_t* bufferHead, size_t bufferCapacity)
-        : PacketDispatcher({0xFB}), _faPacketDispatcher(faSubsciberInvoker), _fbByteBuffer(bufferHead, bufferCapacity)
+        : PacketDispatcher({0xFB, 0x00}), _faPacketDispatcher(faSubsciberInvoker), _fbByteBuffer(bufferHead, bufferCapacity)
     {
     }
 
+    bool isPlausiblePacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) const noexcept override
+    {
+        return FbPacketProtocol::isPlausiblePacket(byteBuffer, syncByteIndex);
+    }
+
     PacketDispatcher::FindPacketRetVal findPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept override;
 
     Error dispatchPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept override;
@@ -66,7 +71,8 @@ public:
     {
         if (subscriber == nullptr) { return Error::PacketQueueNull; }
         if (_subscribers.push_back(Subscriber{subscriber, filter})) { return Error::MessageSubscriberCapacityReached; }
-        else { return Error::None; }
+        _reserveSharedBuffers(subscriber->capacity());
+        return Error::None;
     }
 
     void removeSubscriber(PacketQueue_Interface* subscriberToRemove) noexcept
@@ -74,27 +80,44 @@ public:
         for (auto itr = _subscribers.begin(); itr != _subscribers.end();)
         {
             auto& subscriber = *itr;
-            if (subscriberToRemove == subscriber.queueToPush) { itr = _subscribers.erase(itr); }
+            if (subscriberToRemove == subscriber.queueToPush)
+            {
+                _unreserveSharedBuffers(subscriber.queueToPush->capacity());
+                itr = _subscribers.erase(itr);
+            }
             else { ++itr; }
         }
     }
 
 private:
-    void _resetFbBuffer() noexcept;
-    void _addFaPacketCrc() noexcept;
-    Error _moveBytesFromMainBufferToFbBuffer(FbPacketProtocol::Header splitPacketDetails, const ByteBuffer& byteBuffer, const uint16_t numOfBytesToMove,
-                                             const size_t startingIndex) noexcept;
-
-    FaPacketDispatcher* _faPacketDispatcher;
-    ByteBuffer _fbByteBuffer;
-    FbPacketProtocol::Metadata _latestPacketMetadata{};
-    FbPacketProtocol::Metadata _previousPacketMetadata{};
-
     struct Subscriber
     {
         PacketQueue_Interface* queueToPush{nullptr};
         SubscriberFilter filter;
     };
+
+    void _startMessage(const FbPacketProtocol::Header& header) noexcept;
+    void _dropMessage(const uint8_t messageId) noexcept;
+    bool _isNextPacketOfMessage(const FbPacketProtocol::Header& header) const noexcept;
+    Errored _appendPayload(const ByteBuffer& byteBuffer, const size_t payloadIndex, const uint16_t payloadLength) noexcept;
+    Error _dispatchCompletedMessage() noexcept;
+    Error _pushToSubscriber(Subscriber& subscriber, const ByteBuffer& byteBuffer, const size_t syncByteIndex, const uint16_t length,
+                            const PacketDetails& details, SharedPacketPool::Ref& shared) noexcept;
+
+    FaPacketDispatcher* _faPacketDispatcher;
+    ByteBuffer _fbByteBuffer;
+    FbPacketProtocol::Metadata _latestPacketMetadata{};
+
+    // The message being reassembled in _fbByteBuffer. Each payload is copied in once and the FA CRC is accumulated as it is copied.
+    uint8_t _messageId = 0;
+    uint8_t _totalPacketCount = 0;
+    uint8_t _receivedPacketCount = 0;  // 0 while no message is in progress
+    uint16_t _faCrc = 0;
+
+    // The remaining packets of a dropped message are skipped without raising another error.
+    bool _messageWasDropped = false;
+    uint8_t _droppedMessageId = 0;
+
     static const auto SUBSCRIBER_CAPACITY = 1;
     using Subscribers = Vector<Subscriber, SUBSCRIBER_CAPACITY>;
     Subscribers _subscribers;
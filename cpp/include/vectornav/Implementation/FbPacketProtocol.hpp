@@ -66,6 +66,9 @@ struct FindPacketReturn
     Metadata metadata;
 };
 
+/// @brief Checks the packet counts and payload length, as far as they have been received.
+bool isPlausiblePacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept;
+
 FindPacketReturn findPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept;
 
 }  // namespace FbPacketProtocol
@@ -0,0 +1,103 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.99.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef VN_MEASUREMENTREDUCER_HPP_
+#define VN_MEASUREMENTREDUCER_HPP_
+
+#include <array>
+#include <cstdint>
+
+#include "vectornav/Config.hpp"
+#include "vectornav/Implementation/MeasurementDatatypes.hpp"
+#include "vectornav/Interface/CompositeData.hpp"
+
+namespace VN
+{
+
+/// Reduces the rate of parsed measurements on their way to the MeasurementQueue, so a consumer slower than the sensor costs queue space and CPU in
+/// proportion to its own rate. Each binary output (distinct measurement header) is reduced on its own, so interleaved outputs at different rates
+/// do not disturb each other. Up to Config::PacketDispatchers::measurementReducerWindowCapacity outputs are reduced; measurements of any further
+/// outputs pass through unreduced.
+class MeasurementReducer
+{
+public:
+    enum class Mode : uint8_t
+    {
+        PassThrough,  ///< Every measurement is queued.
+        Decimate,     ///< Every factor-th measurement of each output is queued. The others are not parsed at all.
+        Average,      ///< Each factor measurements of an output are combined into one; see add().
+        LatestOnly    ///< Every measurement is queued, but at most factor stay unconsumed. Older ones are discarded to make room.
+    };
+
+    MeasurementReducer(const Mode mode = Mode::PassThrough, const uint16_t factor = 1) noexcept { configure(mode, factor); }
+
+    /// Changes the mode and factor, and discards any partially filled windows.
+    void configure(const Mode mode, const uint16_t factor) noexcept;
+
+    Mode mode() const noexcept { return _mode; }
+    uint16_t factor() const noexcept { return _factor; }
+
+    /// Called for each packet before it is parsed. Returns false if the measurement will not be used, in which case it need not be parsed and
+    /// add() must not be called for it.
+    bool admit(const EnabledMeasurements& header) noexcept;
+
+    /**
+     * @brief Adds the measurement of the packet last admitted, reducing it in place.
+     * In Average mode, the IMU rates, accelerations, magnetic fields, temperature and pressure and the attitude group's NED and linear
+     * accelerations and magnetic field are averaged over the window. The delta theta and delta velocity are summed, integrating over the whole
+     * window (exact for the delta time and velocity, and to first order in the rotation for delta theta). Saturation flags are or'ed. Every other
+     * field, including all time fields, is taken from the last measurement of the window, so the output is stamped at the end of the interval it
+     * covers.
+     * @return The measurement to queue, or nullptr while the window is still filling.
+     */
+    const CompositeData* add(CompositeData& compositeData) noexcept;
+
+private:
+    struct Window
+    {
+        EnabledMeasurements header{};
+        uint16_t count = 0;
+        bool used = false;
+#if (IMU_GROUP_ENABLE)
+        CompositeData::ImuGroup imu;  // Running sums of the averaged and integrated IMU fields
+#endif
+#if (ATTITUDE_GROUP_ENABLE)
+        CompositeData::AttitudeGroup attitude;  // Running sums of the averaged attitude group fields
+#endif
+    };
+
+    static constexpr uint8_t WINDOW_CAPACITY = Config::PacketDispatchers::measurementReducerWindowCapacity;
+    std::array<Window, WINDOW_CAPACITY> _windows;
+    Window* _current = nullptr;
+
+    Mode _mode = Mode::PassThrough;
+    uint16_t _factor = 1;
+
+    Window* _findWindow(const EnabledMeasurements& header) noexcept;
+    void _accumulate(Window& window, const CompositeData& compositeData) noexcept;
+    static void _applyAverages(const Window& window, CompositeData& compositeData) noexcept;
+};
+
+}  // namespace VN
+
+#endif  // VN_MEASUREMENTREDUCER_HPP_
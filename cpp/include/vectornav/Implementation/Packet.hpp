@@ -30,7 +30,9 @@
 #include "AsciiPacketProtocol.hpp"
 #include "FaPacketProtocol.hpp"
 #include "FbPacketProtocol.hpp"
+#include "PacketArena.hpp"
 #include "PacketDispatcher.hpp"
+#include "SharedPacketPool.hpp"
 
 namespace VN
 {
@@ -57,28 +59,46 @@ struct PacketDetails
 
 struct Packet
 {
-    Packet(uint16_t capacity) : buffer(new uint8_t[capacity]), capacity(capacity) {}
+    /// A packet constructed with zero capacity has no storage of its own, and is only ever filled by sharing a pooled buffer.
+    Packet(uint16_t capacity) : buffer(new uint8_t[capacity]), capacity(capacity), _ownBuffer(buffer) {}
 
     template <uint16_t Capacity>
-    Packet(std::array<uint8_t, Capacity>& externalBuffer) : buffer(externalBuffer.data()), capacity(Capacity), _autoAllocated(false)
+    Packet(std::array<uint8_t, Capacity>& externalBuffer)
+        : buffer(externalBuffer.data()), capacity(Capacity), _ownBuffer(externalBuffer.data()), _autoAllocated(false)
     {
     }
+
+    /// Takes its storage from slab, and returns it there when destroyed. If the slab has no free buffer, the packet has zero capacity.
+    Packet(PacketSlab* slab)
+        : buffer(slab->acquire()), capacity(buffer != nullptr ? slab->bufferCapacity() : 0), _ownBuffer(buffer), _slab(slab), _autoAllocated(false)
+    {
+    }
+
     ~Packet()
     {
-        if (_autoAllocated) { delete[] buffer; }
+        if (_autoAllocated) { delete[] _ownBuffer; }
+        else if (_slab != nullptr) { _slab->release(_ownBuffer); }
     }
 
     Packet(const Packet&) = delete;
     Packet& operator=(const Packet&) = delete;
 
-    Packet(Packet&& other) noexcept : details(std::move(other.details)), _autoAllocated(true)
+    /// Takes over the storage of other unless it is an external buffer, which is copied.
+    Packet(Packet&& other) noexcept
+        : details(std::move(other.details)), _slab(other._slab), _shared(std::move(other._shared)), _autoAllocated(other._slab == nullptr)
     {
-        if (other._autoAllocated) { std::swap(buffer, other.buffer); }
+        if (other._autoAllocated || other._slab != nullptr)
+        {
+            std::swap(_ownBuffer, other._ownBuffer);
+            other._slab = nullptr;
+        }
         else
         {
-            buffer = new uint8_t[other.capacity];
-            std::memcpy(buffer, other.buffer, other.capacity);
+            _ownBuffer = new uint8_t[other.capacity];
+            std::memcpy(_ownBuffer, other._ownBuffer, other.capacity);
         }
+        buffer = _shared ? _shared.data() : _ownBuffer;
+        other.buffer = other._ownBuffer;
         std::swap(capacity, other.capacity);
     }
 
@@ -121,7 +141,44 @@ struct Packet
         }
     }
 
+    /// Points buffer at length bytes of byteBuffer starting at startIndex. A packet with storage of its own gets a copy. Otherwise it
+    /// references shared, which is acquired from pool and filled on first use, so every such packet filled with the same shared holds the
+    /// same single copy.
+    Errored fill(const ByteBuffer& byteBuffer, const size_t startIndex, const uint16_t length, SharedPacketPool* pool, SharedPacketPool::Ref& shared) noexcept
+    {
+        releaseShared();
+        if (capacity > 0)
+        {
+            if (capacity < length) { return true; }
+            byteBuffer.peek_unchecked(buffer, length, startIndex);
+            return false;
+        }
+        if (!shared)
+        {
+            if (pool == nullptr) { return true; }
+            shared = pool->acquire(length);
+            if (!shared) { return true; }
+            byteBuffer.peek_unchecked(shared.data(), length, startIndex);
+        }
+        _shared = shared;
+        buffer = _shared.data();
+        return false;
+    }
+
+    /// Drops this packet's reference to a pooled buffer, if it holds one.
+    void releaseShared() noexcept
+    {
+        if (_shared)
+        {
+            _shared.reset();
+            buffer = _ownBuffer;
+        }
+    }
+
 private:
+    uint8_t* _ownBuffer = nullptr;
+    PacketSlab* _slab = nullptr;
+    SharedPacketPool::Ref _shared;
     const bool _autoAllocated = true;
 };
 
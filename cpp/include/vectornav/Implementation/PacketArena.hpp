@@ -0,0 +1,172 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.99.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef VN_PACKETARENA_HPP_
+#define VN_PACKETARENA_HPP_
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+#include "vectornav/Config.hpp"
+#include "vectornav/HAL/Mutex.hpp"
+
+namespace VN
+{
+
+/// A fixed number of equally sized packet buffers in one contiguous block. Free buffers are kept in a list threaded through the buffers
+/// themselves, so acquiring and releasing never allocates.
+class PacketSlab
+{
+public:
+    /// Allocates the block once, here.
+    PacketSlab(const uint16_t numBuffers, const uint16_t bufferCapacity)
+        : _ownStorage(numBuffers > 0 ? new uint8_t[static_cast<size_t>(numBuffers) * bufferCapacity] : nullptr)
+    {
+        _carve(_ownStorage.get(), numBuffers, bufferCapacity);
+    }
+
+    /// Carves the buffers from storage, which must hold numBuffers * bufferCapacity bytes and outlive the slab.
+    PacketSlab(uint8_t* storage, const uint16_t numBuffers, const uint16_t bufferCapacity) { _carve(storage, numBuffers, bufferCapacity); }
+
+    PacketSlab(const PacketSlab&) = delete;
+    PacketSlab& operator=(const PacketSlab&) = delete;
+
+    /// Returns nullptr if every buffer is in use.
+    uint8_t* acquire() noexcept
+    {
+        LockGuard lock(_mutex);
+        uint8_t* buffer = _freeHead;
+        if (buffer == nullptr) { return nullptr; }
+        std::memcpy(&_freeHead, buffer, sizeof(_freeHead));
+        --_numFree;
+        return buffer;
+    }
+
+    /// Returns a buffer obtained from acquire.
+    void release(uint8_t* buffer) noexcept
+    {
+        if (buffer == nullptr) { return; }
+        LockGuard lock(_mutex);
+        std::memcpy(buffer, &_freeHead, sizeof(_freeHead));
+        _freeHead = buffer;
+        ++_numFree;
+    }
+
+    bool owns(const uint8_t* buffer) const noexcept
+    {
+        return buffer >= _data && buffer < _data + static_cast<size_t>(_numBuffers) * _bufferCapacity &&
+               (static_cast<size_t>(buffer - _data) % _bufferCapacity) == 0;
+    }
+
+    uint16_t bufferCapacity() const noexcept { return _bufferCapacity; }
+    uint16_t numBuffers() const noexcept { return _numBuffers; }
+    uint16_t numFree() const noexcept
+    {
+        LockGuard lock(_mutex);
+        return _numFree;
+    }
+
+private:
+    std::unique_ptr<uint8_t[]> _ownStorage;
+    uint8_t* _data = nullptr;
+    uint8_t* _freeHead = nullptr;
+    uint16_t _numBuffers = 0;
+    uint16_t _bufferCapacity = 0;
+    uint16_t _numFree = 0;
+    mutable Mutex _mutex;
+
+    void _carve(uint8_t* storage, const uint16_t numBuffers, const uint16_t bufferCapacity) noexcept
+    {
+        static_assert(sizeof(uint8_t*) <= Config::PacketFinders::asciiPacketMaxLength);
+        _data = storage;
+        _numBuffers = storage != nullptr && bufferCapacity >= sizeof(uint8_t*) ? numBuffers : 0;
+        _bufferCapacity = bufferCapacity;
+        for (uint16_t i = _numBuffers; i > 0; --i) { release(_data + static_cast<size_t>(i - 1) * _bufferCapacity); }
+    }
+};
+
+/// Packet buffers for each kind of packet, all carved from a single allocation: ASCII, FA, and FA packets reassembled from FB packets.
+/// Give a PacketQueue the slab of its size class to build every packet of the queue without further allocation, e.g.
+/// PacketQueue<16> queue(PutMode::Force, &arena.slab(PacketArena::SizeClass::Fa)).
+class PacketArena
+{
+public:
+    enum class SizeClass : uint8_t
+    {
+        Ascii,
+        Fa,
+        Fb,
+    };
+    static constexpr uint8_t NUM_SIZE_CLASSES = 3;
+
+    static constexpr uint16_t bufferCapacity(const SizeClass sizeClass) noexcept
+    {
+        switch (sizeClass)
+        {
+            case SizeClass::Ascii:
+                return Config::PacketFinders::asciiPacketMaxLength;
+            case SizeClass::Fa:
+                return Config::PacketFinders::faPacketMaxLength;
+            case SizeClass::Fb:
+            default:
+                return static_cast<uint16_t>(Config::PacketFinders::packetMaxLength);
+        }
+    }
+
+    PacketArena(const uint16_t numAsciiBuffers, const uint16_t numFaBuffers, const uint16_t numFbBuffers)
+        : _storage(new uint8_t[_bytesFor(numAsciiBuffers, SizeClass::Ascii) + _bytesFor(numFaBuffers, SizeClass::Fa) +
+                               _bytesFor(numFbBuffers, SizeClass::Fb)]),
+          _slabs{{{_storage.get(), numAsciiBuffers, bufferCapacity(SizeClass::Ascii)},
+                  {_storage.get() + _bytesFor(numAsciiBuffers, SizeClass::Ascii), numFaBuffers, bufferCapacity(SizeClass::Fa)},
+                  {_storage.get() + _bytesFor(numAsciiBuffers, SizeClass::Ascii) + _bytesFor(numFaBuffers, SizeClass::Fa), numFbBuffers,
+                   bufferCapacity(SizeClass::Fb)}}}
+    {
+    }
+
+    PacketSlab& slab(const SizeClass sizeClass) noexcept { return _slabs[static_cast<uint8_t>(sizeClass)]; }
+
+    /// The smallest size class that can hold length bytes and still has a free buffer, or nullptr if there is none.
+    PacketSlab* slabFor(const uint16_t length) noexcept
+    {
+        for (auto& slab : _slabs)
+        {
+            if (slab.bufferCapacity() >= length && slab.numFree() > 0) { return &slab; }
+        }
+        return nullptr;
+    }
+
+private:
+    std::unique_ptr<uint8_t[]> _storage;
+    std::array<PacketSlab, NUM_SIZE_CLASSES> _slabs;
+
+    static constexpr size_t _bytesFor(const uint16_t numBuffers, const SizeClass sizeClass) noexcept
+    {
+        return static_cast<size_t>(numBuffers) * bufferCapacity(sizeClass);
+    }
+};
+
+}  // namespace VN
+
+#endif  // VN_PACKETARENA_HPP_
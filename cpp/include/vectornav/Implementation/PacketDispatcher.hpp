@@ -27,6 +27,7 @@
 #include <cstdint>
 
 #include "vectornav/Config.hpp"
+#include "vectornav/Implementation/SharedPacketPool.hpp"
 #include "vectornav/Interface/Errors.hpp"
 #include "vectornav/TemplateLibrary/ByteBuffer.hpp"
 #include "vectornav/TemplateLibrary/Vector.hpp"
@@ -43,7 +44,7 @@ struct PacketMetadata
     bool operator==(const PacketMetadata<T>& other) const noexcept { return header == other.header && length == other.length; }
 };
 
-constexpr uint8_t SYNC_BYTE_CAPACITY = 1;
+constexpr uint8_t SYNC_BYTE_CAPACITY = Config::PacketFinders::syncByteCapacity;
 
 class PacketDispatcher
 {
@@ -63,12 +64,47 @@ public:
         size_t length;
     };
 
+    /// A cheap look at the bytes following the sync bytes, which the PacketSynchronizer makes before findPacket. Returns false only when they
+    /// cannot begin a packet of this type; bytes not yet received are assumed to be plausible.
+    virtual bool isPlausiblePacket([[maybe_unused]] const ByteBuffer& byteBuffer, [[maybe_unused]] const size_t syncByteIndex) const noexcept
+    {
+        return true;
+    }
+
     virtual FindPacketRetVal findPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept = 0;
 
     virtual Error dispatchPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept = 0;
 
+    /// Subscribers whose packets have no storage of their own share buffers from this pool. Until one is set, or if nullptr is set, the
+    /// dispatcher uses a pool of its own.
+    void setSharedPacketPool(SharedPacketPool* pool) noexcept
+    {
+        SharedPacketPool* newPool = (pool != nullptr) ? pool : &_ownSharedPacketPool;
+        newPool->reserve(_numSharedBuffersReserved);
+        _sharedPacketPool->unreserve(_numSharedBuffersReserved);
+        _sharedPacketPool = newPool;
+    }
+
+protected:
+    /// Every slot of a subscriber queue may hold one pooled buffer, so the pool is allowed to grow to the subscribers' total queue capacity.
+    void _reserveSharedBuffers(const uint16_t queueCapacity) noexcept
+    {
+        _sharedPacketPool->reserve(queueCapacity);
+        _numSharedBuffersReserved += queueCapacity;
+    }
+
+    void _unreserveSharedBuffers(const uint16_t queueCapacity) noexcept
+    {
+        _sharedPacketPool->unreserve(queueCapacity);
+        _numSharedBuffersReserved -= queueCapacity;
+    }
+
+    SharedPacketPool* _sharedPacketPool = &_ownSharedPacketPool;
+
 private:
     Vector<uint8_t, SYNC_BYTE_CAPACITY> _syncBytes{};
+    SharedPacketPool _ownSharedPacketPool{0, Config::PacketFinders::packetMaxLength};
+    uint32_t _numSharedBuffersReserved = 0;
 };
 }  // namespace VN
 
@@ -24,6 +24,7 @@
 #ifndef VN_PACKETSYNCHRONIZER_HPP_
 #define VN_PACKETSYNCHRONIZER_HPP_
 
+#include <array>
 #include <cstdint>
 #include <functional>
 
@@ -62,6 +63,7 @@ public:
 
     using SyncBytes = Vector<uint8_t, SYNC_BYTE_CAPACITY>;
 
+    /// Dispatchers are looked up by the leading bytes of their sync signature, so {0xFB} finds the FB dispatcher.
     size_t getValidPacketCount(const SyncBytes& syncByte) const noexcept;
     size_t getInvalidPacketCount(const SyncBytes& syncByte) const noexcept;
     size_t getSkippedByteCount() const noexcept { return _skippedByteCount; }
@@ -78,8 +80,12 @@ private:
     };
 
     Error _copyToSkippedByteQueueIfEnabled(const size_t numBytesToCopy) const noexcept;
+    size_t _findFirstSyncByte(size_t fromHeadIndex, const size_t byteBufferSize) const noexcept;
+    bool _matchesSyncBytes(const SyncBytes& syncBytes, const size_t fromHeadIndex, const size_t byteBufferSize) const noexcept;
+    static bool _startsWith(const SyncBytes& syncBytes, const SyncBytes& prefix) noexcept;
 
     Vector<InternalItem, PACKET_PARSER_CAPACITY> _dispatchers{};
+    std::array<bool, 256> _isFirstSyncByte{};  // Whether any dispatcher's sync signature begins with the byte
 
     mutable uint64_t _skippedByteCount = 0;
     PacketQueue_Interface* _pSkippedByteQueue = nullptr;
@@ -0,0 +1,608 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.99.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef VN_PROFILER_HPP_
+#define VN_PROFILER_HPP_
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+// Debug.hpp includes this header from within Config.hpp's include chain, so HAL/Mutex.hpp (which includes Config.hpp) cannot be used here.
+// The same mutex is selected directly instead; THREADING_ENABLE defaults to true in Config.hpp when it is not defined yet.
+#if !defined(THREADING_ENABLE) || (THREADING_ENABLE)
+#ifdef __CLI__
+#include "vectornav/HAL/Mutex_CLI.hpp"
+#elif (_WIN32 | __linux__)
+#include "vectornav/HAL/Mutex_PC.hpp"
+#else
+static_assert(false);
+#endif
+#else
+#include "vectornav/HAL/Mutex_Disabled.hpp"
+#endif
+#include "vectornav/HAL/Thread.hpp"
+
+#ifndef VN_PROFILER_TIMING_STRIDE
+#define VN_PROFILER_TIMING_STRIDE 4
+#endif
+
+#ifndef VN_PROFILER_USE_TSC
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define VN_PROFILER_USE_TSC true
+#else
+#define VN_PROFILER_USE_TSC false
+#endif
+#endif
+
+#if (VN_PROFILER_USE_TSC)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
+
+namespace VN
+{
+namespace Profiler
+{
+
+constexpr uint16_t scopeCapacity = 256;               // Distinct instrumented scopes; further ones are not timed
+constexpr uint32_t traceEventCapacity = 1u << 14;     // Most recent scope executions kept per thread for trace export, a power of two
+constexpr uint8_t histogramBuckets = 48;              // Bucket b counts durations of [2^(b-1), 2^b) ticks
+constexpr uint64_t timingStride = VN_PROFILER_TIMING_STRIDE;  // Every execution of a scope is counted; one in timingStride is timed
+static_assert((traceEventCapacity & (traceEventCapacity - 1)) == 0, "traceEventCapacity must be a power of two.");
+static_assert(timingStride != 0 && (timingStride & (timingStride - 1)) == 0, "timingStride must be a power of two.");
+
+/// Timestamps in ticks of the time stamp counter where available, each a single raw read, else of std::chrono::steady_clock. Converted to nanoseconds only when read out.
+inline uint64_t ticks() noexcept
+{
+#if (VN_PROFILER_USE_TSC)
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+struct ScopeSite
+{
+    const char* name = nullptr;
+    const char* file = nullptr;
+    uint32_t line = 0;
+};
+
+/// Statistics of one scope on one thread. Only the owning thread writes them, so plain relaxed loads and stores suffice and readers on other
+/// threads never block it. The durations cover the timed executions only.
+struct ScopeCounters
+{
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> timedCount{0};
+    std::atomic<uint64_t> totalTicks{0};
+    std::atomic<uint64_t> minTicks{std::numeric_limits<uint64_t>::max()};
+    std::atomic<uint64_t> maxTicks{0};
+    std::array<std::atomic<uint64_t>, histogramBuckets> histogram{};
+
+    /// Adds these counters to total and clears them. Neither may be written by another thread meanwhile.
+    void moveInto(ScopeCounters& total) noexcept
+    {
+        const auto add = [](std::atomic<uint64_t>& to, std::atomic<uint64_t>& from, const uint64_t cleared) {
+            to.store(to.load(std::memory_order_relaxed) + from.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            from.store(cleared, std::memory_order_relaxed);
+        };
+        add(total.count, count, 0);
+        add(total.timedCount, timedCount, 0);
+        add(total.totalTicks, totalTicks, 0);
+        for (uint8_t b = 0; b < histogramBuckets; ++b) { add(total.histogram[b], histogram[b], 0); }
+        total.minTicks.store(std::min(total.minTicks.load(std::memory_order_relaxed), minTicks.load(std::memory_order_relaxed)), std::memory_order_relaxed);
+        total.maxTicks.store(std::max(total.maxTicks.load(std::memory_order_relaxed), maxTicks.load(std::memory_order_relaxed)), std::memory_order_relaxed);
+        minTicks.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+        maxTicks.store(0, std::memory_order_relaxed);
+    }
+};
+
+using ScopeCounterSet = std::array<ScopeCounters, scopeCapacity>;
+
+struct ThreadProfile
+{
+    uint32_t threadIndex = 0;
+    bool active = false;  // False while the profile waits in the free list. Guarded by the registry.
+    std::atomic<const char*> name{nullptr};
+    ScopeCounterSet scopes;
+
+    // Ring of the latest executions. Slots are atomics so an export can read them while the thread keeps writing; entries overwritten during
+    // the read are detected from head and dropped.
+    struct TraceEvent
+    {
+        std::atomic<uint64_t> start{0};
+        std::atomic<uint64_t> durationAndScope{0};  // Duration in ticks above the low 16 bits, scope ID in them
+    };
+    std::unique_ptr<TraceEvent[]> events{new TraceEvent[traceEventCapacity]};
+    std::atomic<uint64_t> head{0};
+};
+
+class Registry
+{
+public:
+    static Registry& instance() noexcept
+    {
+        static Registry registry;
+        return registry;
+    }
+
+    uint16_t registerScope(const char* name, const char* file, const uint32_t line) noexcept
+    {
+        LockGuard lock(_mutex);
+        const uint16_t id = _scopeCount.load(std::memory_order_relaxed);
+        if (id == scopeCapacity) { return scopeCapacity; }
+        _sites[id] = ScopeSite{name, file, line};
+        _scopeCount.store(id + 1, std::memory_order_release);
+        return id;
+    }
+
+    /// Hands out the profile of a thread that has exited if there is one, else a new profile.
+    ThreadProfile* registerThread()
+    {
+        LockGuard lock(_mutex);
+        ThreadProfile* profile;
+        if (!_freeProfiles.empty())
+        {
+            profile = _freeProfiles.back();
+            _freeProfiles.pop_back();
+            profile->name.store(nullptr, std::memory_order_relaxed);
+            profile->head.store(0, std::memory_order_relaxed);
+        }
+        else
+        {
+            _threads.push_back(std::make_unique<ThreadProfile>());
+            _freeProfiles.reserve(_threads.size());  // So retireThread never allocates
+            profile = _threads.back().get();
+        }
+        profile->threadIndex = ++_threadCount;  // Trace thread IDs are not reused
+        profile->active = true;
+        return profile;
+    }
+
+    /// Merges the counters of an exiting thread into the totals of exited threads and queues its profile for reuse. Its trace events are dropped.
+    void retireThread(ThreadProfile* profile) noexcept
+    {
+        LockGuard lock(_mutex);
+        const uint16_t scopeCount = _scopeCount.load(std::memory_order_acquire);
+        for (uint16_t id = 0; id < scopeCount; ++id) { profile->scopes[id].moveInto(_retiredScopes[id]); }
+        profile->active = false;
+        _freeProfiles.push_back(profile);
+    }
+
+    uint16_t scopeCount() const noexcept { return _scopeCount.load(std::memory_order_acquire); }
+    const ScopeSite& site(const uint16_t id) const noexcept { return _sites[id]; }
+
+    /// Calls f(const ThreadProfile&) for every running thread that has run an instrumented scope.
+    template <typename F>
+    void forEachThread(F&& f) const
+    {
+        LockGuard lock(_mutex);
+        for (const auto& thread : _threads)
+        {
+            if (thread->active) { f(*thread); }
+        }
+    }
+
+    /// Calls f(const ScopeCounterSet&) for every running thread, and once for the merged counters of the threads that have exited.
+    template <typename F>
+    void forEachCounterSet(F&& f) const
+    {
+        LockGuard lock(_mutex);
+        for (const auto& thread : _threads)
+        {
+            if (thread->active) { f(thread->scopes); }
+        }
+        f(_retiredScopes);
+    }
+
+    /// Nanoseconds per tick, measured against steady_clock since the registry was created when ticks come from the time stamp counter.
+    double nanosecondsPerTick() const noexcept
+    {
+#if (VN_PROFILER_USE_TSC)
+        const auto elapsed = std::chrono::steady_clock::now() - _epochClock;
+        const uint64_t elapsedTicks = ticks() - _epochTicks;
+        const double elapsedNs = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        return (elapsedTicks == 0 || elapsedNs < 1e6) ? _nominalNsPerTick() : elapsedNs / static_cast<double>(elapsedTicks);
+#else
+        return 1e9 * std::chrono::steady_clock::period::num / std::chrono::steady_clock::period::den;
+#endif
+    }
+
+    uint64_t epochTicks() const noexcept { return _epochTicks; }
+
+private:
+    Registry() = default;
+
+    mutable Mutex _mutex;
+    std::array<ScopeSite, scopeCapacity> _sites{};
+    std::atomic<uint16_t> _scopeCount{0};
+    std::vector<std::unique_ptr<ThreadProfile>> _threads;
+    std::vector<ThreadProfile*> _freeProfiles;
+    uint32_t _threadCount = 0;
+    ScopeCounterSet _retiredScopes;
+    const std::chrono::steady_clock::time_point _epochClock = std::chrono::steady_clock::now();
+    const uint64_t _epochTicks = ticks();
+
+#if (VN_PROFILER_USE_TSC)
+    /// Until enough time has passed to calibrate against, time a short busy wait instead.
+    static double _nominalNsPerTick() noexcept
+    {
+        static const double nominal = []() {
+            const auto start = std::chrono::steady_clock::now();
+            const uint64_t startTicks = ticks();
+            while (std::chrono::steady_clock::now() - start < std::chrono::milliseconds(2)) {}
+            const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+            const double ns = static_cast<double>(elapsed.count());
+            return ns / static_cast<double>(ticks() - startTicks);
+        }();
+        return nominal;
+    }
+#endif
+};
+
+namespace Detail
+{
+inline thread_local ThreadProfile* currentProfile = nullptr;  // Constant initialized, so reading it needs no guard
+
+/// Returns the calling thread's profile to the registry when the thread exits.
+struct ThreadProfileOwner
+{
+    ThreadProfile* profile = nullptr;
+    ~ThreadProfileOwner()
+    {
+        if (profile == nullptr) { return; }
+        currentProfile = nullptr;
+        Registry::instance().retireThread(profile);
+    }
+};
+
+inline ThreadProfile* registerCurrentThread()
+{
+    thread_local ThreadProfileOwner owner;
+    owner.profile = Registry::instance().registerThread();
+    currentProfile = owner.profile;
+    return owner.profile;
+}
+}  // namespace Detail
+
+inline ThreadProfile& threadProfile()
+{
+    ThreadProfile* profile = Detail::currentProfile;
+    return (profile != nullptr) ? *profile : *Detail::registerCurrentThread();
+}
+
+inline uint16_t registerScope(const char* name, const char* file, const uint32_t line) noexcept
+{
+    return Registry::instance().registerScope(name, file, line);
+}
+
+/// Names the calling thread in reports and traces.
+inline void setThreadName(const char* name) { threadProfile().name.store(name, std::memory_order_relaxed); }
+
+inline uint8_t histogramBucket(const uint64_t duration) noexcept
+{
+    uint8_t bits = 0;
+#if defined(__GNUC__) || defined(__clang__)
+    bits = (duration == 0) ? 0 : static_cast<uint8_t>(64 - __builtin_clzll(duration));
+#else
+    for (uint64_t d = duration; d != 0; d >>= 1) { ++bits; }
+#endif
+    return (bits < histogramBuckets) ? bits : histogramBuckets - 1;
+}
+
+/// Counts its execution against a scope ID from registerScope, and times its own lifetime on one execution in timingStride, starting with
+/// the first. Only timed executions read the clock, so an untimed one costs little more than the count.
+class ScopedTimer
+{
+public:
+    explicit ScopedTimer(const uint16_t scopeId) noexcept
+    {
+        if (scopeId >= scopeCapacity) { return; }
+        ThreadProfile& profile = threadProfile();
+        std::atomic<uint64_t>& count = profile.scopes[scopeId].count;
+        const uint64_t previousCount = count.load(std::memory_order_relaxed);
+        count.store(previousCount + 1, std::memory_order_relaxed);
+        if ((previousCount & (timingStride - 1)) != 0) { return; }
+        _profile = &profile;
+        _scopeId = scopeId;
+        _start = ticks();
+    }
+
+    ~ScopedTimer()
+    {
+        if (_profile == nullptr) { return; }
+        const uint64_t duration = ticks() - _start;
+        ThreadProfile& profile = *_profile;
+
+        ScopeCounters& counters = profile.scopes[_scopeId];
+        counters.timedCount.store(counters.timedCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        counters.totalTicks.store(counters.totalTicks.load(std::memory_order_relaxed) + duration, std::memory_order_relaxed);
+        if (duration < counters.minTicks.load(std::memory_order_relaxed)) { counters.minTicks.store(duration, std::memory_order_relaxed); }
+        if (duration > counters.maxTicks.load(std::memory_order_relaxed)) { counters.maxTicks.store(duration, std::memory_order_relaxed); }
+        auto& bucket = counters.histogram[histogramBucket(duration)];
+        bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+        const uint64_t head = profile.head.load(std::memory_order_relaxed);
+        auto& event = profile.events[head & (traceEventCapacity - 1)];
+        event.start.store(_start, std::memory_order_relaxed);
+        event.durationAndScope.store((duration << 16) | _scopeId, std::memory_order_relaxed);
+        profile.head.store(head + 1, std::memory_order_release);
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    ThreadProfile* _profile = nullptr;  // Null unless this execution is timed
+    uint16_t _scopeId = 0;
+    uint64_t _start = 0;
+};
+
+/// One scope's statistics, summed over all threads. The total is extrapolated from the timed executions to all of them; the other times
+/// describe the timed executions.
+struct ScopeReport
+{
+    ScopeSite site;
+    uint64_t count = 0;
+    uint64_t timedCount = 0;
+    double totalNs = 0;
+    double minNs = 0;
+    double maxNs = 0;
+    std::array<uint64_t, histogramBuckets> histogram{};
+    double nanosecondsPerTick = 1;
+
+    double meanNs() const noexcept { return (count == 0) ? 0 : totalNs / static_cast<double>(count); }
+
+    /// Upper edge of the histogram bucket holding the given fraction of executions, so it overestimates by at most a factor of two.
+    double percentileNs(const double fraction) const noexcept
+    {
+        const double target = fraction * static_cast<double>(timedCount);
+        uint64_t seen = 0;
+        for (uint8_t b = 0; b < histogramBuckets; ++b)
+        {
+            seen += histogram[b];
+            if (static_cast<double>(seen) >= target && seen > 0) { return std::min(maxNs, static_cast<double>(uint64_t{1} << b) * nanosecondsPerTick); }
+        }
+        return maxNs;
+    }
+
+    /// The executions since an earlier snapshot of the same scope. Minimum and maximum stay cumulative.
+    ScopeReport since(const ScopeReport& earlier) const noexcept
+    {
+        ScopeReport interval = *this;
+        interval.count -= earlier.count;
+        interval.timedCount -= earlier.timedCount;
+        interval.totalNs -= earlier.totalNs;
+        for (uint8_t b = 0; b < histogramBuckets; ++b) { interval.histogram[b] -= earlier.histogram[b]; }
+        return interval;
+    }
+};
+
+/// Sums every thread's counters, indexed by scope ID. Never blocks the instrumented threads.
+inline std::vector<ScopeReport> snapshot()
+{
+    const Registry& registry = Registry::instance();
+    const double nsPerTick = registry.nanosecondsPerTick();
+    const uint16_t scopeCount = registry.scopeCount();
+    std::vector<ScopeReport> reports(scopeCount);
+    std::vector<uint64_t> minTicks(scopeCount, std::numeric_limits<uint64_t>::max()), maxTicks(scopeCount, 0), totalTicks(scopeCount, 0);
+    registry.forEachCounterSet([&](const ScopeCounterSet& scopes) {
+        for (uint16_t id = 0; id < scopeCount; ++id)
+        {
+            const ScopeCounters& counters = scopes[id];
+            reports[id].count += counters.count.load(std::memory_order_relaxed);
+            reports[id].timedCount += counters.timedCount.load(std::memory_order_relaxed);
+            totalTicks[id] += counters.totalTicks.load(std::memory_order_relaxed);
+            minTicks[id] = std::min(minTicks[id], counters.minTicks.load(std::memory_order_relaxed));
+            maxTicks[id] = std::max(maxTicks[id], counters.maxTicks.load(std::memory_order_relaxed));
+            for (uint8_t b = 0; b < histogramBuckets; ++b) { reports[id].histogram[b] += counters.histogram[b].load(std::memory_order_relaxed); }
+        }
+    });
+    for (uint16_t id = 0; id < scopeCount; ++id)
+    {
+        ScopeReport& report = reports[id];
+        report.site = registry.site(id);
+        report.nanosecondsPerTick = nsPerTick;
+        const double extrapolation = (report.timedCount == 0) ? 1 : static_cast<double>(report.count) / static_cast<double>(report.timedCount);
+        report.totalNs = static_cast<double>(totalTicks[id]) * nsPerTick * extrapolation;
+        report.minNs = (report.timedCount == 0) ? 0 : static_cast<double>(minTicks[id]) * nsPerTick;
+        report.maxNs = static_cast<double>(maxTicks[id]) * nsPerTick;
+    }
+    return reports;
+}
+
+namespace Detail
+{
+inline const char* fileName(const char* path) noexcept
+{
+    const char* name = path;
+    for (const char* c = path; c != nullptr && *c != '\0'; ++c)
+    {
+        if (*c == '/' || *c == '\\') { name = c + 1; }
+    }
+    return name;
+}
+
+inline void writeJsonString(std::ostream& out, const char* text)
+{
+    out << '"';
+    for (const char* c = text; c != nullptr && *c != '\0'; ++c)
+    {
+        if (*c == '"' || *c == '\\') { out << '\\' << *c; }
+        else if (static_cast<unsigned char>(*c) < 0x20) { out << ' '; }
+        else { out << *c; }
+    }
+    out << '"';
+}
+}  // namespace Detail
+
+/// Prints every scope that has run: its count and total, mean, minimum, median, 99th percentile and maximum time.
+inline void printReport(std::ostream& out)
+{
+    const std::vector<ScopeReport> reports = snapshot();
+    const auto flags = out.flags();
+    out << std::fixed << std::setprecision(3);
+    for (const ScopeReport& report : reports)
+    {
+        if (report.count == 0) { continue; }
+        out << report.site.name << " (" << Detail::fileName(report.site.file) << ":" << report.site.line << ")\n";
+        out << "    Count: " << report.count << "  Timed: " << report.timedCount << "  Total (ms): " << report.totalNs * 1e-6 << "\n";
+        out << "    Time (us)  mean: " << report.meanNs() * 1e-3 << "  min: " << report.minNs * 1e-3 << "  p50: " << report.percentileNs(0.5) * 1e-3
+            << "  p99: " << report.percentileNs(0.99) * 1e-3 << "  max: " << report.maxNs * 1e-3 << "\n";
+    }
+    out.flags(flags);
+}
+
+/// Writes the executions still held in every thread's ring as Chrome trace event JSON, loadable in chrome://tracing or Perfetto.
+inline void writeChromeTrace(std::ostream& out)
+{
+    const Registry& registry = Registry::instance();
+    const double nsPerTick = registry.nanosecondsPerTick();
+    const uint64_t epoch = registry.epochTicks();
+    const uint16_t scopeCount = registry.scopeCount();
+    const auto flags = out.flags();
+    out << std::fixed << std::setprecision(3) << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool first = true;
+    registry.forEachThread([&](const ThreadProfile& profile) {
+        if (const char* name = profile.name.load(std::memory_order_relaxed))
+        {
+            out << (first ? "" : ",") << "\n{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":" << profile.threadIndex << ",\"args\":{\"name\":";
+            Detail::writeJsonString(out, name);
+            out << "}}";
+            first = false;
+        }
+
+        const uint64_t end = profile.head.load(std::memory_order_acquire);
+        const uint64_t begin = (end > traceEventCapacity) ? end - traceEventCapacity : 0;
+        std::vector<std::pair<uint64_t, uint64_t>> events;
+        events.reserve(static_cast<size_t>(end - begin));
+        for (uint64_t i = begin; i < end; ++i)
+        {
+            const auto& event = profile.events[i & (traceEventCapacity - 1)];
+            events.emplace_back(event.start.load(std::memory_order_relaxed), event.durationAndScope.load(std::memory_order_relaxed));
+        }
+        // Entries the thread overwrote while they were being copied are dropped. The fence keeps the copies above from moving past the re-read
+        // of head, and the slot of index head may already be in the middle of being rewritten, so one more entry is dropped.
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const uint64_t overwritten = profile.head.load(std::memory_order_relaxed);
+        const uint64_t valid = (overwritten + 1 > traceEventCapacity) ? overwritten + 1 - traceEventCapacity : 0;
+        for (uint64_t i = std::max(begin, valid); i < end; ++i)
+        {
+            const auto& [start, durationAndScope] = events[static_cast<size_t>(i - begin)];
+            const uint16_t id = static_cast<uint16_t>(durationAndScope & 0xFFFF);
+            if (id >= scopeCount) { continue; }
+            const double startUs = static_cast<double>(start - epoch) * nsPerTick * 1e-3;
+            const double durationUs = static_cast<double>(durationAndScope >> 16) * nsPerTick * 1e-3;
+            out << (first ? "" : ",") << "\n{\"ph\":\"X\",\"cat\":\"vn\",\"name\":";
+            const ScopeSite& site = registry.site(id);
+            Detail::writeJsonString(out, site.name);
+            out << ",\"pid\":1,\"tid\":" << profile.threadIndex << ",\"ts\":" << startUs << ",\"dur\":" << durationUs << ",\"args\":{\"site\":\"";
+            out << Detail::fileName(site.file) << ":" << site.line << "\"}}";
+            first = false;
+        }
+    });
+    out << "\n]}\n";
+    out.flags(flags);
+}
+
+/// Calls onInterval with the statistics of each interval (see ScopeReport::since) from a background thread, until destroyed.
+class PeriodicReporter
+{
+public:
+    PeriodicReporter(const std::chrono::milliseconds interval, std::function<void(const std::vector<ScopeReport>&)> onInterval)
+        : _interval(interval), _onInterval(std::move(onInterval)), _thread(&PeriodicReporter::_run, this)
+    {
+    }
+
+    ~PeriodicReporter()
+    {
+        {
+            LockGuard lock(_mutex);
+            _running = false;
+        }
+        _wake.notify_all();
+        _thread.join();
+    }
+
+    PeriodicReporter(const PeriodicReporter&) = delete;
+    PeriodicReporter& operator=(const PeriodicReporter&) = delete;
+
+private:
+    std::chrono::milliseconds _interval;
+    std::function<void(const std::vector<ScopeReport>&)> _onInterval;
+    Mutex _mutex;
+    std::condition_variable_any _wake;
+    bool _running = true;
+    Thread _thread;
+
+    void _run()
+    {
+        std::vector<ScopeReport> previous;
+        LockGuard lock(_mutex);
+        while (!_wake.wait_for(_mutex, _interval, [this]() { return !_running; }))
+        {
+            std::vector<ScopeReport> current = snapshot();
+            std::vector<ScopeReport> interval = current;
+            for (size_t i = 0; i < previous.size(); ++i) { interval[i] = current[i].since(previous[i]); }
+            _onInterval(interval);
+            previous = std::move(current);
+        }
+    }
+};
+
+}  // namespace Profiler
+}  // namespace VN
+
+#define VN_PROFILER_CONCAT_INNER(a, b) a##b
+#define VN_PROFILER_CONCAT(a, b) VN_PROFILER_CONCAT_INNER(a, b)
+
+#if defined(__COUNTER__)
+#define VN_PROFILER_UNIQUE_ID __COUNTER__
+#else
+#define VN_PROFILER_UNIQUE_ID __LINE__
+#endif
+
+#define VN_PROFILER_TIME_SCOPE_WITH_ID(name, id)                                                                                      \
+    static const uint16_t VN_PROFILER_CONCAT(vnProfilerScopeId_, id) = ::VN::Profiler::registerScope(name, __FILE__, __LINE__); \
+    const ::VN::Profiler::ScopedTimer VN_PROFILER_CONCAT(vnProfilerScopedTimer_, id)(VN_PROFILER_CONCAT(vnProfilerScopeId_, id))
+
+/// Times the rest of the enclosing scope under the given name. The scope ID is assigned once per call site. Every execution costs a count in
+/// the calling thread's own counters; one in VN_PROFILER_TIMING_STRIDE also costs two time stamp counter reads and a few stores. Names are
+/// made unique with __COUNTER__ where available, so several uses may share a line.
+#define VN_PROFILER_TIME_SCOPE(name) VN_PROFILER_TIME_SCOPE_WITH_ID(name, VN_PROFILER_UNIQUE_ID)
+
+#endif  // VN_PROFILER_HPP_
@@ -0,0 +1,222 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.99.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef VN_SHAREDPACKETPOOL_HPP_
+#define VN_SHAREDPACKETPOOL_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+#include "vectornav/Config.hpp"
+#include "vectornav/HAL/Mutex.hpp"
+
+namespace VN
+{
+
+/// A set of packet buffers that are reference counted, so one copy of a packet can be handed to any number of subscribers. A buffer returns
+/// to the pool when its last Ref is released. The pool holds as many buffers as have been reserved; they are allocated in blocks as they are
+/// first needed, and each block stays valid until both the pool and every outstanding Ref into it are gone.
+class SharedPacketPool
+{
+private:
+    struct Storage;
+
+    struct Slot
+    {
+        std::atomic<uint16_t> refCount = 0;
+        uint8_t* data = nullptr;
+        Storage* storage = nullptr;
+    };
+
+    struct Storage
+    {
+        Storage(const uint16_t numBuffers, const uint16_t bufferCapacity, Storage* next)
+            : slots(new Slot[numBuffers]),
+              freeSlots(new Slot*[numBuffers]),
+              data(new uint8_t[static_cast<size_t>(numBuffers) * bufferCapacity]),
+              next(next)
+        {
+            for (uint16_t i = 0; i < numBuffers; ++i)
+            {
+                slots[i].data = data + static_cast<size_t>(i) * bufferCapacity;
+                slots[i].storage = this;
+                freeSlots[i] = &slots[i];
+            }
+            numFree = numBuffers;
+        }
+
+        ~Storage()
+        {
+            delete[] slots;
+            delete[] freeSlots;
+            delete[] data;
+        }
+
+        Slot* take() noexcept
+        {
+            LockGuard lock(mutex);
+            if (numFree == 0) { return nullptr; }
+            return freeSlots[--numFree];
+        }
+
+        void release(Slot* slot) noexcept
+        {
+            {
+                LockGuard lock(mutex);
+                freeSlots[numFree++] = slot;
+            }
+            unuse();
+        }
+
+        void unuse() noexcept
+        {
+            if (users.fetch_sub(1, std::memory_order_acq_rel) == 1) { delete this; }
+        }
+
+        Slot* slots;
+        Slot** freeSlots;
+        uint8_t* data;
+        Storage* next;  // Only used by the owning pool
+        uint16_t numFree = 0;
+        Mutex mutex;
+        std::atomic<uint32_t> users = 1;  // The pool itself plus one per buffer in use
+    };
+
+public:
+    /// Shared, read-only access to one pooled buffer.
+    class Ref
+    {
+    public:
+        Ref() = default;
+        Ref(std::nullptr_t) {}
+        ~Ref() { reset(); }
+
+        Ref(const Ref& other) noexcept : _slot(other._slot)
+        {
+            if (_slot) { _slot->refCount.fetch_add(1, std::memory_order_relaxed); }
+        }
+
+        Ref(Ref&& other) noexcept : _slot(other._slot) { other._slot = nullptr; }
+
+        Ref& operator=(const Ref& other) noexcept
+        {
+            if (this != &other)
+            {
+                if (other._slot) { other._slot->refCount.fetch_add(1, std::memory_order_relaxed); }
+                reset();
+                _slot = other._slot;
+            }
+            return *this;
+        }
+
+        Ref& operator=(Ref&& other) noexcept
+        {
+            if (this != &other)
+            {
+                reset();
+                _slot = other._slot;
+                other._slot = nullptr;
+            }
+            return *this;
+        }
+
+        void reset() noexcept
+        {
+            if (_slot && _slot->refCount.fetch_sub(1, std::memory_order_acq_rel) == 1) { _slot->storage->release(_slot); }
+            _slot = nullptr;
+        }
+
+        uint8_t* data() const noexcept { return _slot->data; }
+
+        operator bool() const noexcept { return _slot != nullptr; }
+
+        uint16_t useCount() const noexcept { return _slot ? _slot->refCount.load(std::memory_order_relaxed) : 0; }
+
+    private:
+        friend class SharedPacketPool;
+        explicit Ref(Slot* slot) noexcept : _slot(slot) {}
+        Slot* _slot = nullptr;
+    };
+
+    /// @param numBuffers Buffers reserved from the start. More can be reserved at any time.
+    /// @param bufferCapacity Bytes in each buffer.
+    SharedPacketPool(const uint16_t numBuffers, const uint16_t bufferCapacity) : _bufferCapacity(bufferCapacity), _numReserved(numBuffers) {}
+
+    ~SharedPacketPool()
+    {
+        for (Storage* storage = _storages; storage != nullptr;)
+        {
+            Storage* next = storage->next;
+            storage->unuse();
+            storage = next;
+        }
+    }
+
+    SharedPacketPool(const SharedPacketPool&) = delete;
+    SharedPacketPool& operator=(const SharedPacketPool&) = delete;
+
+    /// Lets the pool hold numBuffers more buffers. May be called from any thread.
+    void reserve(const uint32_t numBuffers) noexcept { _numReserved.fetch_add(numBuffers, std::memory_order_relaxed); }
+
+    /// Gives back buffers reserved earlier. Buffers already allocated are kept for reuse.
+    void unreserve(const uint32_t numBuffers) noexcept { _numReserved.fetch_sub(numBuffers, std::memory_order_relaxed); }
+
+    /// Returns an empty Ref if every reserved buffer is in use or length is larger than a buffer. Only one thread may acquire from a pool.
+    Ref acquire(const uint16_t length) noexcept
+    {
+        if (length > _bufferCapacity) { return nullptr; }
+        for (Storage* storage = _storages; storage != nullptr; storage = storage->next)
+        {
+            Slot* slot = storage->take();
+            if (slot != nullptr) { return _share(slot); }
+        }
+
+        // Every allocated buffer is in use; allocate the next block if more are reserved
+        const uint32_t numReserved = _numReserved.load(std::memory_order_relaxed);
+        if (_numAllocated >= numReserved) { return nullptr; }
+        const uint16_t numBuffers = static_cast<uint16_t>(std::min<uint32_t>(numReserved - _numAllocated, Config::PacketDispatchers::sharedPacketPoolGrowth));
+        _storages = new Storage(numBuffers, _bufferCapacity, _storages);
+        _numAllocated += numBuffers;
+        return _share(_storages->take());
+    }
+
+    uint16_t bufferCapacity() const noexcept { return _bufferCapacity; }
+
+private:
+    uint16_t _bufferCapacity;
+    std::atomic<uint32_t> _numReserved;
+    uint32_t _numAllocated = 0;
+    Storage* _storages = nullptr;  // Most recently allocated first
+
+    Ref _share(Slot* slot) noexcept
+    {
+        slot->refCount.store(1, std::memory_order_relaxed);
+        slot->storage->users.fetch_add(1, std::memory_order_relaxed);
+        return Ref(slot);
+    }
+};
+
+}  // namespace VN
+
+#endif  // VN_SHAREDPACKETPOOL_HPP_
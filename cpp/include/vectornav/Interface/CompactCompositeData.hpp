@@ -0,0 +1,1649 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.99.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef VN_COMPACTCOMPOSITEDATA_HPP_
+#define VN_COMPACTCOMPOSITEDATA_HPP_
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <type_traits>
+
+#include "vectornav/Config.hpp"
+#include "vectornav/Implementation/BinaryHeader.hpp"
+#include "vectornav/Implementation/SharedPacketPool.hpp"
+#include "vectornav/Interface/CompositeData.hpp"
+
+namespace VN
+{
+/// @brief A compact alternative to CompositeData for binary measurements. Presence is tracked with one bitmask per binary group, the values of
+/// populated fields are packed back to back, and the large GNSS SatInfo and RawMeas fields are held out of line in a SharedPacketPool so that
+/// copies share them. Fields are read as std::optional through the matching CompositeData member, e.g. get<&CompositeData::ImuGroup::accel>(),
+/// or by expanding the whole object with toCompositeData().
+class CompactCompositeData
+{
+public:
+    static constexpr uint16_t valueCapacity = Config::PacketDispatchers::compactCompositeDataValueCapacity;
+    static constexpr uint8_t fieldCapacity = Config::PacketDispatchers::compactCompositeDataFieldCapacity;
+    static constexpr uint16_t largeFieldSize = sizeof(GnssRawMeas);  ///< The buffer capacity a pool passed for large fields must have.
+
+    /// @brief Binary group and type index that a CompositeData member is populated from. Specialized for every enabled member below.
+    template <auto Member>
+    struct FieldId;
+
+    template <uint8_t MeasGroupIndex, uint8_t MeasTypeIndex>
+    struct FieldIndex
+    {
+        static constexpr uint8_t measGroupIndex = MeasGroupIndex;
+        static constexpr uint8_t measTypeIndex = MeasTypeIndex;
+    };
+
+    /// @brief Constructs an empty object without a large-field pool, so parsing a packet with GnssSatInfo or GnssRawMeas into it sets truncated().
+    CompactCompositeData() = default;
+
+    /// @brief Constructor that initializes CompactCompositeData with binary message header information.
+    /// @param binaryHeader The binary header that describes the source message format and fields.
+    /// @param largeFieldPool Pool holding GnssSatInfo and GnssRawMeas fields, with buffers of at least largeFieldSize. Without one those fields are
+    /// not stored.
+    CompactCompositeData(BinaryHeader binaryHeader, SharedPacketPool* largeFieldPool = nullptr) noexcept
+        : _binaryHeader(binaryHeader), _largeFieldPool(largeFieldPool)
+    {
+    }
+
+    CompactCompositeData(const CompactCompositeData& other) noexcept { _copyFrom(other); }
+
+    CompactCompositeData& operator=(const CompactCompositeData& other) noexcept
+    {
+        if (this != &other) { _copyFrom(other); }
+        return *this;
+    }
+
+    /// @brief Checks whether the passed header matches the header of the message which populated this object.
+    bool matchesMessage(const BinaryHeader& binaryHeader) const noexcept
+    {
+        if (_binaryHeader.has_value()) { return binaryHeader == _binaryHeader; }
+        else { return false; }
+    }
+
+    /// @brief Checks whether the passed register matches the header of the message which populated this object.
+    bool matchesMessage(const Registers::System::BinaryOutput& binaryOutputRegister) const noexcept
+    {
+        return matchesMessage(binaryOutputRegister.toBinaryHeader());
+    }
+
+    std::optional<BinaryHeader> header() const noexcept { return _binaryHeader; }
+
+    time_point timestamp;
+
+    /// @brief Returns the bitmask of populated type indices within a binary group.
+    uint32_t presence(const uint8_t measGroupIndex) const noexcept
+    {
+        const uint8_t slot = _groupSlot(measGroupIndex);
+        return (slot < numGroups) ? _presence[slot] : 0;
+    }
+
+    bool has(const uint8_t measGroupIndex, const uint8_t measTypeIndex) const noexcept
+    {
+        return (measTypeIndex < 32) && (presence(measGroupIndex) & (uint32_t(1) << measTypeIndex));
+    }
+
+    template <auto Member>
+    bool has() const noexcept
+    {
+        return has(FieldId<Member>::measGroupIndex, FieldId<Member>::measTypeIndex);
+    }
+
+    /// @brief Reads one field through the CompositeData member it corresponds to, e.g. get<&CompositeData::AttitudeGroup::ypr>().
+    template <auto Member>
+    auto get() const noexcept
+    {
+        using T = typename MemberTraits<decltype(Member)>::Value;
+        std::optional<T> value;
+        const uint8_t* data = _find(FieldId<Member>::measGroupIndex, FieldId<Member>::measTypeIndex);
+        if (data != nullptr)
+        {
+            value.emplace();
+            std::memcpy(&value.value(), data, sizeof(T));
+        }
+        return value;
+    }
+
+    /// @brief Expands into a CompositeData with every populated field set.
+    CompositeData toCompositeData() const noexcept;
+
+    /// @brief Clears every field and releases the large fields back to their pool. The pool is kept.
+    void reset() noexcept;
+
+    void reset(const BinaryHeader& binaryHeader) noexcept
+    {
+        reset();
+        _binaryHeader = binaryHeader;
+    }
+
+    /// @brief Number of bytes of packed field values in use.
+    uint16_t valueSize() const noexcept { return _valueSize; }
+
+    /// @brief Whether an enabled field was dropped because the value, field or large field capacity was exhausted.
+    bool truncated() const noexcept { return _truncated; }
+
+    template <class Extractor>
+    Errored copyFromBuffer(Extractor& extractor, const uint8_t measGroupIndex, const uint8_t measTypeIndex);
+
+private:
+    template <class M>
+    struct MemberTraits;
+
+    template <class Group, class T>
+    struct MemberTraits<std::optional<T> Group::*>
+    {
+        using GroupType = Group;
+        using Value = T;
+    };
+
+    struct Entry
+    {
+        uint8_t measGroupIndex;
+        uint8_t measTypeIndex;
+        uint16_t offset;  // Into _values, or into _largeFields for large fields
+    };
+
+    static constexpr uint8_t valueChunkSize = 16;
+    static constexpr uint8_t numGroups = 7;  // Time, Imu, Gnss, Attitude, Ins, Gnss2, Gnss3
+    static constexpr uint8_t numLargeFields =
+        static_cast<bool>(GNSS_GROUP_ENABLE & GNSS_GNSS1SATINFO_BIT) + static_cast<bool>(GNSS_GROUP_ENABLE & GNSS_GNSS1RAWMEAS_BIT) +
+        static_cast<bool>(GNSS2_GROUP_ENABLE & GNSS2_GNSS2SATINFO_BIT) + static_cast<bool>(GNSS2_GROUP_ENABLE & GNSS2_GNSS2RAWMEAS_BIT) +
+        static_cast<bool>(GNSS3_GROUP_ENABLE & GNSS3_GNSS3SATINFO_BIT) + static_cast<bool>(GNSS3_GROUP_ENABLE & GNSS3_GNSS3RAWMEAS_BIT);
+
+    static constexpr uint8_t _groupSlot(const uint8_t measGroupIndex) noexcept
+    {
+        // Group 0 (common) is never stored, its fields are filed under the groups they duplicate.
+        if (measGroupIndex >= 1 && measGroupIndex <= 6) { return static_cast<uint8_t>(measGroupIndex - 1); }
+        return (measGroupIndex == 12) ? 6 : numGroups;
+    }
+
+    template <class T>
+    static constexpr bool _isLarge() noexcept
+    {
+        return std::is_same_v<T, GnssSatInfo> || std::is_same_v<T, GnssRawMeas>;
+    }
+
+#if (TIME_GROUP_ENABLE)
+    static CompositeData::TimeGroup& _groupOf(CompositeData& compositeData, CompositeData::TimeGroup*) noexcept { return compositeData.time; }
+#endif
+#if (IMU_GROUP_ENABLE)
+    static CompositeData::ImuGroup& _groupOf(CompositeData& compositeData, CompositeData::ImuGroup*) noexcept { return compositeData.imu; }
+#endif
+#if (GNSS_GROUP_ENABLE)
+    static CompositeData::GnssGroup& _groupOf(CompositeData& compositeData, CompositeData::GnssGroup*) noexcept { return compositeData.gnss; }
+#endif
+#if (ATTITUDE_GROUP_ENABLE)
+    static CompositeData::AttitudeGroup& _groupOf(CompositeData& compositeData, CompositeData::AttitudeGroup*) noexcept
+    {
+        return compositeData.attitude;
+    }
+#endif
+#if (INS_GROUP_ENABLE)
+    static CompositeData::InsGroup& _groupOf(CompositeData& compositeData, CompositeData::InsGroup*) noexcept { return compositeData.ins; }
+#endif
+#if (GNSS2_GROUP_ENABLE)
+    static CompositeData::Gnss2Group& _groupOf(CompositeData& compositeData, CompositeData::Gnss2Group*) noexcept { return compositeData.gnss2; }
+#endif
+#if (GNSS3_GROUP_ENABLE)
+    static CompositeData::Gnss3Group& _groupOf(CompositeData& compositeData, CompositeData::Gnss3Group*) noexcept { return compositeData.gnss3; }
+#endif
+
+    template <class Visitor>
+    static Errored _visitField(const uint8_t measGroupIndex, const uint8_t measTypeIndex, Visitor&& visitor);
+
+    template <class Extractor>
+    Errored _copyField(Extractor& extractor, const uint8_t measGroupIndex, const uint8_t measTypeIndex);
+
+    template <auto Member, class Extractor>
+    Errored _copyField(Extractor& extractor)
+    {
+        return _copyField(extractor, FieldId<Member>::measGroupIndex, FieldId<Member>::measTypeIndex);
+    }
+
+    static bool _isLargeField(const uint8_t measGroupIndex, const uint8_t measTypeIndex) noexcept
+    {
+        return (measGroupIndex == 3 || measGroupIndex == 6 || measGroupIndex == 12) && (measTypeIndex == 14 || measTypeIndex == 16);
+    }
+
+    const Entry* _findEntry(const uint8_t measGroupIndex, const uint8_t measTypeIndex) const noexcept
+    {
+        if (!has(measGroupIndex, measTypeIndex)) { return nullptr; }
+        for (uint8_t i = 0; i < _numEntries; ++i)
+        {
+            if (_entries[i].measGroupIndex == measGroupIndex && _entries[i].measTypeIndex == measTypeIndex) { return &_entries[i]; }
+        }
+        return nullptr;
+    }
+
+    const uint8_t* _find(const uint8_t measGroupIndex, const uint8_t measTypeIndex) const noexcept;
+
+    void _copyFrom(const CompactCompositeData& other) noexcept;
+
+    std::array<uint32_t, numGroups> _presence{};
+    uint16_t _valueSize = 0;
+    uint8_t _numEntries = 0;
+    uint8_t _numLargeFields = 0;
+    bool _truncated = false;
+    std::array<Entry, fieldCapacity> _entries{};
+    std::array<SharedPacketPool::Ref, numLargeFields> _largeFields;
+    std::optional<BinaryHeader> _binaryHeader = std::nullopt;
+    SharedPacketPool* _largeFieldPool = nullptr;
+    // Only the first _valueSize bytes are meaningful. Rounded up so that copies can move whole chunks.
+    std::array<uint8_t, (valueCapacity + valueChunkSize - 1) / valueChunkSize * valueChunkSize> _values;
+};  // class CompactCompositeData
+
+#if (TIME_GROUP_ENABLE & TIME_TIMESTARTUP_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::TimeGroup::timeStartup> : CompactCompositeData::FieldIndex<1, 0> {};
+#endif
+#if (TIME_GROUP_ENABLE & TIME_TIMEGPS_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::TimeGroup::timeGps> : CompactCompositeData::FieldIndex<1, 1> {};
+#endif
+#if (TIME_GROUP_ENABLE & TIME_TIMEGPSTOW_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::TimeGroup::timeGpsTow> : CompactCompositeData::FieldIndex<1, 2> {};
+#endif
+#if (TIME_GROUP_ENABLE & TIME_TIMEGPSWEEK_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::TimeGroup::timeGpsWeek> : CompactCompositeData::FieldIndex<1, 3> {};
+#endif
+#if (TIME_GROUP_ENABLE & TIME_TIMESYNCIN_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::TimeGroup::timeSyncIn> : CompactCompositeData::FieldIndex<1, 4> {};
+#endif
+#if (TIME_GROUP_ENABLE & TIME_TIMEGPSPPS_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::TimeGroup::timeGpsPps> : CompactCompositeData::FieldIndex<1, 5> {};
+#endif
+#if (TIME_GROUP_ENABLE & TIME_TIMEUTC_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::TimeGroup::timeUtc> : CompactCompositeData::FieldIndex<1, 6> {};
+#endif
+#if (TIME_GROUP_ENABLE & TIME_SYNCINCNT_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::TimeGroup::syncInCnt> : CompactCompositeData::FieldIndex<1, 7> {};
+#endif
+#if (TIME_GROUP_ENABLE & TIME_SYNCOUTCNT_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::TimeGroup::syncOutCnt> : CompactCompositeData::FieldIndex<1, 8> {};
+#endif
+#if (TIME_GROUP_ENABLE & TIME_TIMESTATUS_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::TimeGroup::timeStatus> : CompactCompositeData::FieldIndex<1, 9> {};
+#endif
+#if (IMU_GROUP_ENABLE & IMU_IMUSTATUS_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::ImuGroup::imuStatus> : CompactCompositeData::FieldIndex<2, 0> {};
+#endif
+#if (IMU_GROUP_ENABLE & IMU_UNCOMPMAG_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::ImuGroup::uncompMag> : CompactCompositeData::FieldIndex<2, 1> {};
+#endif
+#if (IMU_GROUP_ENABLE & IMU_UNCOMPACCEL_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::ImuGroup::uncompAccel> : CompactCompositeData::FieldIndex<2, 2> {};
+#endif
+#if (IMU_GROUP_ENABLE & IMU_UNCOMPGYRO_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::ImuGroup::uncompGyro> : CompactCompositeData::FieldIndex<2, 3> {};
+#endif
+#if (IMU_GROUP_ENABLE & IMU_TEMPERATURE_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::ImuGroup::temperature> : CompactCompositeData::FieldIndex<2, 4> {};
+#endif
+#if (IMU_GROUP_ENABLE & IMU_PRESSURE_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::ImuGroup::pressure> : CompactCompositeData::FieldIndex<2, 5> {};
+#endif
+#if (IMU_GROUP_ENABLE & IMU_DELTATHETA_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::ImuGroup::deltaTheta> : CompactCompositeData::FieldIndex<2, 6> {};
+#endif
+#if (IMU_GROUP_ENABLE & IMU_DELTAVEL_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::ImuGroup::deltaVel> : CompactCompositeData::FieldIndex<2, 7> {};
+#endif
+#if (IMU_GROUP_ENABLE & IMU_MAG_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::ImuGroup::mag> : CompactCompositeData::FieldIndex<2, 8> {};
+#endif
+#if (IMU_GROUP_ENABLE & IMU_ACCEL_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::ImuGroup::accel> : CompactCompositeData::FieldIndex<2, 9> {};
+#endif
+#if (IMU_GROUP_ENABLE & IMU_ANGULARRATE_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::ImuGroup::angularRate> : CompactCompositeData::FieldIndex<2, 10> {};
+#endif
+#if (IMU_GROUP_ENABLE & IMU_SENSSAT_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::ImuGroup::sensSat> : CompactCompositeData::FieldIndex<2, 11> {};
+#endif
+#if (GNSS_GROUP_ENABLE & GNSS_GNSS1TIMEUTC_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::GnssGroup::gnss1TimeUtc> : CompactCompositeData::FieldIndex<3, 0> {};
+#endif
+#if (GNSS_GROUP_ENABLE & GNSS_GPS1TOW_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::GnssGroup::gps1Tow> : CompactCompositeData::FieldIndex<3, 1> {};
+#endif
+#if (GNSS_GROUP_ENABLE & GNSS_GPS1WEEK_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::GnssGroup::gps1Week> : CompactCompositeData::FieldIndex<3, 2> {};
+#endif
+#if (GNSS_GROUP_ENABLE & GNSS_GNSS1NUMSATS_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::GnssGroup::gnss1NumSats> : CompactCompositeData::FieldIndex<3, 3> {};
+#endif
+#if (GNSS_GROUP_ENABLE & GNSS_GNSS1FIX_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::GnssGroup::gnss1Fix> : CompactCompositeData::FieldIndex<3, 4> {};
+#endif
+#if (GNSS_GROUP_ENABLE & GNSS_GNSS1POSLLA_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::GnssGroup::gnss1PosLla> : CompactCompositeData::FieldIndex<3, 5> {};
+#endif
+#if (GNSS_GROUP_ENABLE & GNSS_GNSS1POSECEF_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::GnssGroup::gnss1PosEcef> : CompactCompositeData::FieldIndex<3, 6> {};
+#endif
+#if (GNSS_GROUP_ENABLE & GNSS_GNSS1VELNED_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::GnssGroup::gnss1VelNed> : CompactCompositeData::FieldIndex<3, 7> {};
+#endif
+#if (GNSS_GROUP_ENABLE & GNSS_GNSS1VELECEF_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::GnssGroup::gnss1VelEcef> : CompactCompositeData::FieldIndex<3, 8> {};
+#endif
+#if (GNSS_GROUP_ENABLE & GNSS_GNSS1POSUNCERTAINTY_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::GnssGroup::gnss1PosUncertainty> : CompactCompositeData::FieldIndex<3, 9> {};
+#endif
+#if (GNSS_GROUP_ENABLE & GNSS_GNSS1VELUNCERTAINTY_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::GnssGroup::gnss1VelUncertainty> : CompactCompositeData::FieldIndex<3, 10> {};
+#endif
+#if (GNSS_GROUP_ENABLE & GNSS_GNSS1TIMEUNCERTAINTY_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::GnssGroup::gnss1TimeUncertainty> : CompactCompositeData::FieldIndex<3, 11> {};
+#endif
+#if (GNSS_GROUP_ENABLE & GNSS_GNSS1TIMEINFO_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::GnssGroup::gnss1TimeInfo> : CompactCompositeData::FieldIndex<3, 12> {};
+#endif
+#if (GNSS_GROUP_ENABLE & GNSS_GNSS1DOP_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::GnssGroup::gnss1Dop> : CompactCompositeData::FieldIndex<3, 13> {};
+#endif
+#if (GNSS_GROUP_ENABLE & GNSS_GNSS1SATINFO_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::GnssGroup::gnss1SatInfo> : CompactCompositeData::FieldIndex<3, 14> {};
+#endif
+#if (GNSS_GROUP_ENABLE & GNSS_GNSS1RAWMEAS_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::GnssGroup::gnss1RawMeas> : CompactCompositeData::FieldIndex<3, 16> {};
+#endif
+#if (GNSS_GROUP_ENABLE & GNSS_GNSS1STATUS_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::GnssGroup::gnss1Status> : CompactCompositeData::FieldIndex<3, 17> {};
+#endif
+#if (GNSS_GROUP_ENABLE & GNSS_GNSS1ALTMSL_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::GnssGroup::gnss1AltMsl> : CompactCompositeData::FieldIndex<3, 18> {};
+#endif
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_YPR_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::AttitudeGroup::ypr> : CompactCompositeData::FieldIndex<4, 1> {};
+#endif
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_QUATERNION_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::AttitudeGroup::quaternion> : CompactCompositeData::FieldIndex<4, 2> {};
+#endif
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_DCM_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::AttitudeGroup::dcm> : CompactCompositeData::FieldIndex<4, 3> {};
+#endif
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_MAGNED_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::AttitudeGroup::magNed> : CompactCompositeData::FieldIndex<4, 4> {};
+#endif
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_ACCELNED_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::AttitudeGroup::accelNed> : CompactCompositeData::FieldIndex<4, 5> {};
+#endif
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_LINBODYACC_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::AttitudeGroup::linBodyAcc> : CompactCompositeData::FieldIndex<4, 6> {};
+#endif
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_LINACCELNED_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::AttitudeGroup::linAccelNed> : CompactCompositeData::FieldIndex<4, 7> {};
+#endif
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_YPRU_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::AttitudeGroup::yprU> : CompactCompositeData::FieldIndex<4, 8> {};
+#endif
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_HEAVE_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::AttitudeGroup::heave> : CompactCompositeData::FieldIndex<4, 12> {};
+#endif
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_ATTU_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::AttitudeGroup::attU> : CompactCompositeData::FieldIndex<4, 13> {};
+#endif
+#if (INS_GROUP_ENABLE & INS_INSSTATUS_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::InsGroup::insStatus> : CompactCompositeData::FieldIndex<5, 0> {};
+#endif
+#if (INS_GROUP_ENABLE & INS_POSLLA_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::InsGroup::posLla> : CompactCompositeData::FieldIndex<5, 1> {};
+#endif
+#if (INS_GROUP_ENABLE & INS_POSECEF_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::InsGroup::posEcef> : CompactCompositeData::FieldIndex<5, 2> {};
+#endif
+#if (INS_GROUP_ENABLE & INS_VELBODY_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::InsGroup::velBody> : CompactCompositeData::FieldIndex<5, 3> {};
+#endif
+#if (INS_GROUP_ENABLE & INS_VELNED_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::InsGroup::velNed> : CompactCompositeData::FieldIndex<5, 4> {};
+#endif
+#if (INS_GROUP_ENABLE & INS_VELECEF_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::InsGroup::velEcef> : CompactCompositeData::FieldIndex<5, 5> {};
+#endif
+#if (INS_GROUP_ENABLE & INS_MAGECEF_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::InsGroup::magEcef> : CompactCompositeData::FieldIndex<5, 6> {};
+#endif
+#if (INS_GROUP_ENABLE & INS_ACCELECEF_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::InsGroup::accelEcef> : CompactCompositeData::FieldIndex<5, 7> {};
+#endif
+#if (INS_GROUP_ENABLE & INS_LINACCELECEF_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::InsGroup::linAccelEcef> : CompactCompositeData::FieldIndex<5, 8> {};
+#endif
+#if (INS_GROUP_ENABLE & INS_POSU_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::InsGroup::posU> : CompactCompositeData::FieldIndex<5, 9> {};
+#endif
+#if (INS_GROUP_ENABLE & INS_VELU_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::InsGroup::velU> : CompactCompositeData::FieldIndex<5, 10> {};
+#endif
+#if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2TIMEUTC_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::Gnss2Group::gnss2TimeUtc> : CompactCompositeData::FieldIndex<6, 0> {};
+#endif
+#if (GNSS2_GROUP_ENABLE & GNSS2_GPS2TOW_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::Gnss2Group::gps2Tow> : CompactCompositeData::FieldIndex<6, 1> {};
+#endif
+#if (GNSS2_GROUP_ENABLE & GNSS2_GPS2WEEK_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::Gnss2Group::gps2Week> : CompactCompositeData::FieldIndex<6, 2> {};
+#endif
+#if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2NUMSATS_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::Gnss2Group::gnss2NumSats> : CompactCompositeData::FieldIndex<6, 3> {};
+#endif
+#if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2FIX_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::Gnss2Group::gnss2Fix> : CompactCompositeData::FieldIndex<6, 4> {};
+#endif
+#if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2POSLLA_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::Gnss2Group::gnss2PosLla> : CompactCompositeData::FieldIndex<6, 5> {};
+#endif
+#if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2POSECEF_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::Gnss2Group::gnss2PosEcef> : CompactCompositeData::FieldIndex<6, 6> {};
+#endif
+#if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2VELNED_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::Gnss2Group::gnss2VelNed> : CompactCompositeData::FieldIndex<6, 7> {};
+#endif
+#if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2VELECEF_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::Gnss2Group::gnss2VelEcef> : CompactCompositeData::FieldIndex<6, 8> {};
+#endif
+#if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2POSUNCERTAINTY_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::Gnss2Group::gnss2PosUncertainty> : CompactCompositeData::FieldIndex<6, 9> {};
+#endif
+#if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2VELUNCERTAINTY_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::Gnss2Group::gnss2VelUncertainty> : CompactCompositeData::FieldIndex<6, 10> {};
+#endif
+#if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2TIMEUNCERTAINTY_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::Gnss2Group::gnss2TimeUncertainty> : CompactCompositeData::FieldIndex<6, 11> {};
+#endif
+#if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2TIMEINFO_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::Gnss2Group::gnss2TimeInfo> : CompactCompositeData::FieldIndex<6, 12> {};
+#endif
+#if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2DOP_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::Gnss2Group::gnss2Dop> : CompactCompositeData::FieldIndex<6, 13> {};
+#endif
+#if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2SATINFO_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::Gnss2Group::gnss2SatInfo> : CompactCompositeData::FieldIndex<6, 14> {};
+#endif
+#if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2RAWMEAS_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::Gnss2Group::gnss2RawMeas> : CompactCompositeData::FieldIndex<6, 16> {};
+#endif
+#if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2STATUS_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::Gnss2Group::gnss2Status> : CompactCompositeData::FieldIndex<6, 17> {};
+#endif
+#if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2ALTMSL_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::Gnss2Group::gnss2AltMsl> : CompactCompositeData::FieldIndex<6, 18> {};
+#endif
+#if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3TIMEUTC_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::Gnss3Group::gnss3TimeUtc> : CompactCompositeData::FieldIndex<12, 0> {};
+#endif
+#if (GNSS3_GROUP_ENABLE & GNSS3_GPS3TOW_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::Gnss3Group::gps3Tow> : CompactCompositeData::FieldIndex<12, 1> {};
+#endif
+#if (GNSS3_GROUP_ENABLE & GNSS3_GPS3WEEK_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::Gnss3Group::gps3Week> : CompactCompositeData::FieldIndex<12, 2> {};
+#endif
+#if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3NUMSATS_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::Gnss3Group::gnss3NumSats> : CompactCompositeData::FieldIndex<12, 3> {};
+#endif
+#if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3FIX_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::Gnss3Group::gnss3Fix> : CompactCompositeData::FieldIndex<12, 4> {};
+#endif
+#if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3POSLLA_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::Gnss3Group::gnss3PosLla> : CompactCompositeData::FieldIndex<12, 5> {};
+#endif
+#if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3POSECEF_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::Gnss3Group::gnss3PosEcef> : CompactCompositeData::FieldIndex<12, 6> {};
+#endif
+#if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3VELNED_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::Gnss3Group::gnss3VelNed> : CompactCompositeData::FieldIndex<12, 7> {};
+#endif
+#if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3VELECEF_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::Gnss3Group::gnss3VelEcef> : CompactCompositeData::FieldIndex<12, 8> {};
+#endif
+#if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3POSUNCERTAINTY_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::Gnss3Group::gnss3PosUncertainty> : CompactCompositeData::FieldIndex<12, 9> {};
+#endif
+#if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3VELUNCERTAINTY_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::Gnss3Group::gnss3VelUncertainty> : CompactCompositeData::FieldIndex<12, 10> {};
+#endif
+#if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3TIMEUNCERTAINTY_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::Gnss3Group::gnss3TimeUncertainty> : CompactCompositeData::FieldIndex<12, 11> {};
+#endif
+#if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3TIMEINFO_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::Gnss3Group::gnss3TimeInfo> : CompactCompositeData::FieldIndex<12, 12> {};
+#endif
+#if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3DOP_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::Gnss3Group::gnss3Dop> : CompactCompositeData::FieldIndex<12, 13> {};
+#endif
+#if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3SATINFO_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::Gnss3Group::gnss3SatInfo> : CompactCompositeData::FieldIndex<12, 14> {};
+#endif
+#if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3RAWMEAS_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::Gnss3Group::gnss3RawMeas> : CompactCompositeData::FieldIndex<12, 16> {};
+#endif
+#if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3STATUS_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::Gnss3Group::gnss3Status> : CompactCompositeData::FieldIndex<12, 17> {};
+#endif
+#if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3ALTMSL_BIT)
+template <>
+struct CompactCompositeData::FieldId<&CompositeData::Gnss3Group::gnss3AltMsl> : CompactCompositeData::FieldIndex<12, 18> {};
+#endif
+
+inline const uint8_t* CompactCompositeData::_find(const uint8_t measGroupIndex, const uint8_t measTypeIndex) const noexcept
+{
+    const Entry* entry = _findEntry(measGroupIndex, measTypeIndex);
+    if (entry == nullptr) { return nullptr; }
+    if (_isLargeField(measGroupIndex, measTypeIndex)) { return _largeFields[entry->offset].data(); }
+    return _values.data() + entry->offset;
+}
+
+inline void CompactCompositeData::_copyFrom(const CompactCompositeData& other) noexcept
+{
+    timestamp = other.timestamp;
+    _presence = other._presence;
+    _valueSize = other._valueSize;
+    _numEntries = other._numEntries;
+    _numLargeFields = other._numLargeFields;
+    _truncated = other._truncated;
+    _entries = other._entries;
+    for (uint8_t i = 0; i < numLargeFields; ++i) { _largeFields[i] = other._largeFields[i]; }
+    _binaryHeader = other._binaryHeader;
+    _largeFieldPool = other._largeFieldPool;
+    // Fixed size chunks compile to a few vector moves, where a variable length memcpy of a few dozen bytes is a library call.
+    for (uint16_t i = 0; i < _valueSize; i += valueChunkSize) { std::memcpy(_values.data() + i, other._values.data() + i, valueChunkSize); }
+}
+
+inline void CompactCompositeData::reset() noexcept
+{
+    timestamp = time_point{};
+    _presence.fill(0);
+    _valueSize = 0;
+    _numEntries = 0;
+    for (uint8_t i = 0; i < _numLargeFields; ++i) { _largeFields[i].reset(); }
+    _numLargeFields = 0;
+    _truncated = false;
+    _binaryHeader = std::nullopt;
+}
+
+inline CompositeData CompactCompositeData::toCompositeData() const noexcept
+{
+    CompositeData compositeData = _binaryHeader.has_value() ? CompositeData(_binaryHeader.value()) : CompositeData();
+    compositeData.timestamp = timestamp;
+    for (uint8_t i = 0; i < _numEntries; ++i)
+    {
+        const Entry& entry = _entries[i];
+        _visitField(entry.measGroupIndex, entry.measTypeIndex,
+                    [&](auto member) noexcept
+                    {
+                        using Traits = MemberTraits<decltype(member)>;
+                        typename Traits::Value value;
+                        std::memcpy(&value, _find(entry.measGroupIndex, entry.measTypeIndex), sizeof(value));
+                        (_groupOf(compositeData, static_cast<typename Traits::GroupType*>(nullptr)).*member) = value;
+                        return false;
+                    });
+    }
+    return compositeData;
+}
+
+template <class Extractor>
+Errored CompactCompositeData::_copyField(Extractor& extractor, const uint8_t measGroupIndex, const uint8_t measTypeIndex)
+{
+    return _visitField(
+        measGroupIndex, measTypeIndex,
+        [&](auto member) noexcept
+        {
+            using T = typename MemberTraits<decltype(member)>::Value;
+            static_assert(std::is_trivially_copyable_v<T>, "Compact fields are stored as raw bytes.");
+
+            // Check for room before extracting, so that a field which cannot be stored leaves the extractor where it was.
+            const Entry* existing = _findEntry(measGroupIndex, measTypeIndex);
+            bool hasRoom = (existing != nullptr || _numEntries < fieldCapacity);
+            SharedPacketPool::Ref largeField;
+            if constexpr (_isLarge<T>())
+            {
+                // Copies may share the current buffer, so a repeated large field always gets a new one.
+                if (hasRoom && _largeFieldPool != nullptr) { largeField = _largeFieldPool->acquire(sizeof(T)); }
+                hasRoom = hasRoom && largeField;
+            }
+            else { hasRoom = hasRoom && (existing != nullptr || _valueSize + sizeof(T) <= valueCapacity); }
+            if (!hasRoom)
+            {
+                _truncated = true;
+                return true;
+            }
+
+            std::optional<T> value;
+            if (extractor.extract(value)) { return true; }
+
+            uint16_t offset = 0;
+            if constexpr (_isLarge<T>())
+            {
+                offset = (existing != nullptr) ? existing->offset : _numLargeFields++;
+                std::memcpy(largeField.data(), &value.value(), sizeof(T));
+                _largeFields[offset] = std::move(largeField);
+            }
+            else
+            {
+                offset = (existing != nullptr) ? existing->offset : _valueSize;
+                std::memcpy(_values.data() + offset, &value.value(), sizeof(T));
+                if (existing == nullptr) { _valueSize += static_cast<uint16_t>(sizeof(T)); }
+            }
+
+            if (existing == nullptr)
+            {
+                _entries[_numEntries++] = Entry{measGroupIndex, measTypeIndex, offset};
+                _presence[_groupSlot(measGroupIndex)] |= uint32_t(1) << measTypeIndex;
+            }
+            return false;
+        });
+}
+
+template <class Extractor>
+Errored CompactCompositeData::copyFromBuffer(Extractor& extractor, const uint8_t measGroupIndex, const uint8_t measTypeIndex)
+{
+    if (measGroupIndex != 0) { return _copyField(extractor, measGroupIndex, measTypeIndex); }
+
+    // Common group fields are stored under the group and type they duplicate, as CompositeData does.
+    switch (1 << measTypeIndex)
+    {
+#if (TIME_GROUP_ENABLE & TIME_TIMESTARTUP_BIT)
+        case COMMON_TIMESTARTUP_BIT:
+        {
+            return _copyField<&CompositeData::TimeGroup::timeStartup>(extractor);
+        }
+#endif
+
+#if (TIME_GROUP_ENABLE & TIME_TIMEGPS_BIT)
+        case COMMON_TIMEGPS_BIT:
+        {
+            return _copyField<&CompositeData::TimeGroup::timeGps>(extractor);
+        }
+#endif
+
+#if (TIME_GROUP_ENABLE & TIME_TIMESYNCIN_BIT)
+        case COMMON_TIMESYNCIN_BIT:
+        {
+            return _copyField<&CompositeData::TimeGroup::timeSyncIn>(extractor);
+        }
+#endif
+
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_YPR_BIT)
+        case COMMON_YPR_BIT:
+        {
+            return _copyField<&CompositeData::AttitudeGroup::ypr>(extractor);
+        }
+#endif
+
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_QUATERNION_BIT)
+        case COMMON_QUATERNION_BIT:
+        {
+            return _copyField<&CompositeData::AttitudeGroup::quaternion>(extractor);
+        }
+#endif
+
+#if (IMU_GROUP_ENABLE & IMU_ANGULARRATE_BIT)
+        case COMMON_ANGULARRATE_BIT:
+        {
+            return _copyField<&CompositeData::ImuGroup::angularRate>(extractor);
+        }
+#endif
+
+#if (INS_GROUP_ENABLE & INS_POSLLA_BIT)
+        case COMMON_POSLLA_BIT:
+        {
+            return _copyField<&CompositeData::InsGroup::posLla>(extractor);
+        }
+#endif
+
+#if (INS_GROUP_ENABLE & INS_VELNED_BIT)
+        case COMMON_VELNED_BIT:
+        {
+            return _copyField<&CompositeData::InsGroup::velNed>(extractor);
+        }
+#endif
+
+#if (IMU_GROUP_ENABLE & IMU_ACCEL_BIT)
+        case COMMON_ACCEL_BIT:
+        {
+            return _copyField<&CompositeData::ImuGroup::accel>(extractor);
+        }
+#endif
+
+#if ((IMU_GROUP_ENABLE & IMU_UNCOMPACCEL_BIT) && (IMU_GROUP_ENABLE & IMU_UNCOMPGYRO_BIT))
+        case COMMON_IMU_BIT:
+        {
+            return _copyField<&CompositeData::ImuGroup::uncompAccel>(extractor) || _copyField<&CompositeData::ImuGroup::uncompGyro>(extractor);
+        }
+#endif
+
+#if ((IMU_GROUP_ENABLE & IMU_MAG_BIT) && (IMU_GROUP_ENABLE & IMU_PRESSURE_BIT) && (IMU_GROUP_ENABLE & IMU_TEMPERATURE_BIT))
+        case COMMON_MAGPRES_BIT:
+        {
+            return _copyField<&CompositeData::ImuGroup::mag>(extractor) || _copyField<&CompositeData::ImuGroup::temperature>(extractor) ||
+                   _copyField<&CompositeData::ImuGroup::pressure>(extractor);
+        }
+#endif
+
+#if ((IMU_GROUP_ENABLE & IMU_DELTATHETA_BIT) && (IMU_GROUP_ENABLE & IMU_DELTAVEL_BIT))
+        case COMMON_DELTAS_BIT:
+        {
+            return _copyField<&CompositeData::ImuGroup::deltaTheta>(extractor) || _copyField<&CompositeData::ImuGroup::deltaVel>(extractor);
+        }
+#endif
+
+#if (INS_GROUP_ENABLE & INS_INSSTATUS_BIT)
+        case COMMON_INSSTATUS_BIT:
+        {
+            return _copyField<&CompositeData::InsGroup::insStatus>(extractor);
+        }
+#endif
+
+#if (TIME_GROUP_ENABLE & TIME_SYNCINCNT_BIT)
+        case COMMON_SYNCINCNT_BIT:
+        {
+            return _copyField<&CompositeData::TimeGroup::syncInCnt>(extractor);
+        }
+#endif
+
+#if (TIME_GROUP_ENABLE & TIME_TIMEGPSPPS_BIT)
+        case COMMON_TIMEGPSPPS_BIT:
+        {
+            return _copyField<&CompositeData::TimeGroup::timeGpsPps>(extractor);
+        }
+#endif
+
+        default:
+        {
+            return true;
+        }
+    }  // switch (1 << measTypeIndex)
+}  // CompactCompositeData::copyFromBuffer
+
+template <class Visitor>
+Errored CompactCompositeData::_visitField(const uint8_t measGroupIndex, const uint8_t measTypeIndex, Visitor&& visitor)
+{
+    switch (measGroupIndex)
+    {
+        case 1:
+        {
+            switch (1 << measTypeIndex)
+            {
+#if (TIME_GROUP_ENABLE & TIME_TIMESTARTUP_BIT)
+                case TIME_TIMESTARTUP_BIT:
+                {
+                    return visitor(&CompositeData::TimeGroup::timeStartup);
+                }
+#endif
+
+#if (TIME_GROUP_ENABLE & TIME_TIMEGPS_BIT)
+                case TIME_TIMEGPS_BIT:
+                {
+                    return visitor(&CompositeData::TimeGroup::timeGps);
+                }
+#endif
+
+#if (TIME_GROUP_ENABLE & TIME_TIMEGPSTOW_BIT)
+                case TIME_TIMEGPSTOW_BIT:
+                {
+                    return visitor(&CompositeData::TimeGroup::timeGpsTow);
+                }
+#endif
+
+#if (TIME_GROUP_ENABLE & TIME_TIMEGPSWEEK_BIT)
+                case TIME_TIMEGPSWEEK_BIT:
+                {
+                    return visitor(&CompositeData::TimeGroup::timeGpsWeek);
+                }
+#endif
+
+#if (TIME_GROUP_ENABLE & TIME_TIMESYNCIN_BIT)
+                case TIME_TIMESYNCIN_BIT:
+                {
+                    return visitor(&CompositeData::TimeGroup::timeSyncIn);
+                }
+#endif
+
+#if (TIME_GROUP_ENABLE & TIME_TIMEGPSPPS_BIT)
+                case TIME_TIMEGPSPPS_BIT:
+                {
+                    return visitor(&CompositeData::TimeGroup::timeGpsPps);
+                }
+#endif
+
+#if (TIME_GROUP_ENABLE & TIME_TIMEUTC_BIT)
+                case TIME_TIMEUTC_BIT:
+                {
+                    return visitor(&CompositeData::TimeGroup::timeUtc);
+                }
+#endif
+
+#if (TIME_GROUP_ENABLE & TIME_SYNCINCNT_BIT)
+                case TIME_SYNCINCNT_BIT:
+                {
+                    return visitor(&CompositeData::TimeGroup::syncInCnt);
+                }
+#endif
+
+#if (TIME_GROUP_ENABLE & TIME_SYNCOUTCNT_BIT)
+                case TIME_SYNCOUTCNT_BIT:
+                {
+                    return visitor(&CompositeData::TimeGroup::syncOutCnt);
+                }
+#endif
+
+#if (TIME_GROUP_ENABLE & TIME_TIMESTATUS_BIT)
+                case TIME_TIMESTATUS_BIT:
+                {
+                    return visitor(&CompositeData::TimeGroup::timeStatus);
+                }
+#endif
+
+                default:
+                {
+                    return true;
+                }
+            }  // switch (1 << measTypeIndex)
+        }  // case 1:
+
+        case 2:
+        {
+            switch (1 << measTypeIndex)
+            {
+#if (IMU_GROUP_ENABLE & IMU_IMUSTATUS_BIT)
+                case IMU_IMUSTATUS_BIT:
+                {
+                    return visitor(&CompositeData::ImuGroup::imuStatus);
+                }
+#endif
+
+#if (IMU_GROUP_ENABLE & IMU_UNCOMPMAG_BIT)
+                case IMU_UNCOMPMAG_BIT:
+                {
+                    return visitor(&CompositeData::ImuGroup::uncompMag);
+                }
+#endif
+
+#if (IMU_GROUP_ENABLE & IMU_UNCOMPACCEL_BIT)
+                case IMU_UNCOMPACCEL_BIT:
+                {
+                    return visitor(&CompositeData::ImuGroup::uncompAccel);
+                }
+#endif
+
+#if (IMU_GROUP_ENABLE & IMU_UNCOMPGYRO_BIT)
+                case IMU_UNCOMPGYRO_BIT:
+                {
+                    return visitor(&CompositeData::ImuGroup::uncompGyro);
+                }
+#endif
+
+#if (IMU_GROUP_ENABLE & IMU_TEMPERATURE_BIT)
+                case IMU_TEMPERATURE_BIT:
+                {
+                    return visitor(&CompositeData::ImuGroup::temperature);
+                }
+#endif
+
+#if (IMU_GROUP_ENABLE & IMU_PRESSURE_BIT)
+                case IMU_PRESSURE_BIT:
+                {
+                    return visitor(&CompositeData::ImuGroup::pressure);
+                }
+#endif
+
+#if (IMU_GROUP_ENABLE & IMU_DELTATHETA_BIT)
+                case IMU_DELTATHETA_BIT:
+                {
+                    return visitor(&CompositeData::ImuGroup::deltaTheta);
+                }
+#endif
+
+#if (IMU_GROUP_ENABLE & IMU_DELTAVEL_BIT)
+                case IMU_DELTAVEL_BIT:
+                {
+                    return visitor(&CompositeData::ImuGroup::deltaVel);
+                }
+#endif
+
+#if (IMU_GROUP_ENABLE & IMU_MAG_BIT)
+                case IMU_MAG_BIT:
+                {
+                    return visitor(&CompositeData::ImuGroup::mag);
+                }
+#endif
+
+#if (IMU_GROUP_ENABLE & IMU_ACCEL_BIT)
+                case IMU_ACCEL_BIT:
+                {
+                    return visitor(&CompositeData::ImuGroup::accel);
+                }
+#endif
+
+#if (IMU_GROUP_ENABLE & IMU_ANGULARRATE_BIT)
+                case IMU_ANGULARRATE_BIT:
+                {
+                    return visitor(&CompositeData::ImuGroup::angularRate);
+                }
+#endif
+
+#if (IMU_GROUP_ENABLE & IMU_SENSSAT_BIT)
+                case IMU_SENSSAT_BIT:
+                {
+                    return visitor(&CompositeData::ImuGroup::sensSat);
+                }
+#endif
+
+                default:
+                {
+                    return true;
+                }
+            }  // switch (1 << measTypeIndex)
+        }  // case 2:
+
+        case 3:
+        {
+            switch (1 << measTypeIndex)
+            {
+#if (GNSS_GROUP_ENABLE & GNSS_GNSS1TIMEUTC_BIT)
+                case GNSS_GNSS1TIMEUTC_BIT:
+                {
+                    return visitor(&CompositeData::GnssGroup::gnss1TimeUtc);
+                }
+#endif
+
+#if (GNSS_GROUP_ENABLE & GNSS_GPS1TOW_BIT)
+                case GNSS_GPS1TOW_BIT:
+                {
+                    return visitor(&CompositeData::GnssGroup::gps1Tow);
+                }
+#endif
+
+#if (GNSS_GROUP_ENABLE & GNSS_GPS1WEEK_BIT)
+                case GNSS_GPS1WEEK_BIT:
+                {
+                    return visitor(&CompositeData::GnssGroup::gps1Week);
+                }
+#endif
+
+#if (GNSS_GROUP_ENABLE & GNSS_GNSS1NUMSATS_BIT)
+                case GNSS_GNSS1NUMSATS_BIT:
+                {
+                    return visitor(&CompositeData::GnssGroup::gnss1NumSats);
+                }
+#endif
+
+#if (GNSS_GROUP_ENABLE & GNSS_GNSS1FIX_BIT)
+                case GNSS_GNSS1FIX_BIT:
+                {
+                    return visitor(&CompositeData::GnssGroup::gnss1Fix);
+                }
+#endif
+
+#if (GNSS_GROUP_ENABLE & GNSS_GNSS1POSLLA_BIT)
+                case GNSS_GNSS1POSLLA_BIT:
+                {
+                    return visitor(&CompositeData::GnssGroup::gnss1PosLla);
+                }
+#endif
+
+#if (GNSS_GROUP_ENABLE & GNSS_GNSS1POSECEF_BIT)
+                case GNSS_GNSS1POSECEF_BIT:
+                {
+                    return visitor(&CompositeData::GnssGroup::gnss1PosEcef);
+                }
+#endif
+
+#if (GNSS_GROUP_ENABLE & GNSS_GNSS1VELNED_BIT)
+                case GNSS_GNSS1VELNED_BIT:
+                {
+                    return visitor(&CompositeData::GnssGroup::gnss1VelNed);
+                }
+#endif
+
+#if (GNSS_GROUP_ENABLE & GNSS_GNSS1VELECEF_BIT)
+                case GNSS_GNSS1VELECEF_BIT:
+                {
+                    return visitor(&CompositeData::GnssGroup::gnss1VelEcef);
+                }
+#endif
+
+#if (GNSS_GROUP_ENABLE & GNSS_GNSS1POSUNCERTAINTY_BIT)
+                case GNSS_GNSS1POSUNCERTAINTY_BIT:
+                {
+                    return visitor(&CompositeData::GnssGroup::gnss1PosUncertainty);
+                }
+#endif
+
+#if (GNSS_GROUP_ENABLE & GNSS_GNSS1VELUNCERTAINTY_BIT)
+                case GNSS_GNSS1VELUNCERTAINTY_BIT:
+                {
+                    return visitor(&CompositeData::GnssGroup::gnss1VelUncertainty);
+                }
+#endif
+
+#if (GNSS_GROUP_ENABLE & GNSS_GNSS1TIMEUNCERTAINTY_BIT)
+                case GNSS_GNSS1TIMEUNCERTAINTY_BIT:
+                {
+                    return visitor(&CompositeData::GnssGroup::gnss1TimeUncertainty);
+                }
+#endif
+
+#if (GNSS_GROUP_ENABLE & GNSS_GNSS1TIMEINFO_BIT)
+                case GNSS_GNSS1TIMEINFO_BIT:
+                {
+                    return visitor(&CompositeData::GnssGroup::gnss1TimeInfo);
+                }
+#endif
+
+#if (GNSS_GROUP_ENABLE & GNSS_GNSS1DOP_BIT)
+                case GNSS_GNSS1DOP_BIT:
+                {
+                    return visitor(&CompositeData::GnssGroup::gnss1Dop);
+                }
+#endif
+
+#if (GNSS_GROUP_ENABLE & GNSS_GNSS1SATINFO_BIT)
+                case GNSS_GNSS1SATINFO_BIT:
+                {
+                    return visitor(&CompositeData::GnssGroup::gnss1SatInfo);
+                }
+#endif
+
+#if (GNSS_GROUP_ENABLE & GNSS_GNSS1RAWMEAS_BIT)
+                case GNSS_GNSS1RAWMEAS_BIT:
+                {
+                    return visitor(&CompositeData::GnssGroup::gnss1RawMeas);
+                }
+#endif
+
+#if (GNSS_GROUP_ENABLE & GNSS_GNSS1STATUS_BIT)
+                case GNSS_GNSS1STATUS_BIT:
+                {
+                    return visitor(&CompositeData::GnssGroup::gnss1Status);
+                }
+#endif
+
+#if (GNSS_GROUP_ENABLE & GNSS_GNSS1ALTMSL_BIT)
+                case GNSS_GNSS1ALTMSL_BIT:
+                {
+                    return visitor(&CompositeData::GnssGroup::gnss1AltMsl);
+                }
+#endif
+
+                default:
+                {
+                    return true;
+                }
+            }  // switch (1 << measTypeIndex)
+        }  // case 3:
+
+        case 4:
+        {
+            switch (1 << measTypeIndex)
+            {
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_YPR_BIT)
+                case ATTITUDE_YPR_BIT:
+                {
+                    return visitor(&CompositeData::AttitudeGroup::ypr);
+                }
+#endif
+
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_QUATERNION_BIT)
+                case ATTITUDE_QUATERNION_BIT:
+                {
+                    return visitor(&CompositeData::AttitudeGroup::quaternion);
+                }
+#endif
+
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_DCM_BIT)
+                case ATTITUDE_DCM_BIT:
+                {
+                    return visitor(&CompositeData::AttitudeGroup::dcm);
+                }
+#endif
+
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_MAGNED_BIT)
+                case ATTITUDE_MAGNED_BIT:
+                {
+                    return visitor(&CompositeData::AttitudeGroup::magNed);
+                }
+#endif
+
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_ACCELNED_BIT)
+                case ATTITUDE_ACCELNED_BIT:
+                {
+                    return visitor(&CompositeData::AttitudeGroup::accelNed);
+                }
+#endif
+
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_LINBODYACC_BIT)
+                case ATTITUDE_LINBODYACC_BIT:
+                {
+                    return visitor(&CompositeData::AttitudeGroup::linBodyAcc);
+                }
+#endif
+
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_LINACCELNED_BIT)
+                case ATTITUDE_LINACCELNED_BIT:
+                {
+                    return visitor(&CompositeData::AttitudeGroup::linAccelNed);
+                }
+#endif
+
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_YPRU_BIT)
+                case ATTITUDE_YPRU_BIT:
+                {
+                    return visitor(&CompositeData::AttitudeGroup::yprU);
+                }
+#endif
+
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_HEAVE_BIT)
+                case ATTITUDE_HEAVE_BIT:
+                {
+                    return visitor(&CompositeData::AttitudeGroup::heave);
+                }
+#endif
+
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_ATTU_BIT)
+                case ATTITUDE_ATTU_BIT:
+                {
+                    return visitor(&CompositeData::AttitudeGroup::attU);
+                }
+#endif
+
+                default:
+                {
+                    return true;
+                }
+            }  // switch (1 << measTypeIndex)
+        }  // case 4:
+
+        case 5:
+        {
+            switch (1 << measTypeIndex)
+            {
+#if (INS_GROUP_ENABLE & INS_INSSTATUS_BIT)
+                case INS_INSSTATUS_BIT:
+                {
+                    return visitor(&CompositeData::InsGroup::insStatus);
+                }
+#endif
+
+#if (INS_GROUP_ENABLE & INS_POSLLA_BIT)
+                case INS_POSLLA_BIT:
+                {
+                    return visitor(&CompositeData::InsGroup::posLla);
+                }
+#endif
+
+#if (INS_GROUP_ENABLE & INS_POSECEF_BIT)
+                case INS_POSECEF_BIT:
+                {
+                    return visitor(&CompositeData::InsGroup::posEcef);
+                }
+#endif
+
+#if (INS_GROUP_ENABLE & INS_VELBODY_BIT)
+                case INS_VELBODY_BIT:
+                {
+                    return visitor(&CompositeData::InsGroup::velBody);
+                }
+#endif
+
+#if (INS_GROUP_ENABLE & INS_VELNED_BIT)
+                case INS_VELNED_BIT:
+                {
+                    return visitor(&CompositeData::InsGroup::velNed);
+                }
+#endif
+
+#if (INS_GROUP_ENABLE & INS_VELECEF_BIT)
+                case INS_VELECEF_BIT:
+                {
+                    return visitor(&CompositeData::InsGroup::velEcef);
+                }
+#endif
+
+#if (INS_GROUP_ENABLE & INS_MAGECEF_BIT)
+                case INS_MAGECEF_BIT:
+                {
+                    return visitor(&CompositeData::InsGroup::magEcef);
+                }
+#endif
+
+#if (INS_GROUP_ENABLE & INS_ACCELECEF_BIT)
+                case INS_ACCELECEF_BIT:
+                {
+                    return visitor(&CompositeData::InsGroup::accelEcef);
+                }
+#endif
+
+#if (INS_GROUP_ENABLE & INS_LINACCELECEF_BIT)
+                case INS_LINACCELECEF_BIT:
+                {
+                    return visitor(&CompositeData::InsGroup::linAccelEcef);
+                }
+#endif
+
+#if (INS_GROUP_ENABLE & INS_POSU_BIT)
+                case INS_POSU_BIT:
+                {
+                    return visitor(&CompositeData::InsGroup::posU);
+                }
+#endif
+
+#if (INS_GROUP_ENABLE & INS_VELU_BIT)
+                case INS_VELU_BIT:
+                {
+                    return visitor(&CompositeData::InsGroup::velU);
+                }
+#endif
+
+                default:
+                {
+                    return true;
+                }
+            }  // switch (1 << measTypeIndex)
+        }  // case 5:
+
+        case 6:
+        {
+            switch (1 << measTypeIndex)
+            {
+#if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2TIMEUTC_BIT)
+                case GNSS2_GNSS2TIMEUTC_BIT:
+                {
+                    return visitor(&CompositeData::Gnss2Group::gnss2TimeUtc);
+                }
+#endif
+
+#if (GNSS2_GROUP_ENABLE & GNSS2_GPS2TOW_BIT)
+                case GNSS2_GPS2TOW_BIT:
+                {
+                    return visitor(&CompositeData::Gnss2Group::gps2Tow);
+                }
+#endif
+
+#if (GNSS2_GROUP_ENABLE & GNSS2_GPS2WEEK_BIT)
+                case GNSS2_GPS2WEEK_BIT:
+                {
+                    return visitor(&CompositeData::Gnss2Group::gps2Week);
+                }
+#endif
+
+#if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2NUMSATS_BIT)
+                case GNSS2_GNSS2NUMSATS_BIT:
+                {
+                    return visitor(&CompositeData::Gnss2Group::gnss2NumSats);
+                }
+#endif
+
+#if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2FIX_BIT)
+                case GNSS2_GNSS2FIX_BIT:
+                {
+                    return visitor(&CompositeData::Gnss2Group::gnss2Fix);
+                }
+#endif
+
+#if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2POSLLA_BIT)
+                case GNSS2_GNSS2POSLLA_BIT:
+                {
+                    return visitor(&CompositeData::Gnss2Group::gnss2PosLla);
+                }
+#endif
+
+#if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2POSECEF_BIT)
+                case GNSS2_GNSS2POSECEF_BIT:
+                {
+                    return visitor(&CompositeData::Gnss2Group::gnss2PosEcef);
+                }
+#endif
+
+#if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2VELNED_BIT)
+                case GNSS2_GNSS2VELNED_BIT:
+                {
+                    return visitor(&CompositeData::Gnss2Group::gnss2VelNed);
+                }
+#endif
+
+#if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2VELECEF_BIT)
+                case GNSS2_GNSS2VELECEF_BIT:
+                {
+                    return visitor(&CompositeData::Gnss2Group::gnss2VelEcef);
+                }
+#endif
+
+#if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2POSUNCERTAINTY_BIT)
+                case GNSS2_GNSS2POSUNCERTAINTY_BIT:
+                {
+                    return visitor(&CompositeData::Gnss2Group::gnss2PosUncertainty);
+                }
+#endif
+
+#if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2VELUNCERTAINTY_BIT)
+                case GNSS2_GNSS2VELUNCERTAINTY_BIT:
+                {
+                    return visitor(&CompositeData::Gnss2Group::gnss2VelUncertainty);
+                }
+#endif
+
+#if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2TIMEUNCERTAINTY_BIT)
+                case GNSS2_GNSS2TIMEUNCERTAINTY_BIT:
+                {
+                    return visitor(&CompositeData::Gnss2Group::gnss2TimeUncertainty);
+                }
+#endif
+
+#if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2TIMEINFO_BIT)
+                case GNSS2_GNSS2TIMEINFO_BIT:
+                {
+                    return visitor(&CompositeData::Gnss2Group::gnss2TimeInfo);
+                }
+#endif
+
+#if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2DOP_BIT)
+                case GNSS2_GNSS2DOP_BIT:
+                {
+                    return visitor(&CompositeData::Gnss2Group::gnss2Dop);
+                }
+#endif
+
+#if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2SATINFO_BIT)
+                case GNSS2_GNSS2SATINFO_BIT:
+                {
+                    return visitor(&CompositeData::Gnss2Group::gnss2SatInfo);
+                }
+#endif
+
+#if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2RAWMEAS_BIT)
+                case GNSS2_GNSS2RAWMEAS_BIT:
+                {
+                    return visitor(&CompositeData::Gnss2Group::gnss2RawMeas);
+                }
+#endif
+
+#if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2STATUS_BIT)
+                case GNSS2_GNSS2STATUS_BIT:
+                {
+                    return visitor(&CompositeData::Gnss2Group::gnss2Status);
+                }
+#endif
+
+#if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2ALTMSL_BIT)
+                case GNSS2_GNSS2ALTMSL_BIT:
+                {
+                    return visitor(&CompositeData::Gnss2Group::gnss2AltMsl);
+                }
+#endif
+
+                default:
+                {
+                    return true;
+                }
+            }  // switch (1 << measTypeIndex)
+        }  // case 6:
+
+        case 12:
+        {
+            switch (1 << measTypeIndex)
+            {
+#if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3TIMEUTC_BIT)
+                case GNSS3_GNSS3TIMEUTC_BIT:
+                {
+                    return visitor(&CompositeData::Gnss3Group::gnss3TimeUtc);
+                }
+#endif
+
+#if (GNSS3_GROUP_ENABLE & GNSS3_GPS3TOW_BIT)
+                case GNSS3_GPS3TOW_BIT:
+                {
+                    return visitor(&CompositeData::Gnss3Group::gps3Tow);
+                }
+#endif
+
+#if (GNSS3_GROUP_ENABLE & GNSS3_GPS3WEEK_BIT)
+                case GNSS3_GPS3WEEK_BIT:
+                {
+                    return visitor(&CompositeData::Gnss3Group::gps3Week);
+                }
+#endif
+
+#if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3NUMSATS_BIT)
+                case GNSS3_GNSS3NUMSATS_BIT:
+                {
+                    return visitor(&CompositeData::Gnss3Group::gnss3NumSats);
+                }
+#endif
+
+#if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3FIX_BIT)
+                case GNSS3_GNSS3FIX_BIT:
+                {
+                    return visitor(&CompositeData::Gnss3Group::gnss3Fix);
+                }
+#endif
+
+#if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3POSLLA_BIT)
+                case GNSS3_GNSS3POSLLA_BIT:
+                {
+                    return visitor(&CompositeData::Gnss3Group::gnss3PosLla);
+                }
+#endif
+
+#if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3POSECEF_BIT)
+                case GNSS3_GNSS3POSECEF_BIT:
+                {
+                    return visitor(&CompositeData::Gnss3Group::gnss3PosEcef);
+                }
+#endif
+
+#if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3VELNED_BIT)
+                case GNSS3_GNSS3VELNED_BIT:
+                {
+                    return visitor(&CompositeData::Gnss3Group::gnss3VelNed);
+                }
+#endif
+
+#if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3VELECEF_BIT)
+                case GNSS3_GNSS3VELECEF_BIT:
+                {
+                    return visitor(&CompositeData::Gnss3Group::gnss3VelEcef);
+                }
+#endif
+
+#if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3POSUNCERTAINTY_BIT)
+                case GNSS3_GNSS3POSUNCERTAINTY_BIT:
+                {
+                    return visitor(&CompositeData::Gnss3Group::gnss3PosUncertainty);
+                }
+#endif
+
+#if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3VELUNCERTAINTY_BIT)
+                case GNSS3_GNSS3VELUNCERTAINTY_BIT:
+                {
+                    return visitor(&CompositeData::Gnss3Group::gnss3VelUncertainty);
+                }
+#endif
+
+#if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3TIMEUNCERTAINTY_BIT)
+                case GNSS3_GNSS3TIMEUNCERTAINTY_BIT:
+                {
+                    return visitor(&CompositeData::Gnss3Group::gnss3TimeUncertainty);
+                }
+#endif
+
+#if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3TIMEINFO_BIT)
+                case GNSS3_GNSS3TIMEINFO_BIT:
+                {
+                    return visitor(&CompositeData::Gnss3Group::gnss3TimeInfo);
+                }
+#endif
+
+#if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3DOP_BIT)
+                case GNSS3_GNSS3DOP_BIT:
+                {
+                    return visitor(&CompositeData::Gnss3Group::gnss3Dop);
+                }
+#endif
+
+#if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3SATINFO_BIT)
+                case GNSS3_GNSS3SATINFO_BIT:
+                {
+                    return visitor(&CompositeData::Gnss3Group::gnss3SatInfo);
+                }
+#endif
+
+#if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3RAWMEAS_BIT)
+                case GNSS3_GNSS3RAWMEAS_BIT:
+                {
+                    return visitor(&CompositeData::Gnss3Group::gnss3RawMeas);
+                }
+#endif
+
+#if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3STATUS_BIT)
+                case GNSS3_GNSS3STATUS_BIT:
+                {
+                    return visitor(&CompositeData::Gnss3Group::gnss3Status);
+                }
+#endif
+
+#if (GNSS3_GROUP_ENABLE & GNSS3_GNSS3ALTMSL_BIT)
+                case GNSS3_GNSS3ALTMSL_BIT:
+                {
+                    return visitor(&CompositeData::Gnss3Group::gnss3AltMsl);
+                }
+#endif
+
+                default:
+                {
+                    return true;
+                }
+            }  // switch (1 << measTypeIndex)
+        }  // case 12:
+
+        default:
+        {
+            return true;
+        }
+    }  // switch (measGroupIndex)
+}  // CompactCompositeData::_visitField
+
+}  // namespace VN
+
+#endif  // VN_COMPACTCOMPOSITEDATA_HPP_
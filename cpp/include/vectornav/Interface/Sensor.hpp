@@ -157,6 +157,16 @@ public:
     /// @param block If true, wait a maximum of getMeasurementTimeoutLength for a new measurement.
     CompositeDataQueueReturn getMostRecentMeasurement(const bool block = true) noexcept;
 
+    using MeasurementReduction = MeasurementReducer::Mode;
+
+    /// @brief Sets how binary measurements are reduced before they are pushed to the MeasurementQueue, so a consumer slower than the output rate
+    /// neither overflows the queue nor pays to parse measurements it skips.
+    /// @param mode Decimate keeps every factor-th measurement, Average combines each factor measurements into one (integrating delta theta and
+    /// delta velocity, timestamped by the last), and LatestOnly keeps at most factor unconsumed measurements. PassThrough disables reduction.
+    /// @param factor The reduction factor, applied to each binary output separately. Only the first
+    /// Config::PacketDispatchers::measurementReducerWindowCapacity distinct outputs are reduced; any others pass through unreduced.
+    void setMeasurementReduction(const MeasurementReduction mode, const uint16_t factor) noexcept;
+
     // ------------------------------------------
     /*! \name Sending Commands */
     // ------------------------------------------
@@ -249,8 +259,9 @@ public:
     /// @param queueToSubscribe The queue to be populated with measurement messages.
     /// @param binaryOutputMeasurementFilter The filter to determine which measurement messages are populated in the respective queue.
     /// @param filterType How to interpret the respective binaryOutputMeasurementFilter.  Defaults to ExactMatch if not used.
+    /// @param decimation Only every decimation-th matching message is populated in the queue.  Defaults to every message.
     Error subscribeToMessage(PacketQueue_Interface* queueToSubscribe, const BinaryOutputMeasurements& binaryOutputMeasurementFilter,
-                             const FaSubscriberFilterType filterType = FaSubscriberFilterType::ExactMatch) noexcept;
+                             const FaSubscriberFilterType filterType = FaSubscriberFilterType::ExactMatch, const uint16_t decimation = 1) noexcept;
 
     /// @brief Subscribes a queue to be populated (write only) with every matching measurement message as received. Multiple can be simultaneously registered.
     /// @param queueToSubscribe The queue to be populated with measurement messages.
@@ -357,6 +368,7 @@ private:
     // -------------------------------
     MeasQueueMode _measQueueMode;
     bool _parseToCD;
+    SharedPacketPool _sharedPacketPool{0, Config::PacketFinders::packetMaxLength};  // Grows with the dispatchers' subscriber queues
     FaPacketDispatcher _faPacketDispatcher{&_measurementQueue, Config::PacketDispatchers::cdEnabledMeasTypes, _parseToCD};
     AsciiPacketDispatcher _asciiPacketDispatcher{&_measurementQueue, Config::PacketDispatchers::cdEnabledMeasTypes, &_commandProcessor, _parseToCD};
     FbPacketDispatcher _fbPacketDispatcher{&_faPacketDispatcher, Config::PacketFinders::fbBufferCapacity};
@@ -383,6 +395,9 @@ Sensor::Sensor(std::array<uint8_t, MainByteBufferCapacity>& mainBuffer, std::arr
     _packetSynchronizer.addDispatcher(&_faPacketDispatcher);
     _packetSynchronizer.addDispatcher(&_asciiPacketDispatcher);
     _packetSynchronizer.addDispatcher(&_fbPacketDispatcher);
+    _faPacketDispatcher.setSharedPacketPool(&_sharedPacketPool);
+    _asciiPacketDispatcher.setSharedPacketPool(&_sharedPacketPool);
+    _fbPacketDispatcher.setSharedPacketPool(&_sharedPacketPool);
     if (_parseToCD) { _measurementQueue.setPutMode(static_cast<MeasurementQueue::PutMode>(_measQueueMode)); }
 }
 }  // namespace VN
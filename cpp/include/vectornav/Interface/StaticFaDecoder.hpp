@@ -0,0 +1,275 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.99.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef VN_STATICFADECODER_HPP_
+#define VN_STATICFADECODER_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "vectornav/Implementation/BinaryHeader.hpp"
+#include "vectornav/Implementation/BinaryMeasurementDefinitions.hpp"
+#include "vectornav/Implementation/CoreUtils.hpp"
+#include "vectornav/Interface/CompactCompositeData.hpp"
+#include "vectornav/Interface/CompositeData.hpp"
+#include "vectornav/TemplateLibrary/ByteBuffer.hpp"
+
+namespace VN
+{
+/// @brief The CompositeData members one binary output is decoded into, in payload order.
+template <auto... Members>
+struct FaMemberList
+{
+};
+
+/// @brief Declares one output of the binary group its CompositeData member belongs to, e.g. FaField<&CompositeData::ImuGroup::accel>.
+template <auto Member>
+struct FaField
+{
+    static constexpr uint8_t measGroupIndex = CompactCompositeData::FieldId<Member>::measGroupIndex;
+    static constexpr uint8_t measTypeIndex = CompactCompositeData::FieldId<Member>::measTypeIndex;
+    using Members = FaMemberList<Member>;
+};
+
+/// @brief Declares one output of the common group by its type index, with the CompositeData members it fills in payload order, e.g.
+/// FaCommonField<3, &CompositeData::AttitudeGroup::ypr>, or for the compound Imu output
+/// FaCommonField<9, &CompositeData::ImuGroup::uncompAccel, &CompositeData::ImuGroup::uncompGyro>.
+template <uint8_t CommonTypeIndex, auto... Outputs>
+struct FaCommonField
+{
+    static constexpr uint8_t measGroupIndex = 0;
+    static constexpr uint8_t measTypeIndex = CommonTypeIndex;
+    using Members = FaMemberList<Outputs...>;
+};
+
+/// @brief Decodes FA packets of one binary output configuration that is fixed at compile time. Fields are declared in the order they appear on the
+/// wire, that is by group and then by type index. The header, packet length and the offset of every value are computed at compile time, so decoding
+/// is a header compare, the CRC, and one load per value into a plain Output struct. A packet of any other configuration is rejected, so callers can
+/// fall back to FaPacketProtocol::parsePacket.
+template <class... Fields>
+class StaticFaDecoder
+{
+private:
+    template <class... Lists>
+    struct Concat;
+
+    template <auto... Members>
+    struct Concat<FaMemberList<Members...>>
+    {
+        using type = FaMemberList<Members...>;
+    };
+
+    template <auto... First, auto... Second, class... Rest>
+    struct Concat<FaMemberList<First...>, FaMemberList<Second...>, Rest...>
+    {
+        using type = typename Concat<FaMemberList<First..., Second...>, Rest...>::type;
+    };
+
+    template <class M>
+    struct MemberValue;
+
+    template <class Group, class T>
+    struct MemberValue<std::optional<T> Group::*>
+    {
+        using type = T;
+    };
+
+    template <class List>
+    struct ListTraits;
+
+    template <auto... Members>
+    struct ListTraits<FaMemberList<Members...>>
+    {
+        using Values = std::tuple<typename MemberValue<decltype(Members)>::type...>;
+        static constexpr size_t size = (sizeof(typename MemberValue<decltype(Members)>::type) + ... + 0);
+
+        template <auto Target>
+        static constexpr size_t indexOf() noexcept
+        {
+            size_t index = 0;
+            size_t found = sizeof...(Members);
+            const auto check = [&](auto member) noexcept
+            {
+                if constexpr (std::is_same_v<decltype(member), decltype(Target)>)
+                {
+                    if (found == sizeof...(Members) && member == Target) { found = index; }
+                }
+                ++index;
+            };
+            (check(Members), ...);
+            return found;
+        }
+    };
+
+    using AllMembers = typename Concat<typename Fields::Members...>::type;
+    using Traits = ListTraits<AllMembers>;
+
+    static constexpr size_t numFields = sizeof...(Fields);
+    static constexpr std::array<uint8_t, numFields> _groups{Fields::measGroupIndex...};
+    static constexpr std::array<uint8_t, numFields> _types{Fields::measTypeIndex...};
+
+    static constexpr bool _isValidConfiguration() noexcept
+    {
+        for (size_t i = 0; i < numFields; ++i)
+        {
+            if (_groups[i] % 8 == 7 || _types[i] % 16 == 15) { return false; }  // Extension bits
+            if (i > 0 && (_groups[i] < _groups[i - 1] || (_groups[i] == _groups[i - 1] && _types[i] <= _types[i - 1]))) { return false; }
+        }
+        return true;
+    }
+
+    static constexpr size_t _numGroupBytes() noexcept { return _groups[numFields - 1] / 8 + 1u; }
+
+    static constexpr size_t _numTypeWords() noexcept
+    {
+        size_t numWords = 0;
+        for (size_t i = 0; i < numFields; ++i)
+        {
+            const bool lastOfGroup = (i + 1 == numFields) || (_groups[i + 1] != _groups[i]);
+            if (lastOfGroup) { numWords += _types[i] / 16 + 1u; }  // Types are sorted, so the last one sets the number of extension words
+        }
+        return numWords;
+    }
+
+    template <class Field>
+    static constexpr bool _isValidFieldSize() noexcept
+    {
+        constexpr auto wireSize = getStaticBinaryTypeSize(Field::measGroupIndex, Field::measTypeIndex);
+        return wireSize.has_value() && wireSize.value() == ListTraits<typename Field::Members>::size;
+    }
+
+    static_assert(numFields > 0, "At least one field must be declared.");
+    static_assert(_isValidConfiguration(), "Fields must be declared in wire order (by group, then type index), each at most once.");
+    static_assert((_isValidFieldSize<Fields>() && ...), "Every field must have a fixed size on the wire matching the members it fills.");
+
+public:
+    static constexpr uint16_t headerLength = static_cast<uint16_t>(_numGroupBytes() + 2 * _numTypeWords());
+    static constexpr uint16_t payloadLength = static_cast<uint16_t>(Traits::size);
+    static constexpr uint16_t packetLength = 1 + headerLength + payloadLength + 2;  // Sync byte, header, payload, CRC
+
+    /// @brief The header bytes, following the sync byte, of every packet this decoder accepts.
+    static constexpr std::array<uint8_t, headerLength> headerBytes = []() constexpr
+    {
+        std::array<uint8_t, headerLength> bytes{};
+        const size_t numGroupBytes = _numGroupBytes();
+        for (size_t i = 0; i < numFields; ++i) { bytes[_groups[i] / 8] |= static_cast<uint8_t>(1u << (_groups[i] % 8)); }
+        for (size_t i = 0; i + 1 < numGroupBytes; ++i) { bytes[i] |= 0x80; }
+
+        size_t byteIndex = numGroupBytes;
+        uint64_t typeBits = 0;
+        for (size_t i = 0; i < numFields; ++i)
+        {
+            typeBits |= uint64_t(1) << _types[i];
+            if ((i + 1 < numFields) && (_groups[i + 1] == _groups[i])) { continue; }
+            const size_t numWords = _types[i] / 16 + 1u;
+            for (size_t word = 0; word < numWords; ++word)
+            {
+                const uint16_t extension = (word + 1 < numWords) ? 0x8000 : 0;
+                const uint16_t typeWord = static_cast<uint16_t>(((typeBits >> (16 * word)) & 0x7FFF) | extension);
+                bytes[byteIndex++] = static_cast<uint8_t>(typeWord & 0xFF);
+                bytes[byteIndex++] = static_cast<uint8_t>(typeWord >> 8);
+            }
+            typeBits = 0;
+        }
+        return bytes;
+    }();
+
+    /// @brief The decoded values, one per declared CompositeData member.
+    class Output
+    {
+    public:
+        template <auto Member>
+        const auto& get() const noexcept
+        {
+            constexpr size_t index = Traits::template indexOf<Member>();
+            static_assert(index < std::tuple_size_v<typename Traits::Values>, "Member is not part of this decoder's configuration.");
+            return std::get<index>(_values);
+        }
+
+    private:
+        friend class StaticFaDecoder;
+        typename Traits::Values _values{};
+    };
+
+    /// @brief The header of the configuration, as found in FaPacketProtocol::Metadata.
+    static BinaryHeader header() noexcept
+    {
+        BinaryHeader binaryHeader;
+        const size_t numGroupBytes = _numGroupBytes();
+        for (size_t i = 0; i < numGroupBytes; ++i) { binaryHeader.outputGroups.push_back(headerBytes[i]); }
+        for (size_t i = numGroupBytes; i < headerLength; i += 2)
+        {
+            binaryHeader.outputTypes.push_back(static_cast<uint16_t>(headerBytes[i] | (headerBytes[i + 1] << 8)));
+        }
+        return binaryHeader;
+    }
+
+    /// @brief Decodes one packet, starting at its sync byte. Errors if the packet is of another configuration or fails its CRC.
+    static Errored decode(const uint8_t* packet, const size_t length, Output& output) noexcept
+    {
+        if (length < packetLength || packet[0] != 0xFA) { return true; }
+        if (std::memcmp(packet + 1, headerBytes.data(), headerLength) != 0) { return true; }
+
+        uint16_t crc = 0;
+        for (size_t i = 1; i < packetLength; ++i) { _calculateCRC(&crc, packet[i]); }  // Includes the packet's CRC, leaving 0 when valid
+        if (crc != 0) { return true; }
+
+        _load(packet + 1 + headerLength, output, std::make_index_sequence<std::tuple_size_v<typename Traits::Values>>{});
+        return false;
+    }
+
+    static Errored decode(const ByteBuffer& buffer, const size_t syncByteIndex, Output& output) noexcept
+    {
+        if (buffer.size() < syncByteIndex + packetLength) { return true; }
+        if (buffer.numLinearBytesToPeek(syncByteIndex) >= packetLength)
+        {
+            return decode(buffer.peek_ptr_unchecked(syncByteIndex), packetLength, output);
+        }
+        std::array<uint8_t, packetLength> linear;
+        buffer.peek_unchecked(linear.data(), packetLength, syncByteIndex);
+        return decode(linear.data(), packetLength, output);
+    }
+
+private:
+    template <size_t... I>
+    static void _load(const uint8_t* payload, Output& output, std::index_sequence<I...>) noexcept
+    {
+        constexpr std::array<size_t, sizeof...(I)> sizes{sizeof(std::tuple_element_t<I, typename Traits::Values>)...};
+        constexpr std::array<size_t, sizeof...(I)> offsets = [&]() constexpr
+        {
+            std::array<size_t, sizeof...(I)> result{};
+            for (size_t i = 1; i < sizeof...(I); ++i) { result[i] = result[i - 1] + sizes[i - 1]; }
+            return result;
+        }();
+        (std::memcpy(&std::get<I>(output._values), payload + offsets[I], sizes[I]), ...);
+    }
+};
+
+}  // namespace VN
+
+#endif  // VN_STATICFADECODER_HPP_
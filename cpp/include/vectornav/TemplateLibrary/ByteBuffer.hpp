@@ -29,6 +29,7 @@
 #include <cstdint>
 #include <cstring>
 #include <optional>
+#include <utility>
 
 #include "vectornav/Debug.hpp"
 #include "vectornav/Interface/Errors.hpp"
@@ -41,26 +42,54 @@
 namespace VN
 {
 
+/// Indices wrap with a mask when the capacity is a power of two, and with a modulo otherwise.
 class ByteBuffer
 {
 public:
+    /// Mirrored memory maps the same capacity bytes twice, back to back (see HAL/MirroredMemory.hpp), so every readable or writable region is
+    /// linear and parsers can run on raw pointers without handling the wrap.
+    enum class Layout : uint8_t
+    {
+        Ring,
+        Mirrored
+    };
+
+    struct Span
+    {
+        uint8_t* data = nullptr;
+        size_t size = 0;
+    };
+
+    struct ConstSpan
+    {
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+    };
+
     // ------------------------------------------
     /*! \name Initialization */  //@{
     // ------------------------------------------
-    ByteBuffer(const size_t capacity) : _buffer(new uint8_t[capacity]), _capacity(capacity) {}
+    ByteBuffer(const size_t capacity) : _buffer(new uint8_t[capacity]), _capacity(capacity), _capacityMask(_maskFor(capacity)) {}
 
     ByteBuffer(uint8_t* buffer, const size_t capacity, const size_t size = 0)
-        : _buffer(buffer), _capacity(capacity), _tail(size), _size(size), _autoAllocated(false)
+        : _buffer(buffer), _capacity(capacity), _capacityMask(_maskFor(capacity)), _tail(size), _size(size), _autoAllocated(false)
+    {
+    }
+
+    ByteBuffer(uint8_t* buffer, const size_t capacity, const Layout layout)
+        : _buffer(buffer), _capacity(capacity), _capacityMask(_maskFor(capacity)), _autoAllocated(false), _isMirrored(layout == Layout::Mirrored)
     {
     }
 
     ByteBuffer(const ByteBuffer& other, size_t offset)
         : _buffer(other._buffer),
           _capacity(other._capacity),
+          _capacityMask(other._capacityMask),
           _tail(other._tail),
-          _head((other._head + offset) % other._capacity),
+          _head(other._wrap(other._head + offset)),
           _size(other._size.load() - offset),
-          _autoAllocated(false) {};
+          _autoAllocated(false),
+          _isMirrored(other._isMirrored) {};
 
     ~ByteBuffer()
     {
@@ -108,10 +137,10 @@ public:
     void peek_unchecked(uint8_t* outputBufferHead, const size_t numBytesToPeek, const size_t startingIndex = 0) const noexcept
     {
         const size_t numLinearBytesAvail = numLinearBytesToPeek(startingIndex);
-        if (numLinearBytesAvail >= numBytesToPeek) { memcpy(outputBufferHead, _buffer + ((_head + startingIndex) % _capacity), numBytesToPeek); }
+        if (numLinearBytesAvail >= numBytesToPeek) { memcpy(outputBufferHead, _buffer + _wrap(_head + startingIndex), numBytesToPeek); }
         else
         {
-            memcpy(outputBufferHead, _buffer + ((_head + startingIndex) % _capacity), numLinearBytesAvail);
+            memcpy(outputBufferHead, _buffer + _wrap(_head + startingIndex), numLinearBytesAvail);
             size_t numBytesLeftToPeek = numBytesToPeek - numLinearBytesAvail;
             memcpy(outputBufferHead + numLinearBytesAvail, _buffer, numBytesLeftToPeek);
         }
@@ -119,9 +148,27 @@ public:
 
     void reset() noexcept { discard(_size); }
 
-    uint8_t peek_unchecked(const size_t index = 0) const noexcept { return _buffer[(_head + index) % _capacity]; }
+    uint8_t peek_unchecked(const size_t index = 0) const noexcept { return _buffer[_wrap(_head + index)]; }
 
-    const uint8_t* peek_ptr_unchecked(size_t index = 0) const noexcept { return &_buffer[(_head + index) % _capacity]; }
+    const uint8_t* peek_ptr_unchecked(size_t index = 0) const noexcept { return &_buffer[_wrap(_head + index)]; }
+
+    /// @brief The bytes from startingIndex up to the end of the buffer, or numBytes of them, as at most two linear spans. The second span is empty
+    /// unless the bytes wrap.
+    std::pair<ConstSpan, ConstSpan> peekSpans(const size_t startingIndex = 0, const size_t numBytes = SIZE_MAX) const noexcept
+    {
+        if (startingIndex >= _size) { return {}; }
+        const size_t numBytesToPeek = std::min<size_t>(numBytes, _size - startingIndex);
+        const size_t numLinearBytes = std::min(numBytesToPeek, numLinearBytesToPeek(startingIndex));
+        return {ConstSpan{peek_ptr_unchecked(startingIndex), numLinearBytes}, ConstSpan{_buffer, numBytesToPeek - numLinearBytes}};
+    }
+
+    /// @brief The free bytes following the tail, as at most two linear spans. Bytes written to them are committed with put(numBytes).
+    std::pair<Span, Span> putSpans() noexcept
+    {
+        const size_t numFreeBytes = _capacity - _size;
+        const size_t numLinearBytes = numLinearBytesToPut();
+        return {Span{_buffer + _tail, numLinearBytes}, Span{_buffer, numFreeBytes - numLinearBytes}};
+    }
 
     Errored put(const uint8_t* inputBufferHead, size_t inputBufferSize) noexcept
     {
@@ -150,7 +197,7 @@ public:
     {
         if (numBytes == 0) { return false; }
         if (_size + numBytes > _capacity) { return true; }
-        _tail = (_tail + numBytes) % _capacity;
+        _tail = _wrap(_tail + numBytes);
         _size += numBytes;
         return false;
     }
@@ -159,7 +206,7 @@ public:
     {
         if (numBytes == 0) { return false; }
         if (numBytes > _size) { return true; }
-        _head = (_head + numBytes) % _capacity;
+        _head = _wrap(_head + numBytes);
         _size -= numBytes;
         return false;
     }
@@ -167,13 +214,14 @@ public:
     size_t numLinearBytesToPeek(const size_t startingIndex = 0) const noexcept
     {
         if (startingIndex >= _size) { return 0; }
-        return std::min<size_t>(_capacity - ((_head + startingIndex) % _capacity), _size - startingIndex);
+        if (_isMirrored) { return _size - startingIndex; }
+        return std::min<size_t>(_capacity - _wrap(_head + startingIndex), _size - startingIndex);
     }
 
     size_t numLinearBytesToPut() const noexcept
     {
         size_t emptyBytes = _capacity - _size;
-        if (_tail + emptyBytes <= _capacity) { return emptyBytes; }
+        if (_isMirrored || _tail + emptyBytes <= _capacity) { return emptyBytes; }
         else { return (_capacity - _tail); }
     }
 
@@ -181,8 +229,8 @@ public:
     {
         if (_size <= idxToBegin) { return std::nullopt; }
 
-        const size_t tail = (_head + _size) % _capacity;
-        const size_t startIndex = (_head + idxToBegin) % _capacity;
+        const size_t tail = _wrap(_head + _size);
+        const size_t startIndex = _wrap(_head + idxToBegin);
 
         const_iterator bufferBegin = _begin();
         const_iterator foundIterator;
@@ -206,7 +254,7 @@ public:
             if (!valueHasBeenFound) { return std::nullopt; }
         }
 
-        size_t foundIndex = static_cast<size_t>((_end() - (bufferBegin + _head)) + (foundIterator - bufferBegin)) % _capacity;
+        size_t foundIndex = _wrap(static_cast<size_t>((_end() - (bufferBegin + _head)) + (foundIterator - bufferBegin)));
 
         return std::make_optional(foundIndex);
     }
@@ -217,6 +265,7 @@ public:
 
     bool isEmpty() const noexcept { return (_size == 0); }
     bool isFull() const noexcept { return (_size == _capacity); }
+    bool isMirrored() const noexcept { return _isMirrored; }
     size_t capacity() const noexcept { return _capacity; }
     size_t size() const noexcept { return _size; }
     uint8_t* data() const noexcept { return _buffer; }
@@ -235,10 +284,16 @@ private:
 
     uint8_t* _buffer;
     size_t _capacity;
+    size_t _capacityMask;  // 0 unless the capacity is a power of two
     size_t _tail = 0;
     size_t _head = 0;
     std::atomic<size_t> _size = 0;
     bool _autoAllocated = true;
+    bool _isMirrored = false;
+
+    static constexpr size_t _maskFor(const size_t capacity) noexcept { return (capacity != 0 && (capacity & (capacity - 1)) == 0) ? capacity - 1 : 0; }
+
+    size_t _wrap(const size_t index) const noexcept { return _capacityMask ? (index & _capacityMask) : (index % _capacity); }
 
     constexpr const_iterator _begin() const noexcept { return _buffer; }
     const_iterator _end() const noexcept { return _begin() + _capacity; }
@@ -38,8 +38,8 @@
 namespace VN
 {
 
-template <class Type, std::size_t... Is>
-constexpr std::array<Type, sizeof...(Is)> initializeArray(int arg, std::index_sequence<Is...>)
+template <class Type, class Arg, std::size_t... Is>
+constexpr std::array<Type, sizeof...(Is)> initializeArray(const Arg& arg, std::index_sequence<Is...>)
 {
     return {{(static_cast<void>(Is), Type(arg))...}};  // cast removes unused parameter warning
 }
@@ -76,9 +76,15 @@ public:
     public:
         OwningPtr() = default;
         OwningPtr(DirectAccessQueue_Interface::Element* element) : _element(element) {};
+        /// The element is handed back through queue->_releaseElement instead of having its status updated directly.
+        OwningPtr(DirectAccessQueue_Interface::Element* element, DirectAccessQueue_Interface* queue) : _element(element), _queue(queue) {};
         ~OwningPtr() { _clearElementStatus(); }
 
-        OwningPtr(OwningPtr&& other) noexcept : _element(other._element) { other._element = nullptr; }
+        OwningPtr(OwningPtr&& other) noexcept : _element(other._element), _queue(other._queue)
+        {
+            other._element = nullptr;
+            other._queue = nullptr;
+        }
 
         OwningPtr& operator=(OwningPtr&& other) noexcept
         {
@@ -86,7 +92,9 @@ public:
             {
                 _clearElementStatus();
                 _element = other._element;
+                _queue = other._queue;
                 other._element = nullptr;
+                other._queue = nullptr;
             }
             return *this;
         }
@@ -100,6 +108,7 @@ public:
         {
             _clearElementStatus();
             _element = nullptr;
+            _queue = nullptr;
             return *this;
         }
 
@@ -118,15 +127,18 @@ public:
         const ItemType* operator->() const { return &_element->item; }
 
     private:
+        friend class DirectAccessQueue_Interface;
+
         void _clearElementStatus()
         {
             if (_element)
             {
-                if (_element->status == Element::Status::Getting) { _element->status = Element::Status::Free; }
-                else if (_element->status == Element::Status::Putting) { _element->status = Element::Status::InQueue; }
+                if (_queue) { _queue->_releaseElement(*_element); }
+                else { DirectAccessQueue_Interface::_updateReleasedStatus(*_element); }
             }
         }
         DirectAccessQueue_Interface::Element* _element = nullptr;
+        DirectAccessQueue_Interface* _queue = nullptr;
     };
 
     enum class PutMode : uint8_t
@@ -142,11 +154,34 @@ public:
     virtual OwningPtr put() noexcept = 0;
     virtual OwningPtr get() noexcept = 0;
     virtual OwningPtr getBack() noexcept = 0;
+    /// Hands back the slot returned by the latest put() without queueing it, e.g. because it could not be filled. Must be called by the
+    /// putting thread before its next put().
+    virtual void cancelPut(OwningPtr& putSlot) noexcept = 0;
     virtual void reset() noexcept = 0;
     virtual void setPutMode(PutMode mode) noexcept = 0;
     virtual uint16_t size() const noexcept = 0;
     virtual bool isEmpty() const noexcept = 0;
     virtual uint16_t capacity() const noexcept = 0;
+    virtual ~DirectAccessQueue_Interface() = default;
+
+protected:
+    static void _updateReleasedStatus(Element& element) noexcept
+    {
+        if (element.status == Element::Status::Getting) { element.status = Element::Status::Free; }
+        else if (element.status == Element::Status::Putting) { element.status = Element::Status::InQueue; }
+    }
+
+    /// Takes the element from ptr without updating its status.
+    static Element* _detachElement(OwningPtr& ptr) noexcept
+    {
+        Element* element = ptr._element;
+        ptr._element = nullptr;
+        ptr._queue = nullptr;
+        return element;
+    }
+
+    /// Called when an OwningPtr that was handed out with a queue pointer gives its element back.
+    virtual void _releaseElement(Element& element) noexcept { _updateReleasedStatus(element); }
 };
 
 template <class ItemType, size_t Capacity>
@@ -246,6 +281,15 @@ public:
         return &_elements[latestIdx];
     }
 
+    virtual void cancelPut(OwningPtr& putSlot) noexcept override final
+    {
+        LockGuard lock(_mutex);
+        Element* element = this->_detachElement(putSlot);
+        if (element == nullptr) { return; }
+        _circularBuffer.popBack();  // The slot was the last one put
+        element->status = Element::Status::Free;
+    }
+
     virtual void setPutMode(PutMode mode) noexcept override final
     {
         LockGuard lock(_mutex);
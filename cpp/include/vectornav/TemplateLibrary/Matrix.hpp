@@ -34,6 +34,17 @@
 
 #include "vectornav/Debug.hpp"
 
+// Element access through operator() is bounds checked unless this is defined false. Fixed-size kernels below index the storage directly.
+#ifndef VN_MATRIX_BOUNDS_CHECK_ENABLE
+#define VN_MATRIX_BOUNDS_CHECK_ENABLE true
+#endif
+
+#if (VN_MATRIX_BOUNDS_CHECK_ENABLE)
+#define VN_MATRIX_BOUNDS_CHECK(check_expression) VN_ASSERT(check_expression)
+#else
+#define VN_MATRIX_BOUNDS_CHECK(check_expression)
+#endif
+
 namespace VN
 {
 
@@ -63,25 +74,25 @@ struct Matrix
     // Compound Assignment Operator Overloads /////////////////////////////////////////////////////
     const T& operator()(uint16_t row, uint16_t col) const
     {
-        VN_ASSERT(row < m && col < n);
+        VN_MATRIX_BOUNDS_CHECK(row < m && col < n);
         return _data[col + row * n];
     }
 
     T& operator()(uint16_t row, uint16_t col)
     {
-        VN_ASSERT(row < m && col < n);
+        VN_MATRIX_BOUNDS_CHECK(row < m && col < n);
         return _data[col + row * n];
     }
 
     const T& operator()(uint16_t row) const
     {
-        VN_ASSERT(row < m * n);
+        VN_MATRIX_BOUNDS_CHECK(row < m * n);
         return _data[row];
     }
 
     T& operator()(uint16_t row)
     {
-        VN_ASSERT(row < m * n);
+        VN_MATRIX_BOUNDS_CHECK(row < m * n);
         return _data[row];
     }
 
@@ -230,9 +241,76 @@ Matrix<3, 1, T> mat_mul(const Matrix<3, 3, T>& lhs, const Matrix<3, 1, T>& rhs)
 {
     Matrix<3, 1, T> mat;
 
-    mat[0] = lhs(0, 0) * rhs[0] + lhs(0, 1) * rhs[1] + lhs(0, 2) * rhs[2];
-    mat[1] = lhs(1, 0) * rhs[0] + lhs(1, 1) * rhs[1] + lhs(1, 2) * rhs[2];
-    mat[2] = lhs(2, 0) * rhs[0] + lhs(2, 1) * rhs[1] + lhs(2, 2) * rhs[2];
+    mat[0] = lhs[0] * rhs[0] + lhs[1] * rhs[1] + lhs[2] * rhs[2];
+    mat[1] = lhs[3] * rhs[0] + lhs[4] * rhs[1] + lhs[5] * rhs[2];
+    mat[2] = lhs[6] * rhs[0] + lhs[7] * rhs[1] + lhs[8] * rhs[2];
+
+    return mat;
+}
+
+// Fixed-size kernels /////////////////////////////////////////////////////////////////////////
+// These index the storage directly and keep each output element's sum in a local, so the constant trip count loops unroll and the compiler can
+// compute a whole 4-wide row per SIMD instruction instead of reloading partial sums through memory.
+
+template <typename T, typename S>
+Matrix<4, 4, T> mat_mul(const Matrix<4, 4, T>& lhs, const Matrix<4, 4, S>& rhs)
+{
+    Matrix<4, 4, T> mat;
+
+    for (uint16_t row = 0; row < 4; row++)
+    {
+        const T l0 = lhs[row * 4], l1 = lhs[row * 4 + 1], l2 = lhs[row * 4 + 2], l3 = lhs[row * 4 + 3];
+        for (uint16_t col = 0; col < 4; col++) { mat[row * 4 + col] = l0 * rhs[col] + l1 * rhs[4 + col] + l2 * rhs[8 + col] + l3 * rhs[12 + col]; }
+    }
+
+    return mat;
+}
+
+template <typename T, typename S>
+Matrix<4, 1, T> mat_mul(const Matrix<4, 4, T>& lhs, const Matrix<4, 1, S>& rhs)
+{
+    Matrix<4, 1, T> mat;
+
+    const T r0 = rhs[0], r1 = rhs[1], r2 = rhs[2], r3 = rhs[3];
+    for (uint16_t row = 0; row < 4; row++) { mat[row] = lhs[row * 4] * r0 + lhs[row * 4 + 1] * r1 + lhs[row * 4 + 2] * r2 + lhs[row * 4 + 3] * r3; }
+
+    return mat;
+}
+
+/// Returns lhs * rhs + addend, without the temporary of the separate operations.
+template <uint16_t m, uint16_t n, uint16_t r, typename T, typename S>
+Matrix<m, r, T> mat_mul_add(const Matrix<m, n, T>& lhs, const Matrix<n, r, S>& rhs, const Matrix<m, r, T>& addend)
+{
+    Matrix<m, r, T> mat;
+
+    for (uint16_t row = 0; row < m; row++)
+    {
+        for (uint16_t col = 0; col < r; col++)
+        {
+            T sum = addend[row * r + col];
+            for (uint16_t i = 0; i < n; i++) { sum += lhs[row * n + i] * rhs[i * r + col]; }
+            mat[row * r + col] = sum;
+        }
+    }
+
+    return mat;
+}
+
+/// Returns transpose(lhs) * rhs, without forming the transpose.
+template <uint16_t m, uint16_t n, uint16_t r, typename T, typename S>
+Matrix<n, r, T> mat_mul_transpose_lhs(const Matrix<m, n, T>& lhs, const Matrix<m, r, S>& rhs)
+{
+    Matrix<n, r, T> mat;
+
+    for (uint16_t row = 0; row < n; row++)
+    {
+        for (uint16_t col = 0; col < r; col++)
+        {
+            T sum = 0;
+            for (uint16_t i = 0; i < m; i++) { sum += lhs[i * n + row] * rhs[i * r + col]; }
+            mat[row * r + col] = sum;
+        }
+    }
 
     return mat;
 }
@@ -338,27 +338,117 @@ std::optional<T> fromString(const char* begin, const char* end)
     return std::make_optional(numReturn);
 }
 
-#if (defined(__clang__) && __clang_major < 16) || defined(_MSC_VER) || (defined(__GNUC__) && __GNUC__ < 11)
+/// @brief Parses the plain decimal forms the sensor sends ([+-]digits[.digits][(e|E)[+-]digits]) without touching the locale. Returns
+/// std::nullopt, so the caller falls back to a general parser, unless the significant digits fit a mantissa of at most 2^53 and the decimal
+/// exponent is within +-22. Both are then exact doubles, and one IEEE multiply or divide gives the correctly rounded result.
+inline std::optional<double> fromStringFastPath(const char* begin, const char* end) noexcept
+{
+    static constexpr double pow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                       1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    constexpr int maxPow10 = 22;
+    constexpr uint64_t maxMantissa = uint64_t(1) << 53;
+
+    const char* ptr = begin;
+    bool negative = false;
+    if (ptr != end && (*ptr == '+' || *ptr == '-')) { negative = (*ptr++ == '-'); }
+
+    uint64_t mantissa = 0;
+    int numDigits = 0;  // Significant digits accumulated in mantissa
+    int exponent = 0;
+    bool anyDigits = false;
+    for (; ptr != end && static_cast<unsigned char>(*ptr - '0') < 10; ++ptr)
+    {
+        anyDigits = true;
+        if (mantissa == 0 && *ptr == '0') { continue; }
+        mantissa = mantissa * 10 + static_cast<uint64_t>(*ptr - '0');
+        ++numDigits;
+    }
+    if (ptr != end && *ptr == '.')
+    {
+        for (++ptr; ptr != end && static_cast<unsigned char>(*ptr - '0') < 10; ++ptr)
+        {
+            anyDigits = true;
+            --exponent;
+            if (mantissa == 0 && *ptr == '0') { continue; }
+            mantissa = mantissa * 10 + static_cast<uint64_t>(*ptr - '0');
+            ++numDigits;
+        }
+    }
+    if (!anyDigits || numDigits > 19) { return std::nullopt; }
+    if (ptr != end && (*ptr == 'e' || *ptr == 'E'))
+    {
+        ++ptr;
+        bool negativeExponent = false;
+        if (ptr != end && (*ptr == '+' || *ptr == '-')) { negativeExponent = (*ptr++ == '-'); }
+        if (ptr == end) { return std::nullopt; }
+        int explicitExponent = 0;
+        for (; ptr != end && static_cast<unsigned char>(*ptr - '0') < 10; ++ptr)
+        {
+            if (explicitExponent > 1000) { return std::nullopt; }
+            explicitExponent = explicitExponent * 10 + (*ptr - '0');
+        }
+        exponent += negativeExponent ? -explicitExponent : explicitExponent;
+    }
+    if (ptr != end || mantissa > maxMantissa || exponent > maxPow10 || exponent < -maxPow10) { return std::nullopt; }
+
+    double value = static_cast<double>(mantissa);
+    if (exponent < 0) { value /= pow10[-exponent]; }
+    else { value *= pow10[exponent]; }
+    return std::make_optional(negative ? -value : value);
+}
+
+/// @brief The float counterpart of fromStringFastPath. Rounding the correctly rounded double to float is only wrong when that double lies
+/// exactly halfway between two floats, so those are left to the general parser.
+inline std::optional<float> fromStringFastPathFloat(const char* begin, const char* end) noexcept
+{
+    const auto value = fromStringFastPath(begin, end);
+    if (!value.has_value()) { return std::nullopt; }
+    uint64_t bits;
+    std::memcpy(&bits, &value.value(), sizeof(bits));
+    constexpr uint64_t droppedBits = (uint64_t(1) << 29) - 1;  // Double significand bits below float precision
+    if ((bits & droppedBits) == (uint64_t(1) << 28)) { return std::nullopt; }
+    return std::make_optional(static_cast<float>(value.value()));
+}
+
 template <>
 inline std::optional<double> fromString(const char* begin, const char* end)
 {
+    const auto fast = fromStringFastPath(begin, end);
+    if (fast.has_value()) { return fast; }
+#if (defined(__clang__) && __clang_major < 16) || defined(_MSC_VER) || (defined(__GNUC__) && __GNUC__ < 11)
     char* endPtr;
     errno = 0;
     const double numReturn = strtod(begin, &endPtr);
     if (endPtr != end || errno == ERANGE) { return std::nullopt; }
     return std::make_optional(numReturn);
+#else
+    double numReturn;
+    if (*begin == '+') { begin++; }
+    auto [ptr, ec] = std::from_chars(begin, end, numReturn);
+    if (ptr != end || ec != std::errc{}) { return std::nullopt; }
+    return std::make_optional(numReturn);
+#endif
 }
 
 template <>
 inline std::optional<float> fromString(const char* begin, const char* end)
 {
+    const auto fast = fromStringFastPathFloat(begin, end);
+    if (fast.has_value()) { return fast; }
+#if (defined(__clang__) && __clang_major < 16) || defined(_MSC_VER) || (defined(__GNUC__) && __GNUC__ < 11)
     char* endPtr;
     errno = 0;
     const float numReturn = strtof(begin, &endPtr);
     if (endPtr != end || errno == ERANGE) { return std::nullopt; }
     return std::make_optional(numReturn);
-}
+#else
+    float numReturn;
+    if (*begin == '+') { begin++; }
+    auto [ptr, ec] = std::from_chars(begin, end, numReturn);
+    if (ptr != end || ec != std::errc{}) { return std::nullopt; }
+    return std::make_optional(numReturn);
 #endif
+}
 
 template <class T>
 std::optional<T> fromStringHex(const char* begin, const char* end)
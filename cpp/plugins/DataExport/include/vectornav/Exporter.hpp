@@ -28,9 +28,16 @@
 #include <cstdio>
 
 #include "vectornav/Config.hpp"
+#include "vectornav/Debug.hpp"
 #if THREADING_ENABLE
+#include <condition_variable>
+#include <deque>
+#include <vector>
+
+#include "vectornav/HAL/Mutex.hpp"
 #include "vectornav/HAL/Thread.hpp"
 #endif
+#include "vectornav/ExporterQueue.hpp"
 #include "vectornav/Implementation/QueueDefinitions.hpp"
 
 namespace VN
@@ -38,59 +45,233 @@ namespace VN
 namespace DataExport
 {
 
+#if THREADING_ENABLE
+class ExporterPool;
+#endif
+
 class Exporter
 {
-private:
-    static constexpr uint16_t PACKET_QUEUE_SIZE = 256;
-
 public:
-    using PacketQueueMode = PacketQueue<PACKET_QUEUE_SIZE>::PutMode;
+    static constexpr uint16_t DEFAULT_QUEUE_CAPACITY = 256;
+
+    using PacketQueueMode = PacketQueue_Interface::PutMode;
 
-    Exporter(const size_t& packetCapacity, const PacketQueueMode& mode) : _queue{mode, packetCapacity} {}
+    /// With a packetCapacity of zero, queued packets reference the buffers the sensor shares between subscribers instead of holding copies.
+    Exporter(const size_t& packetCapacity, const PacketQueueMode& mode, const uint16_t queueCapacity = DEFAULT_QUEUE_CAPACITY)
+        : _queue{mode, queueCapacity, static_cast<uint16_t>(packetCapacity)}
+    {
+    }
 
+#if THREADING_ENABLE
+    /// Stops exporting and leaves the pool, if any. Call stop() before destroying a started exporter to export the packets still queued;
+    /// the destructor cannot, as the derived exporter is already gone.
+    virtual ~Exporter();
+#else
     virtual ~Exporter() = default;
+#endif
 
     virtual void exportToFile() = 0;
 
 #if THREADING_ENABLE
+    /// Exports on a dedicated thread, which sleeps until packets arrive.
     Errored start()
     {
-        if (_thread == nullptr) { _logging = true; }
-        else { return true; }
+        if (_logging) { return true; }
+        _logging = true;
         _thread = std::make_unique<Thread>(&Exporter::_export, this);
         return false;
     }
 
-    void stop()
-    {
-        _logging = false;
-        _thread->join();
-    }
+    /// Exports on the worker threads of a pool shared with other exporters.
+    Errored start(ExporterPool& pool);
+
+    void stop();
 
     bool isLogging() const { return _logging; }
 #endif
 
     PacketQueue_Interface* getQueuePtr() { return &_queue; }
 
+    /// Number of packets lost because the queue was full.
+    uint64_t droppedPackets() const { return _queue.droppedPackets(); }
+
 protected:
-    PacketQueue<PACKET_QUEUE_SIZE> _queue;
+    ExporterQueue _queue;
 #if THREADING_ENABLE
     std::atomic<bool> _logging = false;
     std::unique_ptr<Thread> _thread = nullptr;
 
 private:
+    friend class ExporterPool;
+    static constexpr Microseconds WAIT_TIMEOUT = 100ms;
+
+    ExporterPool* _pool = nullptr;
+    // Guarded by the pool's mutex
+    bool _poolScheduled = false;
+    bool _poolRunning = false;
+    bool _poolRerun = false;
+
     void _export()
     {
+        VN_PROFILER_SET_THREAD_NAME("Exporter");
         while (_logging)
         {
-            thisThread::sleepFor(1ms);
+            _queue.waitForData(WAIT_TIMEOUT);
+            if (!_logging) { break; }  // stop() runs the final export
+            VN_PROFILER_TIME_SCOPE("Exporter::exportToFile");
             exportToFile();
         }
-        exportToFile();
     }
+
+    /// Stops the export thread or leaves the pool. Returns false if the exporter was not started.
+    bool _halt();
 #endif
 };
 
+#if THREADING_ENABLE
+/// Runs exportToFile for any number of exporters on a fixed set of threads. An exporter is scheduled when a packet is put in its queue,
+/// and never runs on more than one thread at a time.
+class ExporterPool
+{
+public:
+    ExporterPool(const uint8_t numThreads = 1)
+    {
+        for (uint8_t i = 0; i < numThreads; ++i) { _threads.push_back(std::make_unique<Thread>(&ExporterPool::_work, this)); }
+    }
+
+    ~ExporterPool()
+    {
+        {
+            LockGuard lock(_mutex);
+            _running = false;
+        }
+        _workAvailable.notify_all();
+        for (auto& thread : _threads) { thread->join(); }
+    }
+
+    ExporterPool(const ExporterPool&) = delete;
+    ExporterPool& operator=(const ExporterPool&) = delete;
+
+private:
+    friend class Exporter;
+
+    Mutex _mutex;
+    std::condition_variable_any _workAvailable;
+    std::condition_variable_any _exporterIdle;
+    std::deque<Exporter*> _ready;
+    std::vector<std::unique_ptr<Thread>> _threads;
+    bool _running = true;
+
+    void _add(Exporter& exporter)
+    {
+        exporter._queue.setDataCallback([this, &exporter]() { _schedule(exporter); });
+        _schedule(exporter);  // Packets may already be waiting
+    }
+
+    void _remove(Exporter& exporter)
+    {
+        exporter._queue.setDataCallback(nullptr);
+        LockGuard lock(_mutex);
+        if (exporter._poolScheduled)
+        {
+            for (auto it = _ready.begin(); it != _ready.end(); ++it)
+            {
+                if (*it == &exporter)
+                {
+                    _ready.erase(it);
+                    break;
+                }
+            }
+            exporter._poolScheduled = false;
+        }
+        while (exporter._poolRunning) { _exporterIdle.wait(_mutex); }
+        exporter._poolRerun = false;
+    }
+
+    void _schedule(Exporter& exporter)
+    {
+        {
+            LockGuard lock(_mutex);
+            if (exporter._poolRunning)
+            {
+                exporter._poolRerun = true;
+                return;
+            }
+            if (exporter._poolScheduled) { return; }
+            exporter._poolScheduled = true;
+            _ready.push_back(&exporter);
+        }
+        _workAvailable.notify_one();
+    }
+
+    void _work()
+    {
+        VN_PROFILER_SET_THREAD_NAME("Exporter pool");
+        LockGuard lock(_mutex);
+        while (true)
+        {
+            while (_running && _ready.empty()) { _workAvailable.wait(_mutex); }
+            if (!_running) { return; }
+
+            Exporter* exporter = _ready.front();
+            _ready.pop_front();
+            exporter->_poolScheduled = false;
+            exporter->_poolRunning = true;
+
+            _mutex.unlock();
+            {
+                VN_PROFILER_TIME_SCOPE("ExporterPool::exportToFile");
+                exporter->exportToFile();
+            }
+            _mutex.lock();
+
+            exporter->_poolRunning = false;
+            if (exporter->_poolRerun)
+            {
+                exporter->_poolRerun = false;
+                exporter->_poolScheduled = true;
+                _ready.push_back(exporter);
+            }
+            _exporterIdle.notify_all();
+        }
+    }
+};
+
+inline Errored Exporter::start(ExporterPool& pool)
+{
+    if (_logging) { return true; }
+    _logging = true;
+    _pool = &pool;
+    pool._add(*this);
+    return false;
+}
+
+inline bool Exporter::_halt()
+{
+    if (!_logging) { return false; }
+    _logging = false;
+    if (_thread != nullptr)
+    {
+        _queue.wake();
+        _thread->join();
+        _thread = nullptr;
+    }
+    else if (_pool != nullptr)
+    {
+        _pool->_remove(*this);
+        _pool = nullptr;
+    }
+    return true;
+}
+
+inline void Exporter::stop()
+{
+    if (_halt()) { exportToFile(); }
+}
+
+inline Exporter::~Exporter() { _halt(); }
+#endif
+
 }  // namespace DataExport
 }  // namespace VN
 
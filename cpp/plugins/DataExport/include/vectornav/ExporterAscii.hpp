@@ -39,7 +39,7 @@ class ExporterAscii : public Exporter
 {
 private:
     static constexpr uint8_t MAX_NUM_FILES = 10;
-    static constexpr uint16_t EXPORTER_PACKET_CAPACITY = 2048;
+    static constexpr uint16_t EXPORTER_PACKET_CAPACITY = 0;  // Packets reference the dispatcher's shared buffers
 
 public:
     struct AsciiInfo
@@ -48,8 +48,9 @@ public:
         OutputFile file;
     };
 
-    ExporterAscii(const Filesystem::FilePath& outputDir, PacketQueueMode mode = PacketQueueMode::Force, bool enableSystemTimeStamps = false)
-        : Exporter(EXPORTER_PACKET_CAPACITY, mode), _filePath(outputDir), _enableSystemTimeStamps(enableSystemTimeStamps)
+    ExporterAscii(const Filesystem::FilePath& outputDir, PacketQueueMode mode = PacketQueueMode::Force, bool enableSystemTimeStamps = false,
+                  const uint16_t queueCapacity = DEFAULT_QUEUE_CAPACITY)
+        : Exporter(EXPORTER_PACKET_CAPACITY, mode, queueCapacity), _filePath(outputDir), _enableSystemTimeStamps(enableSystemTimeStamps)
     {
         if (!_filePath.empty() && _filePath.back() != std::filesystem::path::preferred_separator)
         {
@@ -60,31 +61,31 @@ public:
 
     void exportToFile() override
     {
-        while (!_queue.isEmpty())
-        {
-            const auto p = _queue.get();
-            if (!p || (p->details.syncByte != PacketDetails::SyncByte::Ascii)) { continue; }
-
-            if (_asciiInfo.size() == _asciiInfo.capacity())
-            {
-                VN_DEBUG_1("Packet dropped.");
-                continue;
-            }
-
-            OutputFile& ascii = getFileHandle(p->details.asciiMetadata.header);
-
-            if (_enableSystemTimeStamps)
+        const uint16_t numPackets = _queue.consumeAll(
+            [this](const Packet& p)
             {
-                char _buffer[32];
-                const auto len = std::snprintf(
-                    _buffer, sizeof(_buffer), "%lld:",
-                    static_cast<long long int>(std::chrono::duration_cast<Nanoseconds>(p->details.asciiMetadata.timestamp.time_since_epoch()).count()));
-                ascii.write(_buffer, len);
-            }
-
-            ascii.write(reinterpret_cast<const char*>(p->buffer), p->details.asciiMetadata.length);
-        }
-        flushAllFiles();
+                if (p.details.syncByte != PacketDetails::SyncByte::Ascii) { return; }
+
+                if (_asciiInfo.size() == _asciiInfo.capacity())
+                {
+                    VN_DEBUG_1("Packet dropped.");
+                    return;
+                }
+
+                OutputFile& ascii = getFileHandle(p.details.asciiMetadata.header);
+
+                if (_enableSystemTimeStamps)
+                {
+                    char _buffer[32];
+                    const auto len = std::snprintf(
+                        _buffer, sizeof(_buffer), "%lld:",
+                        static_cast<long long int>(std::chrono::duration_cast<Nanoseconds>(p.details.asciiMetadata.timestamp.time_since_epoch()).count()));
+                    ascii.write(_buffer, len);
+                }
+
+                ascii.write(reinterpret_cast<const char*>(p.buffer), p.details.asciiMetadata.length);
+            });
+        if (numPackets > 0) { flushAllFiles(); }
     }
 
 private:
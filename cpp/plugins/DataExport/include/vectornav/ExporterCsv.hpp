@@ -25,7 +25,10 @@
 #define VN_EXPORTERCSV_HPP_
 
 #include <algorithm>
+#include <array>
 #include <chrono>
+#include <string>
+#include <unordered_map>
 
 #include "vectornav/Exporter.hpp"
 #include "vectornav/ExporterCsvUtils.hpp"
@@ -44,26 +47,58 @@ namespace DataExport
 class ExporterCsv : public Exporter
 {
 private:
-    static constexpr uint8_t MAX_NUM_FILES = 4;
-    static constexpr uint16_t EXPORTER_PACKET_CAPACITY = 2048;
+    static constexpr uint16_t EXPORTER_PACKET_CAPACITY = 0;  // Packets reference the dispatcher's shared buffers
     static constexpr uint16_t STRING_BUFFER_CAPACITY = 256;
+    static constexpr uint16_t MAX_OPEN_FILES = 16;               // Least recently used file is closed beyond this, and reopened to append later
+    static constexpr size_t FILE_BUFFER_FLUSH_THRESHOLD = 65536;  // Pending bytes at which a file is written even if its handle must be reopened
 
 public:
-    struct CsvInfo
+    /// @brief Identifies one output file: the ASCII header, the FA header bytes, or the GNSS group of a SatInfo/RawMeas file.
+    struct CsvFileKey
     {
-        PacketDetails details;
-        OutputFile file;
+        enum class Kind : uint8_t
+        {
+            Ascii,
+            Fa,
+            SatInfo,
+            RawMeas
+        } kind = Kind::Ascii;
+        uint8_t length = 0;
+        std::array<uint8_t, binaryHeaderMaxLength> bytes{};
+
+        bool operator==(const CsvFileKey& other) const noexcept
+        {
+            return kind == other.kind && length == other.length && std::equal(bytes.begin(), bytes.begin() + length, other.bytes.begin());
+        }
     };
 
-    struct DynamicCsvInfo
+    struct CsvFileKeyHash
     {
-        uint8_t measGroupNum;
-        uint8_t measTypeNum;
+        size_t operator()(const CsvFileKey& key) const noexcept
+        {
+            uint32_t hash = 2166136261u;  // FNV-1a
+            hash = (hash ^ static_cast<uint8_t>(key.kind)) * 16777619u;
+            for (uint8_t i = 0; i < key.length; i++) { hash = (hash ^ key.bytes[i]) * 16777619u; }
+            return hash;
+        }
+    };
+
+    /// @brief An output file and the bytes not yet written to it. The handle may be closed while bytes keep accumulating.
+    struct CsvFile
+    {
+        Filesystem::FilePath path;
         OutputFile file;
+        std::string pending;
+        uint64_t lastUsed = 0;
+        bool created = false;
+
+        void write(const char* buffer, const size_t count) { pending.append(buffer, count); }
+        void write(const char* buffer) { pending.append(buffer); }
     };
 
-    ExporterCsv(const Filesystem::FilePath& outputDir, PacketQueueMode mode = PacketQueueMode::Force, bool enableSystemTimeStamps = false)
-        : Exporter(EXPORTER_PACKET_CAPACITY, mode), _filePath(outputDir), _enableSystemTimeStamps(enableSystemTimeStamps)
+    ExporterCsv(const Filesystem::FilePath& outputDir, PacketQueueMode mode = PacketQueueMode::Force, bool enableSystemTimeStamps = false,
+                const uint16_t queueCapacity = DEFAULT_QUEUE_CAPACITY)
+        : Exporter(EXPORTER_PACKET_CAPACITY, mode, queueCapacity), _filePath(outputDir), _enableSystemTimeStamps(enableSystemTimeStamps)
     {
         if (!_filePath.empty() && _filePath.back() != std::filesystem::path::preferred_separator)
         {
@@ -71,137 +106,135 @@ public:
         }
     }
 
-    ~ExporterCsv() = default;
+    ~ExporterCsv()
+    {
+        for (auto& [key, csvFile] : _csvFiles) { _writePending(csvFile); }
+    }
 
     void exportToFile() override
     {
-        while (!_queue.isEmpty())
-        {
-            const auto p = _queue.get();
-            if (!p) { return; }
+        if (_queue.consumeAll([this](const Packet& p) { _exportPacket(p); }) > 0) { flushAllFiles(); }
+    }
 
-            if (_csvInfo.size() == _csvInfo.capacity())
-            {
-                VN_DEBUG_1("Packet dropped.");
-                continue;
-            }
+    /// @brief Number of distinct output files created so far.
+    size_t numFiles() const noexcept { return _csvFiles.size(); }
 
-            OutputFile& csv = getFileHandle(p.get());
-            if (_enableSystemTimeStamps)
-            {
-                const auto timestamp =
-                    (p->details.syncByte == PacketDetails::SyncByte::Ascii) ? p->details.asciiMetadata.timestamp : p->details.faMetadata.timestamp;
-                const uint16_t num_bytes =
-                    std::snprintf(_tmpBuffer.data(), _tmpBuffer.size(), "%lld,",
-                                  static_cast<long long int>(std::chrono::duration_cast<Nanoseconds>(timestamp.time_since_epoch()).count()));
-                csv.write(_tmpBuffer.data(), num_bytes);
-            }
+private:
+    void _exportPacket(const Packet& p)
+    {
+        if (p.details.syncByte != PacketDetails::SyncByte::FA && p.details.syncByte != PacketDetails::SyncByte::Ascii) { return; }
 
-            if (p->details.syncByte == PacketDetails::SyncByte::Ascii)
-            {
-                const size_t begin = p->details.asciiMetadata.delimiterIndices.front() + 1;
-                const size_t end = p->details.asciiMetadata.delimiterIndices.back();
-                csv.write(reinterpret_cast<const char*>(&p->buffer[begin]), end - begin);
-            }
-            else
-            {
-                OutputFile& csv = getFileHandle(p.get());
-                bool first_meas_of_line = true;
-                FaPacketExtractor extractor(p->buffer, p->details.faMetadata);
-                extractor.discard(p->details.faMetadata.header.size() + 1);
+        CsvFile& csv = getFileHandle(&p);
+        if (_enableSystemTimeStamps)
+        {
+            const auto timestamp =
+                (p.details.syncByte == PacketDetails::SyncByte::Ascii) ? p.details.asciiMetadata.timestamp : p.details.faMetadata.timestamp;
+            _writeTimestamp(csv, timestamp);
+        }
 
-                BinaryHeaderIterator iter(p->details.faMetadata.header);
-                while (iter.next())
+        if (p.details.syncByte == PacketDetails::SyncByte::Ascii)
+        {
+            const size_t begin = p.details.asciiMetadata.delimiterIndices.front() + 1;
+            const size_t end = p.details.asciiMetadata.delimiterIndices.back();
+            csv.write(reinterpret_cast<const char*>(&p.buffer[begin]), end - begin);
+        }
+        else
+        {
+            bool first_meas_of_line = true;
+            FaPacketExtractor extractor(p.buffer, p.details.faMetadata);
+            extractor.discard(p.details.faMetadata.header.size() + 1);
+
+            BinaryHeaderIterator iter(p.details.faMetadata.header);
+            while (iter.next())
+            {
+                const auto typeInfo = csvTypeLookup(iter.group(), iter.field());
+                if (!(typeInfo.type == CsvType::SAT || typeInfo.type == CsvType::RAW))
                 {
-                    const auto typeInfo = csvTypeLookup(iter.group(), iter.field());
-                    if (!(typeInfo.type == CsvType::SAT || typeInfo.type == CsvType::RAW))
-                    {
-                        if (!first_meas_of_line) { csv.write(","); }
-                        first_meas_of_line = false;
-                        const uint16_t num_bytes = getMeasurementString(extractor, typeInfo, _tmpBuffer.data(), _tmpBuffer.size());
-                        csv.write(_tmpBuffer.data(), num_bytes);
-                    }
-                    else
+                    if (!first_meas_of_line) { csv.write(","); }
+                    first_meas_of_line = false;
+                    const uint16_t num_bytes = getMeasurementString(extractor, typeInfo, _tmpBuffer.data(), _tmpBuffer.size());
+                    csv.write(_tmpBuffer.data(), num_bytes);
+                }
+                else
+                {
+                    CsvFile& dynamicCsv = getDynamicFileHandle(iter.group(), iter.field(), p.details.faMetadata.header);
+                    if (typeInfo.type == CsvType::SAT)
                     {
-                        OutputFile& dynamicCsv = getDynamicFileHandle(iter.group(), iter.field(), p->details.faMetadata.header);
-                        if (typeInfo.type == CsvType::SAT)
-                        {
-                            if (_enableSystemTimeStamps) { _writeTimestamp(dynamicCsv, p->details.faMetadata.timestamp); }
+                        if (_enableSystemTimeStamps) { _writeTimestamp(dynamicCsv, p.details.faMetadata.timestamp); }
 
-                            const auto numSats = extractor.extract_unchecked<uint8_t>();
-                            int num_bytes = std::snprintf(_tmpBuffer.data(), _tmpBuffer.size(), "%u%s", numSats, (numSats == 0) ? "" : ",");
-                            dynamicCsv.write(_tmpBuffer.data(), num_bytes);
+                        const auto numSats = extractor.extract_unchecked<uint8_t>();
+                        int num_bytes = std::snprintf(_tmpBuffer.data(), _tmpBuffer.size(), "%u%s", numSats, (numSats == 0) ? "" : ",");
+                        dynamicCsv.write(_tmpBuffer.data(), num_bytes);
 
-                            extractor.discard(1);
-                            for (auto i = 0; i < GNSS_SAT_INFO_MAX_COUNT; i++)
+                        extractor.discard(1);
+                        for (auto i = 0; i < GNSS_SAT_INFO_MAX_COUNT; i++)
+                        {
+                            if (i < numSats)
                             {
-                                if (i < numSats)
-                                {
-                                    num_bytes = getMeasurementString(extractor, typeInfo, _tmpBuffer.data(), _tmpBuffer.size());
-                                    dynamicCsv.write(_tmpBuffer.data(), num_bytes);
-                                    if (i < numSats - 1) { dynamicCsv.write(","); }
-                                }
-                                else { dynamicCsv.write(",0,0,0,0,0,0,0"); }
+                                num_bytes = getMeasurementString(extractor, typeInfo, _tmpBuffer.data(), _tmpBuffer.size());
+                                dynamicCsv.write(_tmpBuffer.data(), num_bytes);
+                                if (i < numSats - 1) { dynamicCsv.write(","); }
                             }
-                            dynamicCsv.write("\n");
+                            else { dynamicCsv.write(",0,0,0,0,0,0,0"); }
                         }
-                        else
+                        dynamicCsv.write("\n");
+                    }
+                    else
+                    {
+                        int offset = 0;
+                        if (_enableSystemTimeStamps)
                         {
-                            int offset = 0;
-                            if (_enableSystemTimeStamps)
-                            {
-                                offset +=
-                                    std::snprintf(_tmpBuffer.data(), _tmpBuffer.size(), "%lld,",
-                                                  static_cast<long long int>(
-                                                      std::chrono::duration_cast<Nanoseconds>(p->details.faMetadata.timestamp.time_since_epoch()).count()));
-                            }
-                            offset += extractToString<double>(extractor, 1, _tmpBuffer.data() + offset, _tmpBuffer.size());
-                            offset += std::snprintf(_tmpBuffer.data() + offset, _tmpBuffer.size() - offset, ",");
+                            offset +=
+                                std::snprintf(_tmpBuffer.data(), _tmpBuffer.size(), "%lld,",
+                                              static_cast<long long int>(
+                                                  std::chrono::duration_cast<Nanoseconds>(p.details.faMetadata.timestamp.time_since_epoch()).count()));
+                        }
+                        offset += extractToString<double>(extractor, 1, _tmpBuffer.data() + offset, _tmpBuffer.size());
+                        offset += std::snprintf(_tmpBuffer.data() + offset, _tmpBuffer.size() - offset, ",");
 
-                            offset += extractToString<uint16_t>(extractor, 1, _tmpBuffer.data() + offset, _tmpBuffer.size() - offset);
-                            offset += std::snprintf(_tmpBuffer.data() + offset, _tmpBuffer.size() - offset, ",");
+                        offset += extractToString<uint16_t>(extractor, 1, _tmpBuffer.data() + offset, _tmpBuffer.size() - offset);
+                        offset += std::snprintf(_tmpBuffer.data() + offset, _tmpBuffer.size() - offset, ",");
 
-                            const auto numSats = extractor.extract_unchecked<uint8_t>();
-                            offset += std::snprintf(_tmpBuffer.data() + offset, _tmpBuffer.size() - offset, "%u,", numSats);
+                        const auto numSats = extractor.extract_unchecked<uint8_t>();
+                        offset += std::snprintf(_tmpBuffer.data() + offset, _tmpBuffer.size() - offset, "%u,", numSats);
 
-                            extractor.discard(1);
+                        extractor.discard(1);
 
-                            for (auto i = 0; i < numSats; i++)
-                            {
-                                const uint16_t num_bytes = getMeasurementString(extractor, typeInfo, _tmpBuffer.data() + offset, _tmpBuffer.size());
-                                dynamicCsv.write(_tmpBuffer.data(), offset + num_bytes);
-                                dynamicCsv.write("\n");
-                            }
+                        for (auto i = 0; i < numSats; i++)
+                        {
+                            const uint16_t num_bytes = getMeasurementString(extractor, typeInfo, _tmpBuffer.data() + offset, _tmpBuffer.size());
+                            dynamicCsv.write(_tmpBuffer.data(), offset + num_bytes);
+                            dynamicCsv.write("\n");
                         }
                     }
+                    if (dynamicCsv.pending.size() >= FILE_BUFFER_FLUSH_THRESHOLD) { _writePending(dynamicCsv); }
                 }
             }
-            csv.write("\n");
         }
-        flushAllFiles();
+        csv.write("\n");
+        if (csv.pending.size() >= FILE_BUFFER_FLUSH_THRESHOLD) { _writePending(csv); }
     }
 
-private:
-    void init_csv(CsvInfo& csvInfo, const Packet* p)
+    void init_csv(CsvFile& csvFile, const Packet* p)
     {
-        if (_enableSystemTimeStamps) { csvInfo.file.write("systemTimeStamp,"); }
+        if (_enableSystemTimeStamps) { csvFile.write("systemTimeStamp,"); }
 
-        if (csvInfo.details.syncByte == PacketDetails::SyncByte::Ascii)
+        if (p->details.syncByte == PacketDetails::SyncByte::Ascii)
         {
-            const AsciiPacketProtocol::AsciiMeasurementHeader asciiHeader = AsciiPacketProtocol::getMeasHeader(csvInfo.details.asciiMetadata.header);
-            csvInfo.file.write(getMeasurementString(asciiHeader));
+            const AsciiPacketProtocol::AsciiMeasurementHeader asciiHeader = AsciiPacketProtocol::getMeasHeader(p->details.asciiMetadata.header);
+            csvFile.write(getMeasurementString(asciiHeader));
 
             if (std::find(&p->buffer[7], &p->buffer[p->details.asciiMetadata.length], 'S') != &p->buffer[p->details.asciiMetadata.length])
             {
-                csvInfo.file.write(",appendStatus");
+                csvFile.write(",appendStatus");
             }
 
             if (std::find(&p->buffer[7], &p->buffer[p->details.asciiMetadata.length], 'T') != &p->buffer[p->details.asciiMetadata.length])
             {
-                csvInfo.file.write(",appendCount");
+                csvFile.write(",appendCount");
             }
 
-            csvInfo.file.write("\n");
+            csvFile.write("\n");
         }
         else
         {
@@ -213,23 +246,23 @@ private:
                 const auto typeInfo = csvTypeLookup(iter.group(), iter.field());
                 if ((typeInfo.type == CsvType::SAT || typeInfo.type == CsvType::RAW)) { continue; }
 
-                if (!firstMeas) { csvInfo.file.write(","); }
+                if (!firstMeas) { csvFile.write(","); }
                 firstMeas = false;
-                csvInfo.file.write(getMeasurementName(iter.group(), iter.field()));
+                csvFile.write(getMeasurementName(iter.group(), iter.field()));
             }
-            csvInfo.file.write("\n");
+            csvFile.write("\n");
         }
     }
 
-    void init_dynamic_csv(DynamicCsvInfo& dynamicCsvInfo, const uint8_t measGroupNum, const uint8_t measTypeNum)
+    void init_dynamic_csv(CsvFile& dynamicCsvFile, const uint8_t measGroupNum, const uint8_t measTypeNum)
     {
-        if (_enableSystemTimeStamps) { dynamicCsvInfo.file.write("systemTimeStamp,"); }
+        if (_enableSystemTimeStamps) { dynamicCsvFile.write("systemTimeStamp,"); }
 
-        if (measTypeNum == 14) { _init_sat_info(dynamicCsvInfo, measGroupNum, measTypeNum); }
-        else { _init_raw_meas(dynamicCsvInfo, measGroupNum, measTypeNum); }
+        if (measTypeNum == 14) { _init_sat_info(dynamicCsvFile, measGroupNum, measTypeNum); }
+        else { _init_raw_meas(dynamicCsvFile, measGroupNum, measTypeNum); }
     }
 
-    void _init_sat_info(DynamicCsvInfo& dynamicCsvInfo, const uint8_t measGroupNum, const uint8_t measTypeNum)
+    void _init_sat_info(CsvFile& dynamicCsvFile, const uint8_t measGroupNum, const uint8_t measTypeNum)
     {
         const uint8_t skipLength = sizeof("Gnss1NumSats,") - 1;
         uint8_t skip = 0;
@@ -249,91 +282,141 @@ private:
                     _tmpBuffer[j++] = satNum[1];
                 }
             }
-            dynamicCsvInfo.file.write(_tmpBuffer.data() + skip, num_chars - skip);
-            if (i < GNSS_SAT_INFO_MAX_COUNT - 1) { dynamicCsvInfo.file.write(","); }
+            dynamicCsvFile.write(_tmpBuffer.data() + skip, num_chars - skip);
+            if (i < GNSS_SAT_INFO_MAX_COUNT - 1) { dynamicCsvFile.write(","); }
         }
-        dynamicCsvInfo.file.write("\n");
+        dynamicCsvFile.write("\n");
     }
 
-    void _init_raw_meas(DynamicCsvInfo& dynamicCsvInfo, const uint8_t measGroupNum, const uint8_t measTypeNum)
+    void _init_raw_meas(CsvFile& dynamicCsvFile, const uint8_t measGroupNum, const uint8_t measTypeNum)
     {
         const uint16_t num_chars = std::snprintf(_tmpBuffer.data(), _tmpBuffer.size(), "%s\n", getMeasurementName(measGroupNum, measTypeNum));
-        dynamicCsvInfo.file.write(_tmpBuffer.data(), num_chars);
+        dynamicCsvFile.write(_tmpBuffer.data(), num_chars);
     }
 
-    void _writeTimestamp(OutputFile& file, time_point timestamp)
+    void _writeTimestamp(CsvFile& file, time_point timestamp)
     {
         const uint16_t num_bytes = std::snprintf(_tmpBuffer.data(), _tmpBuffer.size(), "%lld,",
                                                  static_cast<long long int>(std::chrono::duration_cast<Nanoseconds>(timestamp.time_since_epoch()).count()));
         file.write(_tmpBuffer.data(), num_bytes);
     }
 
-    OutputFile& getFileHandle(const Packet* p)
+    CsvFile& getFileHandle(const Packet* p)
     {
-        Filesystem::FilePath fileName;
+        CsvFileKey key;
         if (p->details.syncByte == PacketDetails::SyncByte::Ascii)
         {
-            for (auto& tmp : _csvInfo)
-            {
-                if (tmp.details.syncByte == PacketDetails::SyncByte::Ascii && p->details.asciiMetadata.header == tmp.details.asciiMetadata.header)
-                {
-                    return tmp.file;
-                }
-            }
-            std::snprintf(fileName.begin(), fileName.capacity(), "%s%s.csv", _filePath.c_str(), p->details.asciiMetadata.header.c_str());
+            static_assert(Config::PacketFinders::asciiHeaderMaxLength <= std::tuple_size_v<decltype(key.bytes)>);
+            const AsciiHeader& header = p->details.asciiMetadata.header;
+            key.kind = CsvFileKey::Kind::Ascii;
+            key.length = static_cast<uint8_t>(header.length());
+            std::copy(header.begin(), header.end(), key.bytes.begin());
         }
         else
         {
-            for (auto& tmp : _csvInfo)
-            {
-                if (tmp.details.syncByte == PacketDetails::SyncByte::FA && p->details.faMetadata.header == tmp.details.faMetadata.header) { return tmp.file; }
-            }
-            std::snprintf(fileName.begin(), fileName.capacity(), "%sFA%s.csv", _filePath.c_str(),
-                          binaryHeaderToString<64>(p->details.faMetadata.header).c_str());
-            std::replace(fileName.begin(), fileName.end(), ',', '_');
+            const auto headerBytes = p->details.faMetadata.header.toHeaderBytes();
+            key.kind = CsvFileKey::Kind::Fa;
+            key.length = static_cast<uint8_t>(headerBytes.size());
+            std::copy(headerBytes.begin(), headerBytes.end(), key.bytes.begin());
         }
 
-        if (_csvInfo.push_back(CsvInfo{p->details, OutputFile(fileName)})) { VN_ABORT(); }
-        // if we don't find the header we need to init a new csv
+        const auto [itr, inserted] = _csvFiles.try_emplace(key);
+        CsvFile& csvFile = itr->second;
+        if (!inserted) { return csvFile; }
 
-        init_csv(_csvInfo.back(), p);
+        // if we don't find the header we need to init a new csv
+        if (p->details.syncByte == PacketDetails::SyncByte::Ascii)
+        {
+            std::snprintf(csvFile.path.begin(), csvFile.path.capacity(), "%s%s.csv", _filePath.c_str(), p->details.asciiMetadata.header.c_str());
+        }
+        else
+        {
+            std::snprintf(csvFile.path.begin(), csvFile.path.capacity(), "%sFA%s.csv", _filePath.c_str(),
+                          binaryHeaderToString<64>(p->details.faMetadata.header).c_str());
+            std::replace(csvFile.path.begin(), csvFile.path.end(), ',', '_');
+        }
 
-        return _csvInfo.back().file;
+        init_csv(csvFile, p);
+        return csvFile;
     }
 
-    OutputFile& getDynamicFileHandle(const uint8_t measGroupNum, const uint8_t measTypeNum, const BinaryHeader& header)
+    CsvFile& getDynamicFileHandle(const uint8_t measGroupNum, const uint8_t measTypeNum, const BinaryHeader& header)
     {
-        for (auto& tmp : _dynamicCsvInfo)
-        {
-            if (tmp.measGroupNum == measGroupNum && tmp.measTypeNum == measTypeNum) { return tmp.file; }
-        }
-
         const auto typeInfo = csvTypeLookup(measGroupNum, measTypeNum);
 
-        Filesystem::FilePath fileName;
+        CsvFileKey key;
+        if (typeInfo.type == CsvType::SAT) { key.kind = CsvFileKey::Kind::SatInfo; }
+        else if (typeInfo.type == CsvType::RAW) { key.kind = CsvFileKey::Kind::RawMeas; }
+        else { VN_ABORT(); }
+        key.length = 1;
+        key.bytes[0] = measGroupNum;
+
+        const auto [itr, inserted] = _csvFiles.try_emplace(key);
+        CsvFile& dynamicCsvFile = itr->second;
+        if (!inserted) { return dynamicCsvFile; }
+
         const char gnss_num = measGroupNum == 3 ? '1' : '2';
+        std::snprintf(dynamicCsvFile.path.begin(), dynamicCsvFile.path.capacity(), "%sFA%s_%s%c.csv", _filePath.c_str(),
+                      binaryHeaderToString<64>(header).c_str(), (typeInfo.type == CsvType::SAT) ? "SatInfo" : "RawMeas", gnss_num);
+        std::replace(dynamicCsvFile.path.begin(), dynamicCsvFile.path.end(), ',', '_');
+
+        init_dynamic_csv(dynamicCsvFile, measGroupNum, measTypeNum);
+        return dynamicCsvFile;
+    }
 
-        if (typeInfo.type == CsvType::SAT)
+    void flushAllFiles()
+    {
+        // Files whose handle was evicted keep buffering until they pass the threshold, so a batch never cycles every handle.
+        for (auto& [key, csvFile] : _csvFiles)
         {
-            std::snprintf(fileName.begin(), fileName.capacity(), "%sFA%s_SatInfo%c.csv", _filePath.c_str(), binaryHeaderToString<64>(header).c_str(), gnss_num);
+            if (csvFile.file.is_open() || _numOpenFiles < MAX_OPEN_FILES || csvFile.pending.size() >= FILE_BUFFER_FLUSH_THRESHOLD)
+            {
+                _writePending(csvFile);
+            }
+            csvFile.file.flush();
         }
-        else if (typeInfo.type == CsvType::RAW)
+    }
+
+    void _writePending(CsvFile& csvFile)
+    {
+        if (csvFile.pending.empty()) { return; }
+        if (!csvFile.file.is_open() && _openFile(csvFile))
         {
-            std::snprintf(fileName.begin(), fileName.capacity(), "%sFA%s_RawMeas%c.csv", _filePath.c_str(), binaryHeaderToString<64>(header).c_str(), gnss_num);
+            csvFile.pending.clear();  // Nowhere to put it, so drop it rather than grow without bound
+            return;
         }
-        else { VN_ABORT(); }
-        std::replace(fileName.begin(), fileName.end(), ',', '_');
-
-        if (_dynamicCsvInfo.push_back(DynamicCsvInfo{measGroupNum, measTypeNum, OutputFile(fileName)})) { VN_ABORT(); }
-
-        init_dynamic_csv(_dynamicCsvInfo.back(), measGroupNum, measTypeNum);
-        return _dynamicCsvInfo.back().file;
+        csvFile.lastUsed = ++_useCount;
+        csvFile.file.write(csvFile.pending.data(), csvFile.pending.size());
+        csvFile.pending.clear();
     }
 
-    void flushAllFiles()
+    Errored _openFile(CsvFile& csvFile)
     {
-        for (auto& csvInfo : _csvInfo) { csvInfo.file.flush(); }
-        for (auto& dynamicCsvInfo : _dynamicCsvInfo) { dynamicCsvInfo.file.flush(); }
+        if (_numOpenFiles >= MAX_OPEN_FILES)
+        {
+            CsvFile* leastRecentlyUsed = nullptr;
+            for (auto& [key, other] : _csvFiles)
+            {
+                if (other.file.is_open() && (leastRecentlyUsed == nullptr || other.lastUsed < leastRecentlyUsed->lastUsed)) { leastRecentlyUsed = &other; }
+            }
+            if (leastRecentlyUsed != nullptr)
+            {
+                leastRecentlyUsed->file.close();
+                --_numOpenFiles;
+            }
+        }
+
+        // The first open truncates any stale file from a previous export; later ones continue where the evicted handle stopped.
+        const Errored failed = csvFile.created ? csvFile.file.openAppend(csvFile.path) : csvFile.file.open(csvFile.path);
+        if (failed)
+        {
+            VN_DEBUG_1("Failed to open " + std::string(csvFile.path.c_str()));
+            csvFile.file.close();
+            return true;
+        }
+        csvFile.created = true;
+        ++_numOpenFiles;
+        return false;
     }
 
 private:
@@ -341,8 +424,9 @@ private:
     const bool _enableSystemTimeStamps = false;
     std::array<char, STRING_BUFFER_CAPACITY> _tmpBuffer;
 
-    Vector<CsvInfo, MAX_NUM_FILES> _csvInfo;                // One entry per file created, which is per unique message type
-    Vector<DynamicCsvInfo, MAX_NUM_FILES> _dynamicCsvInfo;  // One entry per file created, which is per unique message type
+    std::unordered_map<CsvFileKey, CsvFile, CsvFileKeyHash> _csvFiles;  // One entry per file created, which is per unique message type
+    uint16_t _numOpenFiles = 0;
+    uint64_t _useCount = 0;
 };
 
 }  // namespace DataExport
@@ -0,0 +1,316 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.99.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef VN_EXPORTERQUEUE_HPP_
+#define VN_EXPORTERQUEUE_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "vectornav/Config.hpp"
+#include "vectornav/HAL/Duration.hpp"
+#include "vectornav/HAL/Mutex.hpp"
+#include "vectornav/Implementation/PacketArena.hpp"
+#include "vectornav/Implementation/QueueDefinitions.hpp"
+#if THREADING_ENABLE
+#include <condition_variable>
+#endif
+
+namespace VN
+{
+namespace DataExport
+{
+
+/// A packet queue with a capacity chosen at construction, which can wake a waiting consumer when a packet is put and hand out every
+/// available packet in one lock acquisition.
+class ExporterQueue : public PacketQueue_Interface
+{
+public:
+    using OwningPtr = PacketQueue_Interface::OwningPtr;
+    using Element = PacketQueue_Interface::Element;
+    using PutMode = PacketQueue_Interface::PutMode;
+    using DataCallback = std::function<void()>;
+
+    /// Packets with storage of their own have it carved from a single block.
+    ExporterQueue(PutMode putMode, uint16_t queueCapacity, uint16_t packetCapacity)
+        : _putMode(putMode), _packetSlab(_usesSlab(packetCapacity) ? queueCapacity : 0, packetCapacity)
+    {
+        _elements.reserve(queueCapacity);
+        for (uint16_t i = 0; i < queueCapacity; ++i)
+        {
+            if (_usesSlab(packetCapacity)) { _elements.push_back(std::make_unique<Element>(&_packetSlab)); }
+            else { _elements.push_back(std::make_unique<Element>(packetCapacity)); }
+        }
+        _ring.resize(queueCapacity);
+        _batch.reserve(queueCapacity);
+    }
+
+    ExporterQueue(ExporterQueue&& other) = delete;
+    ExporterQueue(const ExporterQueue& other) = delete;
+    ExporterQueue& operator=(ExporterQueue&& other) = delete;
+    ExporterQueue& operator=(const ExporterQueue& other) = delete;
+
+    OwningPtr put() noexcept override final
+    {
+        LockGuard lock(_mutex);
+        Element* element = _tryPut();
+        if (element == nullptr && _putMode == PutMode::Force && _count > 0 && _elements[_ring[_head]]->status == Element::Status::InQueue)
+        {
+            // Overwrite the oldest packet
+            const uint16_t idx = _pop();
+            element = _elements[idx].get();
+            element->status = Element::Status::Putting;
+            _push(idx);
+            ++_droppedPackets;
+            return OwningPtr(element, this);
+        }
+#if THREADING_ENABLE
+        while (element == nullptr && _putMode == PutMode::Retry)
+        {
+            _spaceAvailable.wait(_mutex);
+            element = _tryPut();
+        }
+#endif
+        if (element == nullptr)
+        {
+            ++_droppedPackets;
+            return nullptr;
+        }
+        return OwningPtr(element, this);
+    }
+
+    OwningPtr get() noexcept override final
+    {
+        LockGuard lock(_mutex);
+        if (!_headIsReady()) { return nullptr; }
+        Element* element = _elements[_pop()].get();
+        element->status = Element::Status::Getting;
+        return OwningPtr(element, this);
+    }
+
+    OwningPtr getBack() noexcept override final
+    {
+        LockGuard lock(_mutex);
+        Element* latest = nullptr;
+        while (_headIsReady())
+        {
+            latest = _elements[_pop()].get();
+            latest->item.releaseShared();
+            latest->status = Element::Status::Free;
+        }
+        if (latest == nullptr) { return nullptr; }
+        latest->status = Element::Status::Getting;
+        return OwningPtr(latest, this);
+    }
+
+    void cancelPut(OwningPtr& putSlot) noexcept override final
+    {
+        LockGuard lock(_mutex);
+        Element* element = _detachElement(putSlot);
+        if (element == nullptr) { return; }
+        --_count;  // The slot was the last one put
+        element->item.releaseShared();
+        element->status = Element::Status::Free;
+    }
+
+    /// Calls process(const Packet&) on every packet available, in order, and returns how many were processed. Each slot is released as
+    /// soon as its packet has been processed.
+    template <typename Callable>
+    uint16_t consumeAll(Callable&& process)
+    {
+        _batch.clear();
+        {
+            LockGuard lock(_mutex);
+            while (_headIsReady())
+            {
+                const uint16_t idx = _pop();
+                _elements[idx]->status = Element::Status::Getting;
+                _batch.push_back(idx);
+            }
+        }
+        for (const uint16_t idx : _batch)
+        {
+            process(static_cast<const Packet&>(_elements[idx]->item));
+            _elements[idx]->item.releaseShared();
+            _elements[idx]->status = Element::Status::Free;
+        }
+        if (!_batch.empty()) { _notifySpaceAvailable(); }
+        return static_cast<uint16_t>(_batch.size());
+    }
+
+#if THREADING_ENABLE
+    /// Blocks until a packet is available, wake() is called, or the timeout elapses. Returns true if a packet is available.
+    bool waitForData(const Microseconds timeout)
+    {
+        LockGuard lock(_mutex);
+        _consumerWaiting = true;
+        const bool ready = _dataAvailable.wait_for(_mutex, timeout, [this]() { return _woken || _headIsReady(); }) && _headIsReady();
+        _consumerWaiting = false;
+        _woken = false;
+        return ready;
+    }
+
+    /// Releases a consumer blocked in waitForData.
+    void wake()
+    {
+        LockGuard lock(_mutex);
+        _woken = true;
+        _dataAvailable.notify_all();
+    }
+#endif
+
+    /// Called from the producing thread each time a packet becomes available. It must not call back into this queue.
+    void setDataCallback(DataCallback callback)
+    {
+        LockGuard lock(_mutex);
+        _onData = std::move(callback);
+    }
+
+    /// Number of packets overwritten (Force) or rejected (Try) because the queue was full.
+    uint64_t droppedPackets() const noexcept { return _droppedPackets; }
+
+    void reset() noexcept override final
+    {
+        LockGuard lock(_mutex);
+        // Stop at the first packet still being put; the rest are newer.
+        while (_headIsReady())
+        {
+            Element& element = *_elements[_pop()];
+            element.item.releaseShared();
+            element.status = Element::Status::Free;
+        }
+    }
+
+    void setPutMode(PutMode mode) noexcept override final
+    {
+        LockGuard lock(_mutex);
+        _putMode = mode;
+    }
+
+    uint16_t size() const noexcept override final
+    {
+        LockGuard lock(_mutex);
+        uint16_t queueSize = _count;
+        for (uint16_t i = 0; i < _count; ++i)
+        {
+            if (_elements[_ring[_wrap(_head + i)]]->status == Element::Status::Putting) { --queueSize; }
+        }
+        return queueSize;
+    }
+
+    bool isEmpty() const noexcept override final { return (size() == 0); }
+
+    uint16_t capacity() const noexcept override final { return static_cast<uint16_t>(_elements.size()); }
+
+protected:
+    void _releaseElement(Element& element) noexcept override
+    {
+        if (element.status == Element::Status::Getting)
+        {
+            element.item.releaseShared();  // Before the slot can be put again
+            element.status = Element::Status::Free;
+            _notifySpaceAvailable();
+            return;
+        }
+        element.status = Element::Status::InQueue;
+        LockGuard lock(_mutex);
+#if THREADING_ENABLE
+        if (_consumerWaiting) { _dataAvailable.notify_all(); }
+#endif
+        if (_onData) { _onData(); }
+    }
+
+private:
+    std::atomic<PutMode> _putMode;
+    PacketSlab _packetSlab;                           // Must outlive the packets in _elements
+    std::vector<std::unique_ptr<Element>> _elements;  // Elements are neither movable nor copyable
+    std::vector<uint16_t> _ring;                      // Element indices in put order
+    uint16_t _head = 0;
+    uint16_t _count = 0;
+    uint16_t _nextFree = 0;
+    std::vector<uint16_t> _batch;
+    std::atomic<uint64_t> _droppedPackets = 0;
+    DataCallback _onData;
+    mutable Mutex _mutex;
+#if THREADING_ENABLE
+    std::condition_variable_any _dataAvailable;
+    std::condition_variable_any _spaceAvailable;
+    bool _consumerWaiting = false;
+    bool _woken = false;
+#endif
+
+    static bool _usesSlab(const uint16_t packetCapacity) noexcept { return packetCapacity >= sizeof(uint8_t*); }
+
+    uint16_t _wrap(const uint32_t idx) const noexcept { return static_cast<uint16_t>(idx % _elements.size()); }
+
+    bool _headIsReady() const noexcept { return _count > 0 && _elements[_ring[_head]]->status == Element::Status::InQueue; }
+
+    uint16_t _pop() noexcept
+    {
+        const uint16_t idx = _ring[_head];
+        _head = _wrap(_head + 1);
+        --_count;
+        return idx;
+    }
+
+    void _push(const uint16_t idx) noexcept
+    {
+        _ring[_wrap(_head + _count)] = idx;
+        ++_count;
+    }
+
+    Element* _tryPut() noexcept
+    {
+        // Slots are mostly freed in put order, so searching from the last slot handed out finds one immediately.
+        for (uint16_t i = 0; i < _elements.size(); ++i)
+        {
+            const uint16_t idx = _wrap(_nextFree + i);
+            if (_elements[idx]->status == Element::Status::Free)
+            {
+                _elements[idx]->status = Element::Status::Putting;
+                _push(idx);
+                _nextFree = _wrap(idx + 1);
+                return _elements[idx].get();
+            }
+        }
+        return nullptr;
+    }
+
+    void _notifySpaceAvailable() noexcept
+    {
+#if THREADING_ENABLE
+        if (_putMode != PutMode::Retry) { return; }
+        // Taking the lock orders this with a producer that has just found the queue full and is about to wait.
+        LockGuard lock(_mutex);
+        _spaceAvailable.notify_all();
+#endif
+    }
+};
+
+}  // namespace DataExport
+}  // namespace VN
+
+#endif  // VN_EXPORTERQUEUE_HPP_
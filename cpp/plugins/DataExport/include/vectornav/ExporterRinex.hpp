@@ -24,7 +24,10 @@
 #ifndef VN_EXPORTERRINEX_HPP_
 #define VN_EXPORTERRINEX_HPP_
 
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstring>
 #include <ctime>
 #include <limits>
 
@@ -36,251 +39,393 @@
 #include "vectornav/Implementation/FaPacketProtocol.hpp"
 #include "vectornav/Implementation/MeasurementDatatypes.hpp"
 #include "vectornav/Implementation/QueueDefinitions.hpp"
-#include "vectornav/Interface/CompositeData.hpp"
-#include "vectornav/TemplateLibrary/ByteBuffer.hpp"
 
 namespace VN
 {
-static_assert((GNSS_GROUP_ENABLE & GNSS_GNSS1RAWMEAS_BIT) | (GNSS2_GROUP_ENABLE & GNSS2_GNSS2RAWMEAS_BIT), "GNSS raw meas is not enabled");
-
 namespace DataExport
 {
 
+/// @brief Writes GnssRawMeas to a RINEX 3.03 observation file.
+/// RawMeas is decoded straight from the queued packet bytes, so it does not need to be enabled in the CompositeData configuration. The header is written
+/// when the file is opened, with a fixed-size block of COMMENT lines that finalize() overwrites in place with the observation types and time span.
 class ExporterRinex : public Exporter
 {
 private:
-    static constexpr uint16_t EXPORTER_PACKET_CAPACITY = 2048;
-    static constexpr uint16_t STRING_BUFFER_CAPACITY = 1024;
+    static constexpr uint16_t EXPORTER_PACKET_CAPACITY = 0;  // Packets reference the dispatcher's shared buffers
+    static constexpr size_t OUTPUT_BUFFER_CAPACITY = 65536;
+    static constexpr uint8_t HEADER_LINE_LENGTH = 81;  // 80 columns and the newline
+    static constexpr uint8_t OBS_TYPES_PER_LINE = 13;
+    static constexpr uint8_t OBSERVABLES_PER_SIGNAL = 4;
+    static constexpr uint8_t OBSERVABLE_WIDTH = 14;
+    static constexpr uint8_t RAW_MEAS_FIELD = 16;
+    static constexpr uint8_t RAW_MEAS_HEADER_SIZE = 12;
+    static constexpr uint8_t RAW_MEAS_ENTRY_SIZE = 28;
+
+    static constexpr double GPS_C = 299792458.0;
+    static constexpr std::array<char, 9> sysId = {'G', 'S', 'E', 'C', 'X', 'J', 'R', 'I', 'L'};
+    static constexpr std::array<char, 15> chanCode = {'P', 'C', 'D', 'Y', 'M', 'N', 'A', 'B', 'I', 'Q', 'S', 'L', 'X', 'W', 'Z'};
+
+    static constexpr uint8_t HEADER_PREFIX_LINES = 2;  // RINEX VERSION / TYPE and PGM / RUN BY / DATE
+    static constexpr uint16_t RESERVED_HEADER_LINES =
+        sysId.size() * ((chanCode.size() * OBSERVABLES_PER_SIGNAL + OBS_TYPES_PER_LINE - 1) / OBS_TYPES_PER_LINE) + 2;  // + TIME OF FIRST / LAST OBS
 
 public:
-    ExporterRinex(const Filesystem::FilePath& fileName, const uint32_t gnssGroup, PacketQueueMode mode = PacketQueueMode::Force)
-        : Exporter(EXPORTER_PACKET_CAPACITY, mode), _fileName(fileName), _gnssGroup(gnssGroup)
+    ExporterRinex(const Filesystem::FilePath& fileName, const uint32_t gnssGroup, PacketQueueMode mode = PacketQueueMode::Force,
+                  const uint16_t queueCapacity = DEFAULT_QUEUE_CAPACITY)
+        : Exporter(EXPORTER_PACKET_CAPACITY, mode, queueCapacity), _fileName(fileName)
     {
         switch (gnssGroup)
         {
             case 1:
             {
                 _fileName = _fileName + "-1";
-                _gnssGroup = GNSS_BIT;
+                _gnssGroupIndex = 3;
                 break;
             }
             case 2:
             {
                 _fileName = _fileName + "-2";
-                _gnssGroup = GNSS2_BIT;
+                _gnssGroupIndex = 6;
                 break;
             }
             default:
                 VN_ABORT();
         }
         _file.open(_fileName + ".obs");
-        for (int i = 0; i < 16; i++) { _file.write("                                                                                \n"); }
+        _writeHeader();
     }
 
     ~ExporterRinex() { finalize(); }
 
     void finalize()
     {
-        _file.reset();
+        if (!_file.is_open()) { return; }
+        _flushOutput();
 
-        size_t bytesWritten = 0;
-
-        time_t now = time(0);
-        std::tm tm{};
-        tm = *gmtime(&now);
-
-        bytesWritten += std::sprintf(buffer + bytesWritten, "     3.03           OBSERVATION DATA    M: Mixed            RINEX VERSION / TYPE\n");
-        bytesWritten += std::sprintf(buffer + bytesWritten, "%-40s%04d%02d%02d %02d%02d%02d UTC %-20s\n", "VNSDK File Export", tm.tm_year + 1900, tm.tm_mon + 1,
-                                     tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec, "GM / RUN BY / DATE");
-
-        bytesWritten += std::sprintf(buffer + bytesWritten, "%60c%-20s\n", ' ', "MARKER NAME");
-        bytesWritten += std::sprintf(buffer + bytesWritten, "%60c%-20s\n", ' ', "MARKER NUMBER");
-        bytesWritten += std::sprintf(buffer + bytesWritten, "%60c%-20s\n", ' ', "OBSERVER / AGENCY");
-        bytesWritten += std::sprintf(buffer + bytesWritten, "%60c%-20s\n", ' ', "REC # / TYPE / VERS");
-        bytesWritten += std::sprintf(buffer + bytesWritten, "%60c%-20s\n", ' ', "ANT # / TYPE");
-        bytesWritten += std::sprintf(buffer + bytesWritten, "%14.4f%14.4f%14.4f                  %-20s\n", 0.0, 0.0, 0.0, "APPROX POSITION XYZ");
-        bytesWritten += std::sprintf(buffer + bytesWritten, "%14.4f%14.4f%14.4f                  %-20s\n", 0.0, 0.0, 0.0, "ANTENNA: DELTA H/E/N");
-
-        uint8_t idx = 0;
-        for (const auto& signals : _trackedSatelliteInfo)
+        if (lastTimeGps != 0)
         {
-            size_t offset = bytesWritten;
-
-            const uint8_t num_signals = signals.size() - std::count(signals.begin(), signals.end(), 0);
-
-            if (num_signals == 0) continue;
-
-            bytesWritten += std::sprintf(buffer + bytesWritten, "%c  %3d", sysId[idx++], num_signals * 4);
+            std::array<char, (HEADER_PREFIX_LINES + RESERVED_HEADER_LINES) * HEADER_LINE_LENGTH + 1> header;
+            std::memcpy(header.data(), _headerPrefix.data(), _headerPrefix.size());
+            char* line = header.data() + _headerPrefix.size();
+            char* const regionEnd = line + RESERVED_HEADER_LINES * HEADER_LINE_LENGTH;
 
-            for (uint8_t i = 0; i < signals.size(); i++)
+            for (uint8_t sys = 0; sys < sysId.size(); sys++)
             {
-                if (signals[i] == 0) continue;
-                const uint8_t chan = chanCode[i];
-                const uint8_t freq = signals[i];
-                bytesWritten += std::sprintf(buffer + bytesWritten, " C%u%c L%u%c D%u%c S%u%c", freq, chan, freq, chan, freq, chan, freq, chan);
+                const auto& signals = _trackedSatelliteInfo[sys];
+                const uint8_t num_signals = static_cast<uint8_t>(signals.size() - std::count(signals.begin(), signals.end(), 0));
+                if (num_signals == 0) { continue; }
+
+                std::array<char, OBS_TYPES_PER_LINE * 6 + 7> types;  // Room for three-digit bands; the line is cut to 60 columns
+                int typesLength = std::snprintf(types.data(), types.size(), "%c  %3d", sysId[sys], num_signals * OBSERVABLES_PER_SIGNAL);
+                uint8_t typesOnLine = 0;
+                for (uint8_t i = 0; i < signals.size(); i++)
+                {
+                    if (signals[i] == 0) { continue; }
+                    for (const char observable : {'C', 'L', 'D', 'S'})
+                    {
+                        if (typesOnLine == OBS_TYPES_PER_LINE)
+                        {
+                            line = _writeHeaderLine(line, types.data(), "SYS / # / OBS TYPES");
+                            typesLength = std::snprintf(types.data(), types.size(), "      ");
+                            typesOnLine = 0;
+                        }
+                        typesLength += std::snprintf(types.data() + typesLength, types.size() - typesLength, " %c%u%c", observable, signals[i], chanCode[i]);
+                        ++typesOnLine;
+                    }
+                }
+                line = _writeHeaderLine(line, types.data(), "SYS / # / OBS TYPES");
             }
 
-            bytesWritten += std::sprintf(buffer + bytesWritten, "%*c%-20s\n", static_cast<int>(60 - (bytesWritten - offset)), ' ', "SYS / # / OBS TYPES");
-        }
-
-        tm = *gmtime(&firstTimeGps);
-        bytesWritten += std::sprintf(buffer + bytesWritten, "%6d%6d%6d%6d%6d%5d.0000000%8s         %-20s\n", tm.tm_year + 1900, tm.tm_mon, tm.tm_mday,
-                                     tm.tm_hour, tm.tm_min, tm.tm_sec, "GPS", "TIME OF FIRST OBS");
-        tm = *gmtime(&lastTimeGps);
-        bytesWritten += std::sprintf(buffer + bytesWritten, "%6d%6d%6d%6d%6d%5d.0000000%8s         %-20s\n", tm.tm_year + 1900, tm.tm_mon, tm.tm_mday,
-                                     tm.tm_hour, tm.tm_min, tm.tm_sec, "GPS", "TIME OF LAST OBS");
-
-        bytesWritten += std::sprintf(buffer + bytesWritten, "%-60c%-20s\n", 'G', "SYS / PHASE SHIFT");
-        bytesWritten += std::sprintf(buffer + bytesWritten, "%-60c%-20s\n", 'E', "SYS / PHASE SHIFT");
-        bytesWritten += std::sprintf(buffer + bytesWritten, "%-60c%-20s\n", ' ', "END OF HEADER");
+            line = _writeTimeHeaderLine(line, firstTimeGps, "TIME OF FIRST OBS");
+            line = _writeTimeHeaderLine(line, lastTimeGps, "TIME OF LAST OBS");
+            while (line < regionEnd) { line = _writeHeaderLine(line, "", "COMMENT"); }
 
-        _file.write(buffer, bytesWritten);
+            _file.reset();
+            _file.write(header.data(), header.size() - 1);
+        }
 
         _file.close();
     }
 
     void exportToFile() override
     {
-        while (!_queue.isEmpty())
+        _queue.consumeAll(
+            [this](const Packet& p)
+            {
+                if (p.details.syncByte != PacketDetails::SyncByte::FA) { return; }
 
-        {
-            // VN_PROFILER_TIME_CURRENT_SCOPE();
-            const auto p = _queue.get();
-            if (!p) { continue; }
+                const uint8_t* rawMeasField = _findRawMeas(p);
+                if (rawMeasField == nullptr || _decodeRawMeas(rawMeasField, p.buffer + p.details.faMetadata.length)) { return; }
+                _writeEpoch();
+            });
+        _flushOutput();
+    }
+
+private:
+    char _outputBuffer[OUTPUT_BUFFER_CAPACITY];
+    size_t _outputSize = 0;
+    std::array<char, HEADER_PREFIX_LINES * HEADER_LINE_LENGTH> _headerPrefix{};
+    time_t firstTimeGps = std::numeric_limits<time_t>::max();
+    time_t lastTimeGps = 0;
+    Filesystem::FilePath _fileName;
+    OutputFile _file;
+    uint8_t _gnssGroupIndex;
+    GnssRawMeas _rawMeas;
 
-            if (!p->details.faMetadata.header.contains(_gnssGroup, static_cast<uint32_t>(GNSS_GNSS1RAWMEAS_BIT))) { continue; }
+    std::array<std::array<uint8_t, chanCode.size()>, sysId.size()> _trackedSatelliteInfo{};
 
-            ByteBuffer byteBuffer(p->buffer, p->capacity, p->capacity);
+    static char* _writeHeaderLine(char* line, const char* content, const char* label) noexcept
+    {
+        std::snprintf(line, HEADER_LINE_LENGTH + 1, "%-60.60s%-20.20s\n", content, label);
+        return line + HEADER_LINE_LENGTH;
+    }
 
-            const auto cdOpt = FaPacketProtocol::parsePacket(byteBuffer, 0, p->details.faMetadata, Config::PacketDispatchers::cdEnabledMeasTypes);
-            if (!cdOpt) continue;
-            const auto cd = cdOpt.value();
+    static char* _writeTimeHeaderLine(char* line, const time_t timeGps, const char* label) noexcept
+    {
+        const std::tm tm = *gmtime(&timeGps);
+        char content[61];
+        std::snprintf(content, sizeof(content), "%6d%6d%6d%6d%6d%5d.0000000%8s", tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min,
+                      tm.tm_sec, "GPS");
+        return _writeHeaderLine(line, content, label);
+    }
 
-            const GnssRawMeas& gnssRawMeas = [](const CompositeData& cd, const uint8_t _gnssGroup) -> const GnssRawMeas&
-            {
-                switch (_gnssGroup)
-                {
-#if (GNSS_GROUP_ENABLE & GNSS_GNSS1RAWMEAS_BIT)
-                    case GNSS_BIT:
-                        return cd.gnss.gnss1RawMeas.value();
-#endif
-#if (GNSS2_GROUP_ENABLE & GNSS2_GNSS2RAWMEAS_BIT)
-                    case GNSS2_BIT:
-                        return cd.gnss2.gnss2RawMeas.value();
-#endif
-                    default:
-                        VN_ABORT();
-                }
-            }(cd, _gnssGroup);
+    void _writeHeader()
+    {
+        const time_t now = time(0);
+        const std::tm tm = *gmtime(&now);
+        char content[61];
+
+        char* line = _outputBuffer;
+        line = _writeHeaderLine(line, "     3.03           OBSERVATION DATA    M: Mixed", "RINEX VERSION / TYPE");
+        std::snprintf(content, sizeof(content), "%-40s%04d%02d%02d %02d%02d%02d UTC", "VNSDK File Export", tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday,
+                      tm.tm_hour, tm.tm_min, tm.tm_sec);
+        line = _writeHeaderLine(line, content, "PGM / RUN BY / DATE");
+        std::memcpy(_headerPrefix.data(), _outputBuffer, _headerPrefix.size());
+
+        for (uint16_t i = 0; i < RESERVED_HEADER_LINES; i++) { line = _writeHeaderLine(line, "", "COMMENT"); }
+        line = _writeHeaderLine(line, "", "MARKER NAME");
+        line = _writeHeaderLine(line, "", "MARKER NUMBER");
+        line = _writeHeaderLine(line, "", "OBSERVER / AGENCY");
+        line = _writeHeaderLine(line, "", "REC # / TYPE / VERS");
+        line = _writeHeaderLine(line, "", "ANT # / TYPE");
+        std::snprintf(content, sizeof(content), "%14.4f%14.4f%14.4f", 0.0, 0.0, 0.0);
+        line = _writeHeaderLine(line, content, "APPROX POSITION XYZ");
+        line = _writeHeaderLine(line, content, "ANTENNA: DELTA H/E/N");
+        line = _writeHeaderLine(line, "G", "SYS / PHASE SHIFT");
+        line = _writeHeaderLine(line, "E", "SYS / PHASE SHIFT");
+        line = _writeHeaderLine(line, "", "END OF HEADER");
+        _outputSize = line - _outputBuffer;
+        _flushOutput();
+    }
 
-            const auto num_meas = gnssRawMeas.numMeas;
-            if (num_meas == 0) continue;
+    const uint8_t* _findRawMeas(const Packet& packet) const noexcept
+    {
+        const FaPacketProtocol::Metadata& metadata = packet.details.faMetadata;
+        FaPacketExtractor extractor(packet.buffer, metadata);
+        if (extractor.discard(metadata.header.size() + 1)) { return nullptr; }
 
-            std::array<int, GNSS_RAW_MEAS_MAX_COUNT> index;
-            for (int i = 0; i < num_meas; i++) { index[i] = i; }
+        BinaryHeaderIterator iter(metadata.header);
+        while (iter.next())
+        {
+            if (iter.group() == _gnssGroupIndex && iter.field() == RAW_MEAS_FIELD) { return packet.buffer + extractor.index(); }
+            if (extractor.discard(iter.group(), iter.field())) { return nullptr; }
+        }
+        return nullptr;
+    }
 
-            // sort based on sys -> svId -> freq
-            std::sort(index.begin(), index.begin() + num_meas,
-                      [&](int i, int j)
-                      {
-                          return static_cast<uint64_t>((gnssRawMeas.sys[i] << 24) | (gnssRawMeas.svId[i] << 16) | (gnssRawMeas.band[i] << 8)) <
-                                 static_cast<uint64_t>((gnssRawMeas.sys[j] << 24) | (gnssRawMeas.svId[j] << 16) | (gnssRawMeas.band[j] << 8));
-                      });
+    Errored _decodeRawMeas(const uint8_t* field, const uint8_t* packetEnd) noexcept
+    {
+        if (field + RAW_MEAS_HEADER_SIZE > packetEnd) { return true; }
+        std::memcpy(&_rawMeas.tow, field, sizeof(_rawMeas.tow));
+        std::memcpy(&_rawMeas.week, field + 8, sizeof(_rawMeas.week));
+        _rawMeas.numMeas = field[10];
+        if ((_rawMeas.numMeas > _rawMeas.sys.size()) || (field + RAW_MEAS_HEADER_SIZE + RAW_MEAS_ENTRY_SIZE * _rawMeas.numMeas > packetEnd)) { return true; }
+
+        const uint8_t* entry = field + RAW_MEAS_HEADER_SIZE;
+        for (uint8_t i = 0; i < _rawMeas.numMeas; i++, entry += RAW_MEAS_ENTRY_SIZE)
+        {
+            _rawMeas.sys[i] = entry[0];
+            _rawMeas.svId[i] = entry[1];
+            _rawMeas.band[i] = entry[2];
+            _rawMeas.chan[i] = entry[3];
+            _rawMeas.cno[i] = entry[5];
+            std::memcpy(&_rawMeas.pr[i], entry + 8, sizeof(double));
+            std::memcpy(&_rawMeas.cp[i], entry + 16, sizeof(double));
+            std::memcpy(&_rawMeas.dp[i], entry + 24, sizeof(float));
+            if (_rawMeas.sys[i] >= sysId.size() || _rawMeas.chan[i] >= chanCode.size()) { return true; }
+        }
+        return false;
+    }
 
-            uint8_t num_sats = 0;
-            for (size_t i = 0; i < num_meas; i++)
+    void _writeEpoch() noexcept
+    {
+        const GnssRawMeas& gnssRawMeas = _rawMeas;
+        const auto num_meas = gnssRawMeas.numMeas;
+        if (num_meas == 0) { return; }
+
+        std::array<int, GNSS_RAW_MEAS_MAX_COUNT> index;
+        for (int i = 0; i < num_meas; i++) { index[i] = i; }
+
+        // sort based on sys -> svId -> freq
+        std::sort(index.begin(), index.begin() + num_meas,
+                  [&](int i, int j)
+                  {
+                      return static_cast<uint64_t>((gnssRawMeas.sys[i] << 24) | (gnssRawMeas.svId[i] << 16) | (gnssRawMeas.band[i] << 8)) <
+                             static_cast<uint64_t>((gnssRawMeas.sys[j] << 24) | (gnssRawMeas.svId[j] << 16) | (gnssRawMeas.band[j] << 8));
+                  });
+
+        uint8_t num_sats = 0;
+        for (size_t i = 0; i < num_meas; i++)
+        {
+            _trackedSatelliteInfo[gnssRawMeas.sys[i]][gnssRawMeas.chan[i]] = gnssRawMeas.band[i];
+            if (i == 0 ||
+                ((gnssRawMeas.svId[index[i]] << 8) | gnssRawMeas.sys[index[i]]) != ((gnssRawMeas.svId[index[i - 1]] << 8) | gnssRawMeas.sys[index[i - 1]]))
             {
-                _trackedSatelliteInfo[gnssRawMeas.sys[i]][gnssRawMeas.chan[i]] = gnssRawMeas.band[i];
-                if (i == 0 ||
-                    ((gnssRawMeas.svId[index[i]] << 8) | gnssRawMeas.sys[index[i]]) != ((gnssRawMeas.svId[index[i - 1]] << 8) | gnssRawMeas.sys[index[i - 1]]))
-                {
-                    num_sats++;
-                }
+                num_sats++;
             }
+        }
 
-            size_t bytesToWrite = 0;
+        constexpr uint64_t gpsWeekToSeconds = 7 * 24 * 3600;
 
-            constexpr uint64_t gpsWeekToSeconds = 7 * 24 * 3600;
+        double seconds = 0;
+        double timeleft = std::modf(gnssRawMeas.tow, &seconds);
+        double timeTarget = static_cast<uint64_t>((timeleft * 10) + 0.5) / 10.0;
+        if (timeTarget >= 1.0)
+        {
+            timeTarget -= 1.0;
+            seconds += 1;
+            timeleft = gnssRawMeas.tow - seconds;
+        }
+        uint64_t subseconds = static_cast<uint64_t>(timeTarget * 10000000);
 
-            double seconds = 0;
-            double timeleft = std::modf(gnssRawMeas.tow, &seconds);
-            double timeTarget = static_cast<uint64_t>((timeleft * 10) + 0.5) / 10.0;
-            if (timeTarget >= 1.0)
-            {
-                timeTarget -= 1.0;
-                seconds += 1;
-                timeleft = gnssRawMeas.tow - seconds;
-            }
-            uint64_t subseconds = static_cast<uint64_t>(timeTarget * 10000000);
+        double compMeters = (timeleft - timeTarget) * GPS_C;
 
-            double compMeters = (timeleft - timeTarget) * GPS_C;
+        // First GPS Epoch: January 6 1980 00:00:00
+        // FIrst UTC Epoch: January 1 1970 00:00:00
+        // gmtime uses UTC time, so we must add an offset to get the equivalent GPS Time
+        // 315964800 = (10 * 365 + 7)*24*3600
+        time_t timeGps = static_cast<uint64_t>(seconds) + gnssRawMeas.week * gpsWeekToSeconds + 315964800;
 
-            // First GPS Epoch: January 6 1980 00:00:00
-            // FIrst UTC Epoch: January 1 1970 00:00:00
-            // gmtime uses UTC time, so we must add an offset to get the equivalent GPS Time
-            // 315964800 = (10 * 365 + 7)*24*3600
-            time_t timeGps = static_cast<uint64_t>(seconds) + gnssRawMeas.week * gpsWeekToSeconds + 315964800;
+        firstTimeGps = std::min(firstTimeGps, timeGps);
+        lastTimeGps = timeGps;
 
-            firstTimeGps = std::min(firstTimeGps, timeGps);
-            lastTimeGps = timeGps;
+        std::tm tm{};
+        tm = *gmtime(&timeGps);
 
-            std::tm tm{};
-            tm = *gmtime(&timeGps);
+        _reserveOutput(64);
+        _outputSize += std::snprintf(_outputBuffer + _outputSize, 64, "> %4d %2d %2d %2d %2d %2d.%07d  0 %2d\n", tm.tm_year + 1900, tm.tm_mon + 1,
+                                     tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec, static_cast<int>(subseconds), num_sats);
 
-            bytesToWrite += std::sprintf(buffer, "> %4d %2d %2d %2d %2d %2d.%07d  0 %2d\n", tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min,
-                                         tm.tm_sec, static_cast<int>(subseconds), num_sats);
+        uint8_t i = 0;
+        while (i < num_meas)
+        {
+            // we are either at the first frquency or we are at the second
+            const auto currSatIndex = index[i];
 
-            uint8_t i = 0;
-            while (i < num_meas)
+            Vector<uint8_t, 3> trackedBands;
+            const uint16_t currId = (gnssRawMeas.svId[currSatIndex] << 8) | gnssRawMeas.sys[currSatIndex];
+            for (uint8_t j = i; j < num_meas; j++)
             {
-                // we are either at the first frquency or we are at the second
-                const auto currSatIndex = index[i];
-                bytesToWrite += std::sprintf(buffer + bytesToWrite, "%c%02d", sysId[gnssRawMeas.sys[currSatIndex]], gnssRawMeas.svId[currSatIndex] % 100);
+                const auto nextSatIndex = index[j];
+                const uint16_t nextId = (gnssRawMeas.svId[nextSatIndex] << 8) | gnssRawMeas.sys[nextSatIndex];
 
-                Vector<uint8_t, 3> trackedBands;
-                const uint16_t currId = (gnssRawMeas.svId[currSatIndex] << 8) | gnssRawMeas.sys[currSatIndex];
-                for (uint8_t j = i; j < num_meas; j++)
-                {
-                    const auto nextSatIndex = index[j];
-                    const uint16_t nextId = (gnssRawMeas.svId[nextSatIndex] << 8) | gnssRawMeas.sys[nextSatIndex];
+                if (currId != nextId || gnssRawMeas.band[nextSatIndex] == 255) break;
 
-                    if (currId != nextId || gnssRawMeas.band[nextSatIndex] == 255) break;
+                if (gnssRawMeas.band[nextSatIndex] == 7) { trackedBands.push_back(1); }
+                else { trackedBands.push_back(gnssRawMeas.band[nextSatIndex] - 1); }
+            }
 
-                    if (gnssRawMeas.band[nextSatIndex] == 7) { trackedBands.push_back(1); }
-                    else { trackedBands.push_back(gnssRawMeas.band[nextSatIndex] - 1); }
-                }
+            const auto num_pad = trackedBands[0];
+            constexpr uint8_t signalWidth = OBSERVABLES_PER_SIGNAL * OBSERVABLE_WIDTH;
+            _reserveOutput(3 + signalWidth * (num_pad + trackedBands.size()) + 1);
 
-                const auto num_pad = trackedBands[0];
-                for (uint8_t j = 0; j < num_pad; j++) { bytesToWrite += std::sprintf(buffer + bytesToWrite, "%*c", 56, ' '); }
+            char* out = _outputBuffer + _outputSize;
+            *out++ = sysId[gnssRawMeas.sys[currSatIndex]];
+            *out++ = static_cast<char>('0' + (gnssRawMeas.svId[currSatIndex] % 100) / 10);
+            *out++ = static_cast<char>('0' + gnssRawMeas.svId[currSatIndex] % 10);
 
-                for (uint8_t j = 0; j < trackedBands.size(); j++)
-                {
-                    const auto idx = index[i++];
-                    bytesToWrite += std::sprintf(buffer + bytesToWrite, "%14.3f%14.3f%14.3f%14.3f", gnssRawMeas.pr[idx] - compMeters, gnssRawMeas.cp[idx],
-                                                 gnssRawMeas.dp[idx], static_cast<float>(gnssRawMeas.cno[idx]));
-                }
+            std::memset(out, ' ', signalWidth * num_pad);
+            out += signalWidth * num_pad;
 
-                buffer[bytesToWrite++] = '\n';
-                _file.write(buffer, bytesToWrite);
-                bytesToWrite = 0;
+            for (uint8_t j = 0; j < trackedBands.size(); j++)
+            {
+                const auto idx = index[i++];
+                out = _writeFixed<OBSERVABLE_WIDTH, 3>(out, gnssRawMeas.pr[idx] - compMeters);
+                out = _writeFixed<OBSERVABLE_WIDTH, 3>(out, gnssRawMeas.cp[idx]);
+                out = _writeFixed<OBSERVABLE_WIDTH, 3>(out, gnssRawMeas.dp[idx]);
+                out = _writeFixed<OBSERVABLE_WIDTH, 3>(out, static_cast<float>(gnssRawMeas.cno[idx]));
             }
+
+            *out++ = '\n';
+            _outputSize = out - _outputBuffer;
         }
     }
 
-private:
-    static constexpr const char* observablesFormat = "%14.3f%14.3f%14.3f%14.3f";
-    static constexpr double GPS_C = 299792458.0;
-    static constexpr std::array<char, 9> sysId = {'G', 'S', 'E', 'C', 'X', 'J', 'R', 'I', 'L'};
-    static constexpr std::array<char, 15> chanCode = {'P', 'C', 'D', 'Y', 'M', 'N', 'A', 'B', 'I', 'Q', 'S', 'L', 'X', 'W', 'Z'};
+    /// @brief Right-aligns value in Width columns with Decimals fractional digits, producing the same characters as "%<Width>.<Decimals>f".
+    /// The remainder after scaling is computed exactly with fma; only values that land on a rounding tie, or are too large, are left to printf.
+    template <uint8_t Width, uint8_t Decimals>
+    static char* _writeFixed(char* out, const double value) noexcept
+    {
+        constexpr double scale = []() constexpr
+        {
+            double s = 1.0;
+            for (uint8_t i = 0; i < Decimals; i++) { s *= 10.0; }
+            return s;
+        }();
+
+        const double magnitude = std::fabs(value);
+        double integral = std::floor(magnitude * scale);
+        double remainder = std::fma(magnitude, scale, -integral);
+        if (remainder < 0.0)
+        {
+            integral -= 1.0;
+            remainder += 1.0;
+        }
 
-    char buffer[STRING_BUFFER_CAPACITY];
-    time_t firstTimeGps = std::numeric_limits<time_t>::max();
-    time_t lastTimeGps = 0;
-    Filesystem::FilePath _fileName;
-    OutputFile _file;
-    uint32_t _gnssGroup;
+        if (!(magnitude * scale < 9e15) || remainder == 0.5)
+        {
+            char tmp[Width + 320];
+            const int length = std::snprintf(tmp, sizeof(tmp), "%*.*f", Width, Decimals, value);
+            std::memcpy(out, tmp, length);
+            return out + length;
+        }
 
-    std::array<std::array<uint8_t, chanCode.size()>, sysId.size()> _trackedSatelliteInfo{};
+        uint64_t scaled = static_cast<uint64_t>(integral) + (remainder > 0.5 ? 1 : 0);
+        char digits[24];
+        char* p = digits + sizeof(digits);
+        for (uint8_t i = 0; i < Decimals; i++)
+        {
+            *--p = static_cast<char>('0' + scaled % 10);
+            scaled /= 10;
+        }
+        if constexpr (Decimals > 0) { *--p = '.'; }
+        do {
+            *--p = static_cast<char>('0' + scaled % 10);
+            scaled /= 10;
+        } while (scaled != 0);
+        if (std::signbit(value)) { *--p = '-'; }
+
+        const size_t length = digits + sizeof(digits) - p;
+        if (length < Width)
+        {
+            std::memset(out, ' ', Width - length);
+            out += Width - length;
+        }
+        std::memcpy(out, p, length);
+        return out + length;
+    }
+
+    void _reserveOutput(const size_t numBytes) noexcept
+    {
+        if (_outputSize + numBytes > OUTPUT_BUFFER_CAPACITY) { _flushOutput(); }
+    }
+
+    void _flushOutput() noexcept
+    {
+        if (_outputSize == 0) { return; }
+        _file.write(_outputBuffer, _outputSize);
+        _outputSize = 0;
+    }
 };
 
 }  // namespace DataExport
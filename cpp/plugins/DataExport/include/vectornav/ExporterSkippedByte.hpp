@@ -41,8 +41,9 @@ private:
     static constexpr uint16_t EXPORTER_PACKET_CAPACITY = 2048;
 
 public:
-    ExporterSkippedByte(const Filesystem::FilePath& outputDir, PacketQueueMode mode = PacketQueueMode::Force)
-        : Exporter(EXPORTER_PACKET_CAPACITY, mode), _filePath(outputDir)
+    ExporterSkippedByte(const Filesystem::FilePath& outputDir, PacketQueueMode mode = PacketQueueMode::Force,
+                        const uint16_t queueCapacity = DEFAULT_QUEUE_CAPACITY)
+        : Exporter(EXPORTER_PACKET_CAPACITY, mode, queueCapacity), _filePath(outputDir)
     {
         if (!_filePath.empty() && _filePath.back() != std::filesystem::path::preferred_separator)
         {
@@ -53,13 +54,13 @@ public:
     void exportToFile() override
     {
         if (!_file.is_open() && _init_file()) { return; }
-        while (!_queue.isEmpty())
-        {
-            const auto p = _queue.get();
-            if (!p || (p->details.syncByte != PacketDetails::SyncByte::None)) { continue; }
+        _queue.consumeAll(
+            [this](const Packet& p)
+            {
+                if (p.details.syncByte != PacketDetails::SyncByte::None) { return; }
 
-            _file.write(reinterpret_cast<const char*>(p->buffer), p->length());
-        }
+                _file.write(reinterpret_cast<const char*>(p.buffer), p.length());
+            });
     }
 
 private:
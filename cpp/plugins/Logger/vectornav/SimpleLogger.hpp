@@ -26,6 +26,7 @@
 
 #include <cstdint>
 
+#include "vectornav/Debug.hpp"
 #include "vectornav/HAL/File.hpp"
 #include "vectornav/HAL/Thread.hpp"
 #include "vectornav/TemplateLibrary/ByteBuffer.hpp"
@@ -144,11 +145,15 @@ protected:
      */
     void _log()
     {
+        VN_PROFILER_SET_THREAD_NAME("Logger");
         while (_logging)
         {
-            int32_t numBytes = logBuffer(_logFile, _bufferToLog);
-            if (numBytes < 0) { _writeErrorCount++; }
-            else { _numBytesLogged += numBytes; }
+            {
+                VN_PROFILER_TIME_SCOPE("SimpleLogger::logBuffer");
+                int32_t numBytes = logBuffer(_logFile, _bufferToLog);
+                if (numBytes < 0) { _writeErrorCount++; }
+                else { _numBytesLogged += numBytes; }
+            }
             thisThread::sleepFor(sleepDuration);
         }
         int32_t numBytes = logBuffer(_logFile, _bufferToLog);
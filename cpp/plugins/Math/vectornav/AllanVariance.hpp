@@ -0,0 +1,475 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.99.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef VN_ALLANVARIANCE_HPP_
+#define VN_ALLANVARIANCE_HPP_
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+#include "vectornav/Config.hpp"
+#include "vectornav/HAL/Thread.hpp"
+#include "vectornav/Interface/CompositeData.hpp"
+#include "vectornav/Interface/Errors.hpp"
+#include "vectornav/TemplateLibrary/Matrix.hpp"
+
+namespace VN
+{
+namespace Math
+{
+
+/// @brief One point of a stability curve. A deviation is NaN when the data was too short for any term at this cluster size.
+struct AllanDeviationPoint
+{
+    uint64_t clusterSize = 0;                ///< Samples averaged per cluster, m.
+    double tau = 0;                          ///< Averaging time in seconds, m times the sample period.
+    double allanDeviation = 0;               ///< Non-overlapping Allan deviation.
+    double overlappingAllanDeviation = 0;    ///< Overlapping Allan deviation.
+    double hadamardDeviation = 0;            ///< Overlapping Hadamard deviation, which is insensitive to a linear drift of the rate.
+    uint64_t allanTerms = 0;                 ///< Second differences averaged into allanDeviation.
+    uint64_t overlappingAllanTerms = 0;      ///< Second differences averaged into overlappingAllanDeviation.
+    uint64_t hadamardTerms = 0;              ///< Third differences averaged into hadamardDeviation.
+};
+
+/// @brief Roughly log-spaced cluster sizes from one up to maxClusterSize, pointsPerDecade per decade, without duplicates.
+inline std::vector<uint64_t> logSpacedClusterSizes(uint64_t maxClusterSize, uint16_t pointsPerDecade = 10)
+{
+    std::vector<uint64_t> out;
+    const double step = 1.0 / std::max<uint16_t>(pointsPerDecade, 1);
+    for (uint32_t i = 0;; i++)
+    {
+        const uint64_t m = static_cast<uint64_t>(std::llround(std::pow(10.0, i * step)));
+        if (m > maxClusterSize) { break; }
+        if (out.empty() || m != out.back()) { out.push_back(m); }
+    }
+    return out;
+}
+
+namespace Allan
+{
+
+/// Sums of squared phase differences for one cluster size, the state both the batch functions and the streaming analyzer reduce to.
+struct Sums
+{
+    double allan = 0;
+    double overlappingAllan = 0;
+    double hadamard = 0;
+    uint64_t allanTerms = 0;
+    uint64_t overlappingAllanTerms = 0;
+    uint64_t hadamardTerms = 0;
+
+    AllanDeviationPoint toPoint(uint64_t clusterSize, double samplePeriod) const noexcept
+    {
+        const double m2 = static_cast<double>(clusterSize) * static_cast<double>(clusterSize);
+        const auto deviation = [m2](double sum, uint64_t terms, double scale)
+        { return (terms == 0) ? std::numeric_limits<double>::quiet_NaN() : std::sqrt(sum / (scale * m2 * static_cast<double>(terms))); };
+        AllanDeviationPoint out;
+        out.clusterSize = clusterSize;
+        out.tau = static_cast<double>(clusterSize) * samplePeriod;
+        out.allanDeviation = deviation(allan, allanTerms, 2.0);
+        out.overlappingAllanDeviation = deviation(overlappingAllan, overlappingAllanTerms, 2.0);
+        out.hadamardDeviation = deviation(hadamard, hadamardTerms, 6.0);
+        out.allanTerms = allanTerms;
+        out.overlappingAllanTerms = overlappingAllanTerms;
+        out.hadamardTerms = hadamardTerms;
+        return out;
+    }
+};
+
+/**
+ * @brief Integrates rate samples into phase, the cumulative sum every cluster size is then evaluated from in O(N).
+ * The phase is in units of rate times samples and starts at zero. The first rate is subtracted from every sample first: the differences taken
+ * later cancel any constant rate exactly, and removing it keeps the running sum small so long captures do not lose precision.
+ * @param rates First rate sample; sample i is read from rates[i * stride].
+ * @param phase Resized to sampleCount + 1 points.
+ */
+template <typename T>
+void integrate(const T* rates, size_t sampleCount, size_t stride, std::vector<double>& phase)
+{
+    phase.resize(sampleCount + 1);
+    phase[0] = 0;
+    if (sampleCount == 0) { return; }
+    const double offset = static_cast<double>(rates[0]);
+    double sum = 0;
+    for (size_t i = 0; i < sampleCount; i++)
+    {
+        sum += static_cast<double>(rates[i * stride]) - offset;
+        phase[i + 1] = sum;
+    }
+}
+
+/// Adds the overlapping Allan, non-overlapping Allan and overlapping Hadamard terms of one cluster size that start at phase points [begin, end).
+inline void accumulate(const double* phase, size_t phaseCount, uint64_t clusterSize, size_t begin, size_t end, Sums& sums) noexcept
+{
+    const size_t m = static_cast<size_t>(clusterSize);
+    if (m == 0 || phaseCount <= 2 * m) { return; }
+    const size_t allanEnd = std::min(end, phaseCount - 2 * m);
+    const size_t hadamardEnd = std::max(begin, std::min(end, (phaseCount > 3 * m) ? phaseCount - 3 * m : 0));
+    if (begin >= allanEnd) { return; }
+    const double* x0 = phase;
+    const double* x1 = phase + m;
+    const double* x2 = phase + 2 * m;
+    const double* x3 = phase + 3 * m;
+
+    // Independent lanes let the additions vectorize; a single running sum would serialize on its latency.
+    constexpr size_t LANES = 4;
+    std::array<double, LANES> allan{};
+    std::array<double, LANES> hadamard{};
+    size_t k = begin;
+    for (; k + LANES <= hadamardEnd; k += LANES)
+    {
+        for (size_t j = 0; j < LANES; j++)
+        {
+            const double d = x2[k + j] - 2 * x1[k + j] + x0[k + j];
+            const double h = x3[k + j] - 3 * x2[k + j] + 3 * x1[k + j] - x0[k + j];
+            allan[j] += d * d;
+            hadamard[j] += h * h;
+        }
+    }
+    for (; k < hadamardEnd; k++)
+    {
+        const double d = x2[k] - 2 * x1[k] + x0[k];
+        const double h = x3[k] - 3 * x2[k] + 3 * x1[k] - x0[k];
+        allan[0] += d * d;
+        hadamard[0] += h * h;
+    }
+    for (; k < allanEnd; k++)
+    {
+        const double d = x2[k] - 2 * x1[k] + x0[k];
+        allan[0] += d * d;
+    }
+    for (size_t j = 0; j < LANES; j++)
+    {
+        sums.overlappingAllan += allan[j];
+        sums.hadamard += hadamard[j];
+    }
+    sums.overlappingAllanTerms += allanEnd - begin;
+    sums.hadamardTerms += hadamardEnd - begin;
+
+    for (k = (begin + m - 1) / m * m; k < allanEnd; k += m)
+    {
+        const double d = x2[k] - 2 * x1[k] + x0[k];
+        sums.allan += d * d;
+        sums.allanTerms++;
+    }
+}
+
+/**
+ * @brief Sums of the cluster sizes clusterSizes[first], clusterSizes[first + step], ... over phaseCount phase points.
+ * The phase is walked in chunks and every cluster size is evaluated on a chunk before moving on. Clusters shorter than a chunk then read points
+ * that are already in cache, so the whole curve costs about one pass over memory for the short clusters instead of one per cluster size.
+ */
+inline void clusterSums(const double* phase, size_t phaseCount, const std::vector<uint64_t>& clusterSizes, size_t first, size_t step,
+                        std::vector<Sums>& sums) noexcept
+{
+    constexpr size_t CHUNK = 4096;
+    for (size_t begin = 0; begin < phaseCount; begin += CHUNK)
+    {
+        for (size_t i = first; i < clusterSizes.size(); i += step) { accumulate(phase, phaseCount, clusterSizes[i], begin, begin + CHUNK, sums[i]); }
+    }
+}
+
+/// Runs job(0) ... job(jobCount - 1) on up to threadCount threads, the calling thread included. Jobs are handed out one at a time.
+template <typename Job>
+void parallelFor(size_t jobCount, uint8_t threadCount, const Job& job)
+{
+#if THREADING_ENABLE
+    const size_t workerCount = std::min<size_t>(threadCount, jobCount);
+    if (workerCount > 1)
+    {
+        std::atomic<size_t> next{0};
+        const auto work = [&]()
+        {
+            for (size_t i = next++; i < jobCount; i = next++) { job(i); }
+        };
+        std::vector<std::unique_ptr<Thread>> workers;
+        for (size_t t = 1; t < workerCount; t++) { workers.push_back(std::make_unique<Thread>(work)); }
+        work();
+        for (auto& worker : workers) { worker->join(); }
+        return;
+    }
+#endif
+    for (size_t i = 0; i < jobCount; i++) { job(i); }
+}
+
+}  // namespace Allan
+
+/**
+ * @brief Allan, overlapping Allan and overlapping Hadamard deviations of one axis of rate samples, such as gyro or accelerometer output.
+ * The rates are integrated once into N + 1 doubles of phase, after which each cluster size is an O(N) pass over it. The cluster sizes are split
+ * between threadCount threads.
+ * @param rates First rate sample; sample i is read from rates[i * stride].
+ * @param samplePeriod Seconds between samples.
+ * @param clusterSizes Samples per cluster for each requested point, e.g. from logSpacedClusterSizes().
+ */
+template <typename T, std::enable_if_t<std::is_arithmetic<T>::value, bool> = true>
+std::vector<AllanDeviationPoint> computeAllanDeviation(const T* rates, size_t sampleCount, double samplePeriod,
+                                                       const std::vector<uint64_t>& clusterSizes, size_t stride = 1, uint8_t threadCount = 1)
+{
+    std::vector<double> phase;
+    Allan::integrate(rates, sampleCount, stride, phase);
+    std::vector<Allan::Sums> sums(clusterSizes.size());
+    const size_t groupCount = std::max<uint8_t>(threadCount, 1);
+    Allan::parallelFor(groupCount, threadCount,
+                       [&](size_t group) { Allan::clusterSums(phase.data(), phase.size(), clusterSizes, group, groupCount, sums); });
+
+    std::vector<AllanDeviationPoint> out(clusterSizes.size());
+    for (size_t i = 0; i < clusterSizes.size(); i++) { out[i] = sums[i].toPoint(clusterSizes[i], samplePeriod); }
+    return out;
+}
+
+/**
+ * @brief Deviations of every axis of an array of rate vectors, e.g. a capture of angularRate. Both the integration of each axis and the
+ * (axis, cluster size) passes are spread over threadCount threads. Needs N + 1 doubles of phase per axis.
+ */
+template <uint16_t axes, typename T>
+std::array<std::vector<AllanDeviationPoint>, axes> computeAllanDeviation(const Matrix<axes, 1, T>* samples, size_t sampleCount, double samplePeriod,
+                                                                         const std::vector<uint64_t>& clusterSizes, uint8_t threadCount = 1)
+{
+    static_assert(sizeof(Matrix<axes, 1, T>) == axes * sizeof(T), "Samples are read as one packed array.");
+    std::array<std::vector<double>, axes> phases;
+    std::array<std::vector<AllanDeviationPoint>, axes> out;
+    for (auto& points : out) { points.resize(clusterSizes.size()); }
+    const T* data = (sampleCount == 0) ? nullptr : samples[0].data();
+    Allan::parallelFor(axes, threadCount, [&](size_t axis) { Allan::integrate(data + axis, sampleCount, axes, phases[axis]); });
+
+    // Each job is one axis and every groupCount-th cluster size, so threads split the cluster sizes while keeping the chunked walk.
+    std::array<std::vector<Allan::Sums>, axes> sums;
+    for (auto& axisSums : sums) { axisSums.resize(clusterSizes.size()); }
+    const size_t groupCount = (std::max<size_t>(threadCount, 1) + axes - 1) / axes;
+    Allan::parallelFor(axes * groupCount, threadCount,
+                       [&](size_t job)
+                       {
+                           const size_t axis = job % axes;
+                           Allan::clusterSums(phases[axis].data(), phases[axis].size(), clusterSizes, job / axes, groupCount, sums[axis]);
+                       });
+
+    for (uint16_t axis = 0; axis < axes; axis++)
+    {
+        for (size_t i = 0; i < clusterSizes.size(); i++) { out[axis][i] = sums[axis][i].toPoint(clusterSizes[i], samplePeriod); }
+    }
+    return out;
+}
+
+/**
+ * @brief Streaming Allan, overlapping Allan and overlapping Hadamard deviations of an axes-dimensional rate signal, updated sample by sample
+ * during a capture.
+ * Memory is bounded by the number of cluster sizes, not by the capture length. A cluster size m of at least 2 * overlapsPerCluster takes its
+ * differences every s samples rather than every sample, where s is a power of two chosen so m / s stays in [overlapsPerCluster,
+ * 2 * overlapsPerCluster). Such an m is rounded to a multiple of s. Each level of s shares one ring of phase points taken every s samples.
+ * With overlapsPerCluster of 64 or more, the partially overlapping estimate is statistically almost as good as the fully overlapping one.
+ */
+template <uint16_t axes>
+class AllanDeviationAnalyzer
+{
+public:
+    /**
+     * @brief Constructor.
+     * @param samplePeriod Seconds between samples.
+     * @param clusterSizes Samples per cluster for each point of the curve, e.g. from logSpacedClusterSizes().
+     * @param overlapsPerCluster Minimum number of overlapping terms per cluster length; larger is closer to fully overlapping and uses more memory.
+     */
+    AllanDeviationAnalyzer(double samplePeriod, const std::vector<uint64_t>& clusterSizes, uint16_t overlapsPerCluster = 64)
+        : _samplePeriod(samplePeriod)
+    {
+        const uint64_t overlaps = std::max<uint16_t>(overlapsPerCluster, 1);
+        for (const uint64_t m : clusterSizes)
+        {
+            if (m == 0) { continue; }
+            uint8_t level = 0;
+            while ((m >> (level + 1)) >= overlaps) { level++; }
+            const uint64_t clusterLength = (m + ((1ull << level) >> 1)) >> level;
+            if (level >= _levels.size()) { _levels.resize(level + 1); }
+            auto& clusters = _levels[level].clusters;
+            if (std::none_of(clusters.begin(), clusters.end(), [&](const Cluster& c) { return c.length == clusterLength; }))
+            {
+                clusters.push_back(Cluster{static_cast<uint32_t>(clusterLength)});
+            }
+        }
+        for (auto& level : _levels)
+        {
+            uint32_t longest = 0;
+            for (const auto& cluster : level.clusters) { longest = std::max(longest, cluster.length); }
+            uint32_t size = 1;
+            while (size < 3 * longest + 1) { size <<= 1; }
+            level.ring.resize(level.clusters.empty() ? 0 : size);
+        }
+        reset();
+    }
+
+    /// Adds one rate sample.
+    template <typename T>
+    void addSample(const Matrix<axes, 1, T>& rates) noexcept
+    {
+        if (_sampleCount == 0)
+        {
+            for (uint16_t a = 0; a < axes; a++) { _offset[a] = static_cast<double>(rates[a]); }
+        }
+        for (uint16_t a = 0; a < axes; a++) { _phase[a] += static_cast<double>(rates[a]) - _offset[a]; }
+        _sampleCount++;
+        _pushPhase();
+    }
+
+    /**
+     * @brief Adds the rates held in one IMU field of a measurement, e.g. `&CompositeData::ImuGroup::angularRate`.
+     * @return True if the measurement does not contain the field.
+     */
+    Errored addSample(const CompositeData& cd, std::optional<Vec3f> CompositeData::ImuGroup::*field) noexcept
+    {
+        static_assert(axes == 3, "IMU fields have three axes.");
+        const std::optional<Vec3f>& rates = cd.imu.*field;
+        if (!rates.has_value()) { return true; }
+        addSample(*rates);
+        return false;
+    }
+
+    /// Deviation curve of each axis, ordered by cluster size.
+    std::array<std::vector<AllanDeviationPoint>, axes> getDeviations() const
+    {
+        std::array<std::vector<AllanDeviationPoint>, axes> out;
+        for (uint8_t l = 0; l < _levels.size(); l++)
+        {
+            const uint64_t pushed = _levels[l].pushed;
+            for (const auto& cluster : _levels[l].clusters)
+            {
+                const uint64_t q = cluster.length;
+                Allan::Sums sums;
+                sums.overlappingAllanTerms = (pushed > 2 * q) ? pushed - 2 * q : 0;
+                sums.hadamardTerms = (pushed > 3 * q) ? pushed - 3 * q : 0;
+                sums.allanTerms = (pushed > 2 * q) ? (pushed - 1) / q - 1 : 0;
+                for (uint16_t a = 0; a < axes; a++)
+                {
+                    sums.allan = cluster.allan[a];
+                    sums.overlappingAllan = cluster.overlappingAllan[a];
+                    sums.hadamard = cluster.hadamard[a];
+                    out[a].push_back(sums.toPoint(q << l, _samplePeriod));
+                }
+            }
+        }
+        for (auto& points : out)
+        {
+            std::sort(points.begin(), points.end(),
+                      [](const AllanDeviationPoint& lhs, const AllanDeviationPoint& rhs) { return lhs.clusterSize < rhs.clusterSize; });
+        }
+        return out;
+    }
+
+    uint64_t getSampleCount() const noexcept { return _sampleCount; }
+
+    void reset() noexcept
+    {
+        _sampleCount = 0;
+        _phase.fill(0);
+        _offset.fill(0);
+        for (auto& level : _levels)
+        {
+            level.head = 0;
+            level.pushed = 0;
+            for (auto& cluster : level.clusters)
+            {
+                cluster.position = 0;
+                cluster.allan.fill(0);
+                cluster.overlappingAllan.fill(0);
+                cluster.hadamard.fill(0);
+            }
+        }
+        _pushPhase();
+    }
+
+private:
+    using Phase = std::array<double, axes>;
+
+    struct Cluster
+    {
+        uint32_t length;        // Cluster size in units of the level's stride
+        uint32_t position = 0;  // Phase points pushed, modulo length; zero where a non-overlapping term ends
+        Phase allan{};
+        Phase overlappingAllan{};
+        Phase hadamard{};
+    };
+
+    struct Level
+    {
+        std::vector<Phase> ring;  // Phase every 2^level samples, newest at head; a power of two long
+        uint32_t head = 0;
+        uint64_t pushed = 0;
+        std::vector<Cluster> clusters;
+    };
+
+    double _samplePeriod;
+    std::vector<Level> _levels;
+    Phase _phase{};
+    Phase _offset{};
+    uint64_t _sampleCount = 0;
+
+    void _pushPhase() noexcept
+    {
+        for (uint8_t l = 0; l < _levels.size(); l++)
+        {
+            if ((_sampleCount & ((1ull << l) - 1)) != 0) { break; }  // Not on this level's stride, nor any coarser one
+            Level& level = _levels[l];
+            if (level.clusters.empty()) { continue; }
+            const uint32_t mask = static_cast<uint32_t>(level.ring.size()) - 1;
+            level.head = (level.head + 1) & mask;
+            level.ring[level.head] = _phase;
+            level.pushed++;
+
+            const auto back = [&](uint32_t steps) -> const Phase& { return level.ring[(level.head - steps) & mask]; };
+            const Phase& x0 = _phase;
+            for (auto& cluster : level.clusters)
+            {
+                const uint32_t q = cluster.length;
+                const bool nonOverlapping = (cluster.position == 0);
+                cluster.position = (cluster.position + 1 == q) ? 0 : cluster.position + 1;
+                if (level.pushed <= 2ull * q) { continue; }
+
+                const Phase& x1 = back(q);
+                const Phase& x2 = back(2 * q);
+                const bool hadamard = level.pushed > 3ull * q;
+                const Phase& x3 = hadamard ? back(3 * q) : x2;
+                for (uint16_t a = 0; a < axes; a++)
+                {
+                    const double d = x0[a] - 2 * x1[a] + x2[a];
+                    const double h = x0[a] - 3 * x1[a] + 3 * x2[a] - x3[a];
+                    cluster.overlappingAllan[a] += d * d;
+                    if (nonOverlapping) { cluster.allan[a] += d * d; }
+                    if (hadamard) { cluster.hadamard[a] += h * h; }
+                }
+            }
+        }
+    }
+};
+
+}  // namespace Math
+}  // namespace VN
+
+#endif  // VN_ALLANVARIANCE_HPP_
@@ -24,6 +24,7 @@
 #ifndef VN_ATTITUDEMATH_HPP_
 #define VN_ATTITUDEMATH_HPP_
 
+#include "vectornav/BatchMath.hpp"
 #include "vectornav/Conversions.hpp"
 #include "vectornav/Implementation/MeasurementDatatypes.hpp"
 #include "vectornav/LinearAlgebra.hpp"
@@ -238,6 +239,34 @@ inline Quat propagateQuat(Quat q0, Vec3f dTheta) noexcept
     return normalizeQuat(q).value();  // method cannot produce invalid quaternion
 }
 
+/**
+ * @brief Spherically interpolates between two orientations along the shorter arc, at constant angular rate.
+ * @param q0 Orientation at fraction 0.
+ * @param q1 Orientation at fraction 1.
+ * @param fraction Interpolation fraction, nominally between 0 and 1.
+ * @return Interpolated quaternion, normalized with a positive scalar component.
+ */
+inline Quat slerpQuat(const Quat& q0, const Quat& q1, const float fraction) noexcept
+{
+    float cosTheta = dot(q0.vector, q1.vector) + q0.scalar * q1.scalar;
+    const float side = (cosTheta < 0.0f) ? -1.0f : 1.0f;  // q and -q are the same orientation; take the shorter arc
+    cosTheta *= side;
+
+    float w0 = 1.0f - fraction;
+    float w1 = fraction;
+    if (cosTheta < 0.9995f)  // Otherwise nearly parallel, where the normalized linear blend is as accurate and avoids dividing by sin(theta)
+    {
+        const float theta = std::acos(cosTheta);
+        const float sinTheta = std::sin(theta);
+        w0 = std::sin(w0 * theta) / sinTheta;
+        w1 = std::sin(w1 * theta) / sinTheta;
+    }
+    w1 *= side;
+
+    const Quat q{q0.vector * w0 + q1.vector * w1, q0.scalar * w0 + q1.scalar * w1};
+    return normalizeQuat(q).value_or(q0);
+}
+
 /**
  * @brief Calculates a tilt-corrected yaw (heading) given magnetic measurements, pitch & roll and (optional) magnetic declination.
  * @param magBody Magnetometer measurements in body-frame.
@@ -322,6 +351,281 @@ inline Mat3f crp2dcm(const Vec3f& crp) noexcept { return quat2dcm(crp2quat(crp))
  */
 inline std::optional<Vec3f> dcm2crp(const Mat3f& dcm) noexcept { return quat2crp(dcm2quat(dcm)); }
 
+// *********************
+// Batched conversions
+// *********************
+
+// These convert many samples per call, held as one array per component. They follow the single-sample functions above operation for
+// operation, but evaluate trigonometry and square roots with the approximations in BatchMath.hpp. Quaternion and DCM components match the
+// single-sample results to within 3 ULP of 1 (absolute 3.6e-7), and angles to within 2 ULP of 180 degrees (absolute 4.3e-5 deg). Output
+// arrays may be the input arrays.
+
+/// Yaw-pitch-roll samples, one array per component.
+struct YprArrays
+{
+    float* yaw;
+    float* pitch;
+    float* roll;
+};
+
+/// Quaternion samples, one array per component.
+struct QuatArrays
+{
+    float* x;
+    float* y;
+    float* z;
+    float* scalar;
+};
+
+/// Direction cosine matrix samples, one array per element in row-major order.
+struct DcmArrays
+{
+    float* elements[9];
+};
+
+/// Three-component vector samples, one array per component.
+struct Vec3fArrays
+{
+    float* x;
+    float* y;
+    float* z;
+};
+
+namespace Batch
+{
+
+/// Lane form of normalizeQuat, without its check for a zero quaternion.
+inline void normalizeQuat(float& x, float& y, float& z, float& s) noexcept
+{
+    const float signS = static_cast<float>(s > 0.0f) - static_cast<float>(s < 0.0f);  // As sign(), in a form that vectorizes
+    const float scale = signS * rsqrt(x * x + y * y + z * z + s * s);
+    x *= scale;
+    y *= scale;
+    z *= scale;
+    s *= scale;
+}
+
+/// Lane form of dcm2ypr, given the DCM elements it uses.
+inline void dcm2ypr(const float d00, const float d01, const float d02, const float d10, const float d11, const float d12, const float d22, float& yaw,
+                    float& pitch, float& roll) noexcept
+{
+    const bool notVertical = (1.0f - std::fabs(d02)) > 0.0f;
+    const float yawN = rad2deg(atan2(d01, d00));
+    const float pitchN = rad2deg(-asin(d02));
+    const float rollN = rad2deg(atan2(d12, d22));
+    const float yawV = rad2deg(atan2(-d10, d11));
+    yaw = select(notVertical, yawN, yawV);
+    pitch = select(notVertical, pitchN, (d02 > 0.0f) ? -90.0f : 90.0f);
+    roll = select(notVertical, rollN, 0.0f);
+}
+
+}  // namespace Batch
+
+/**
+ * @brief Converts yaw-pitch-roll samples to quaternions.
+ * @param ypr Yaw-pitch-roll in degrees.
+ * @param quat Receives the equivalent quaternions.
+ * @param count Number of samples.
+ */
+inline void ypr2quat(const YprArrays& ypr, const QuatArrays& quat, const size_t count) noexcept
+{
+    Batch::forEachBlock({ypr.yaw, ypr.pitch, ypr.roll}, {quat.x, quat.y, quat.z, quat.scalar}, count, [](const auto& in, auto& out) {
+        constexpr float degToRad = static_cast<float>(M_PI) / 180.0f;  // As deg2rad(Ypr)
+        for (uint8_t l = 0; l < Batch::LANES; ++l)
+        {
+            float s1, c1, s2, c2, s3, c3;
+            Batch::sinCos(in[0][l] * degToRad / 2.0f, s1, c1);
+            Batch::sinCos(in[1][l] * degToRad / 2.0f, s2, c2);
+            Batch::sinCos(in[2][l] * degToRad / 2.0f, s3, c3);
+            out[0][l] = c1 * c2 * s3 - s1 * s2 * c3;
+            out[1][l] = c1 * s2 * c3 + s1 * c2 * s3;
+            out[2][l] = s1 * c2 * c3 - c1 * s2 * s3;
+            out[3][l] = c1 * c2 * c3 + s1 * s2 * s3;
+        }
+    });
+}
+
+/**
+ * @brief Converts quaternion samples to direction cosine matrices.
+ * @param quat Quaternions.
+ * @param dcm Receives the equivalent DCMs.
+ * @param count Number of samples.
+ */
+inline void quat2dcm(const QuatArrays& quat, const DcmArrays& dcm, const size_t count) noexcept
+{
+    const auto& d = dcm.elements;
+    Batch::forEachBlock({quat.x, quat.y, quat.z, quat.scalar}, {d[0], d[1], d[2], d[3], d[4], d[5], d[6], d[7], d[8]}, count,
+                        [](const auto& in, auto& out) {
+                            for (uint8_t l = 0; l < Batch::LANES; ++l)
+                            {
+                                const float q1 = in[0][l];
+                                const float q2 = in[1][l];
+                                const float q3 = in[2][l];
+                                const float q0 = in[3][l];
+                                out[0][l] = q0 * q0 + q1 * q1 - q2 * q2 - q3 * q3;
+                                out[1][l] = 2.f * (q1 * q2 + q0 * q3);
+                                out[2][l] = 2.f * (q1 * q3 - q0 * q2);
+                                out[3][l] = 2.f * (q1 * q2 - q0 * q3);
+                                out[4][l] = q0 * q0 - q1 * q1 + q2 * q2 - q3 * q3;
+                                out[5][l] = 2.f * (q2 * q3 + q0 * q1);
+                                out[6][l] = 2.f * (q1 * q3 + q0 * q2);
+                                out[7][l] = 2.f * (q2 * q3 - q0 * q1);
+                                out[8][l] = q0 * q0 - q1 * q1 - q2 * q2 + q3 * q3;
+                            }
+                        });
+}
+
+/**
+ * @brief Converts direction cosine matrix samples to yaw-pitch-roll. Where pitch=+/-90deg, sets roll to zero.
+ * @param dcm Direction cosine matrices.
+ * @param ypr Receives the equivalent yaw-pitch-roll in degrees.
+ * @param count Number of samples.
+ */
+inline void dcm2ypr(const DcmArrays& dcm, const YprArrays& ypr, const size_t count) noexcept
+{
+    const auto& d = dcm.elements;
+    Batch::forEachBlock({d[0], d[1], d[2], d[3], d[4], d[5], d[8]}, {ypr.yaw, ypr.pitch, ypr.roll}, count, [](const auto& in, auto& out) {
+        for (uint8_t l = 0; l < Batch::LANES; ++l)
+        {
+            Batch::dcm2ypr(in[0][l], in[1][l], in[2][l], in[3][l], in[4][l], in[5][l], in[6][l], out[0][l], out[1][l], out[2][l]);
+        }
+    });
+}
+
+/**
+ * @brief Converts quaternion samples to yaw-pitch-roll.
+ * @param quat Quaternions.
+ * @param ypr Receives the equivalent yaw-pitch-roll in degrees.
+ * @param count Number of samples.
+ */
+inline void quat2ypr(const QuatArrays& quat, const YprArrays& ypr, const size_t count) noexcept
+{
+    Batch::forEachBlock({quat.x, quat.y, quat.z, quat.scalar}, {ypr.yaw, ypr.pitch, ypr.roll}, count, [](const auto& in, auto& out) {
+        for (uint8_t l = 0; l < Batch::LANES; ++l)
+        {
+            const float q1 = in[0][l];
+            const float q2 = in[1][l];
+            const float q3 = in[2][l];
+            const float q0 = in[3][l];
+            const float d00 = q0 * q0 + q1 * q1 - q2 * q2 - q3 * q3;
+            const float d01 = 2.f * (q1 * q2 + q0 * q3);
+            const float d02 = 2.f * (q1 * q3 - q0 * q2);
+            const float d10 = 2.f * (q1 * q2 - q0 * q3);
+            const float d11 = q0 * q0 - q1 * q1 + q2 * q2 - q3 * q3;
+            const float d12 = 2.f * (q2 * q3 + q0 * q1);
+            const float d22 = q0 * q0 - q1 * q1 - q2 * q2 + q3 * q3;
+            Batch::dcm2ypr(d00, d01, d02, d10, d11, d12, d22, out[0][l], out[1][l], out[2][l]);
+        }
+    });
+}
+
+/**
+ * @brief Converts direction cosine matrix samples to quaternions.
+ * @param dcm Direction cosine matrices, which must be valid.
+ * @param quat Receives the equivalent quaternions.
+ * @param count Number of samples.
+ */
+inline void dcm2quat(const DcmArrays& dcm, const QuatArrays& quat, const size_t count) noexcept
+{
+    const auto& d = dcm.elements;
+    Batch::forEachBlock({d[0], d[1], d[2], d[3], d[4], d[5], d[6], d[7], d[8]}, {quat.x, quat.y, quat.z, quat.scalar}, count,
+                        [](const auto& in, auto& out) {
+                            for (uint8_t l = 0; l < Batch::LANES; ++l)
+                            {
+                                const float d00 = in[0][l], d01 = in[1][l], d02 = in[2][l];
+                                const float d10 = in[3][l], d11 = in[4][l], d12 = in[5][l];
+                                const float d20 = in[6][l], d21 = in[7][l], d22 = in[8][l];
+                                const float tr = d00 + d11 + d22;
+
+                                // The largest of tr, d00, d11 and d22 picks the best conditioned formula, the first on ties
+                                const bool max1 = d00 > tr;
+                                const float max01 = std::max(d00, tr);
+                                const bool max2 = d11 > max01;
+                                const bool max3 = d22 > std::max(d11, max01);
+
+                                float s = tr + 1;
+                                float x = d12 - d21;
+                                float y = d20 - d02;
+                                float z = d01 - d10;
+                                s = Batch::select(max1, d12 - d21, s);
+                                x = Batch::select(max1, 2 * d00 - tr + 1, x);
+                                y = Batch::select(max1, d01 + d10, y);
+                                z = Batch::select(max1, d20 + d02, z);
+                                s = Batch::select(max2, d20 - d02, s);
+                                x = Batch::select(max2, d01 + d10, x);
+                                y = Batch::select(max2, 2 * d11 - tr + 1, y);
+                                z = Batch::select(max2, d12 + d21, z);
+                                s = Batch::select(max3, d01 - d10, s);
+                                x = Batch::select(max3, d20 + d02, x);
+                                y = Batch::select(max3, d21 + d12, y);
+                                z = Batch::select(max3, 2 * d22 - tr + 1, z);
+
+                                Batch::normalizeQuat(x, y, z, s);
+                                out[0][l] = x;
+                                out[1][l] = y;
+                                out[2][l] = z;
+                                out[3][l] = s;
+                            }
+                        });
+}
+
+/**
+ * @brief Combines pairs of quaternions as sequential rotations into composite rotation quaternions.
+ * @param q0 First rotation quaternions.
+ * @param q1 Second rotation quaternions.
+ * @param quat Receives the combined quaternions.
+ * @param count Number of samples.
+ */
+inline void multiplyQuat(const QuatArrays& q0, const QuatArrays& q1, const QuatArrays& quat, const size_t count) noexcept
+{
+    Batch::forEachBlock({q0.x, q0.y, q0.z, q0.scalar, q1.x, q1.y, q1.z, q1.scalar}, {quat.x, quat.y, quat.z, quat.scalar}, count,
+                        [](const auto& in, auto& out) {
+                            for (uint8_t l = 0; l < Batch::LANES; ++l)
+                            {
+                                const float ax = in[0][l], ay = in[1][l], az = in[2][l], as = in[3][l];
+                                const float bx = in[4][l], by = in[5][l], bz = in[6][l], bs = in[7][l];
+                                out[0][l] = as * bx + ax * bs + ay * bz - az * by;
+                                out[1][l] = as * by - ax * bz + ay * bs + az * bx;
+                                out[2][l] = as * bz + ax * by - ay * bx + az * bs;
+                                out[3][l] = as * bs - (ax * bx + ay * by + az * bz);
+                            }
+                        });
+}
+
+/**
+ * @brief Calculates the propagated quaternions given initial orientations and delta-thetas.
+ * @param q0 Quaternions representing initial orientations.
+ * @param dTheta Delta-thetas (eg. coning integral) in radians.
+ * @param quat Receives the propagated quaternions.
+ * @param count Number of samples.
+ */
+inline void propagateQuat(const QuatArrays& q0, const Vec3fArrays& dTheta, const QuatArrays& quat, const size_t count) noexcept
+{
+    Batch::forEachBlock({q0.x, q0.y, q0.z, q0.scalar, dTheta.x, dTheta.y, dTheta.z}, {quat.x, quat.y, quat.z, quat.scalar}, count,
+                        [](const auto& in, auto& out) {
+                            for (uint8_t l = 0; l < Batch::LANES; ++l)
+                            {
+                                const float qx = in[0][l], qy = in[1][l], qz = in[2][l], qs = in[3][l];
+                                const float dx = in[4][l], dy = in[5][l], dz = in[6][l];
+                                const float normdT = Batch::sqrt(dx * dx + dy * dy + dz * dz);
+                                float sinPhi, cosPhi;
+                                Batch::sinCos(0.5f * normdT, sinPhi, cosPhi);
+                                const float k = Batch::select(normdT > std::numeric_limits<float>::epsilon(), sinPhi / normdT, 0.5f);
+                                const float p0 = dx * k, p1 = dy * k, p2 = dz * k;
+
+                                float x = cosPhi * qx + p2 * qy - p1 * qz + p0 * qs;
+                                float y = -p2 * qx + cosPhi * qy + p0 * qz + p1 * qs;
+                                float z = p1 * qx - p0 * qy + cosPhi * qz + p2 * qs;
+                                float s = -p0 * qx - p1 * qy - p2 * qz + cosPhi * qs;
+                                Batch::normalizeQuat(x, y, z, s);
+                                out[0][l] = x;
+                                out[1][l] = y;
+                                out[2][l] = z;
+                                out[3][l] = s;
+                            }
+                        });
+}
+
 }  // namespace Math
 }  // namespace VN
 
@@ -0,0 +1,261 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.99.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef VN_BATCHMATH_HPP_
+#define VN_BATCHMATH_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+namespace VN
+{
+namespace Math
+{
+namespace Batch
+{
+
+/// Samples processed together by the batched functions. The kernels are branch-free loops over this many lanes, which the compiler turns into
+/// SSE, AVX2 or NEON instructions, whichever the build targets, when loop vectorization is on (-O3, as in CMake Release builds), and into plain
+/// scalar code otherwise.
+constexpr uint8_t LANES = 16;
+
+/**
+ * @brief Runs kernel over count samples held as NumIn input arrays and NumOut output arrays, LANES samples at a time.
+ * @details Each block is copied into local arrays first, so outputs may alias inputs and the kernel's lane loops can be vectorized. Lanes past
+ * the end of the data are zero-filled and their results discarded.
+ * @param kernel Called as kernel(in, out) with in[NumIn][LANES] and out[NumOut][LANES].
+ */
+template <typename T, size_t NumIn, size_t NumOut, typename Kernel>
+inline void forEachBlock(const T* const (&in)[NumIn], T* const (&out)[NumOut], const size_t count, Kernel&& kernel) noexcept
+{
+    for (size_t start = 0; start < count; start += LANES)
+    {
+        alignas(64) T blockIn[NumIn][LANES];
+        alignas(64) T blockOut[NumOut][LANES];
+        if (count - start >= LANES)  // Fixed size copies compile to a few vector moves
+        {
+            for (size_t i = 0; i < NumIn; ++i) { std::memcpy(blockIn[i], in[i] + start, sizeof(blockIn[i])); }
+            kernel(blockIn, blockOut);
+            for (size_t o = 0; o < NumOut; ++o) { std::memcpy(out[o] + start, blockOut[o], sizeof(blockOut[o])); }
+        }
+        else
+        {
+            const size_t n = count - start;
+            std::memset(blockIn, 0, sizeof(blockIn));
+            for (size_t i = 0; i < NumIn; ++i) { std::memcpy(blockIn[i], in[i] + start, n * sizeof(T)); }
+            kernel(blockIn, blockOut);
+            for (size_t o = 0; o < NumOut; ++o) { std::memcpy(out[o] + start, blockOut[o], n * sizeof(T)); }
+        }
+    }
+}
+
+/**
+ * @brief Returns condition ? a : b by blending bits. Both values are always computed, so the compiler has no reason to move either into a
+ * branch, which would stop the lane loop from vectorizing without masked instructions.
+ */
+inline float select(const bool condition, const float a, const float b) noexcept
+{
+    uint32_t bitsA, bitsB;
+    std::memcpy(&bitsA, &a, sizeof(bitsA));
+    std::memcpy(&bitsB, &b, sizeof(bitsB));
+    const uint32_t mask = 0u - static_cast<uint32_t>(condition);
+    const uint32_t bits = (bitsA & mask) | (bitsB & ~mask);
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+/// Returns condition ? a : b by blending bits.
+inline double select(const bool condition, const double a, const double b) noexcept
+{
+    uint64_t bitsA, bitsB;
+    std::memcpy(&bitsA, &a, sizeof(bitsA));
+    std::memcpy(&bitsB, &b, sizeof(bitsB));
+    const uint64_t mask = 0u - static_cast<uint64_t>(condition);
+    const uint64_t bits = (bitsA & mask) | (bitsB & ~mask);
+    double result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+// Branch-free single precision approximations for use inside lane loops, after Cephes. Over the angles of attitude data they are within
+// 3 ULP of the standard library.
+
+/**
+ * @brief Computes the sine and cosine of an angle.
+ * @param x Angle in radians, accurate for |x| < 8192.
+ */
+inline void sinCos(const float x, float& s, float& c) noexcept
+{
+    const float ax = std::fabs(x);
+    const int32_t j = (static_cast<int32_t>(ax * 1.27323954473516f) + 1) & ~1;  // Nearest even multiple of pi/4
+    const float y = static_cast<float>(j);
+    const float r = ((ax - y * 0.78515625f) - y * 2.4187564849853515625e-4f) - y * 3.77489497744594108e-8f;
+    const float z = r * r;
+    const float ps = ((-1.9515295891e-4f * z + 8.3321608736e-3f) * z - 1.6666654611e-1f) * z * r + r;
+    const float pc = ((2.443315711809948e-5f * z - 1.388731625493765e-3f) * z + 4.166664568298827e-2f) * z * z - 0.5f * z + 1.0f;
+    const bool swap = (j & 2) != 0;
+    const float sv = select(swap, pc, ps);
+    const float cv = select(swap, ps, pc);
+    s = select(((j & 4) != 0) != (x < 0.0f), -sv, sv);
+    c = select(((j + 2) & 4) != 0, -cv, cv);
+}
+
+/// Reciprocal square root of x > 0, to within 2 ULP. Unlike std::sqrt, which vectorizes only in builds with -fno-math-errno, it vectorizes in any
+/// build. Returns a large finite value for zero.
+inline float rsqrt(const float x) noexcept
+{
+    uint32_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    bits = 0x5f375a86u - (bits >> 1);  // Initial estimate within 4%
+    float y;
+    std::memcpy(&y, &bits, sizeof(y));
+    const float halfX = 0.5f * x;
+    // Each Newton step squares the relative error. Written out, as an inner loop may be left rolled and stop vectorization.
+    y *= 1.5f - halfX * y * y;
+    y *= 1.5f - halfX * y * y;
+    y *= 1.5f - halfX * y * y;
+    return y;
+}
+
+/// Square root of x >= 0, to within 2 ULP.
+inline float sqrt(const float x) noexcept { return x * rsqrt(x); }
+
+/// Arctangent of a in [0, 1].
+inline float atanUnit(const float a) noexcept
+{
+    const bool reduce = a > 0.414213562373095f;  // tan(pi/8)
+    const float x = select(reduce, a - 1.0f, a) / select(reduce, a + 1.0f, 1.0f);
+    const float z = x * x;
+    const float p = (((8.05374449538e-2f * z - 1.38776856032e-1f) * z + 1.99777106478e-1f) * z - 3.33329491539e-1f) * z * x + x;
+    return select(reduce, p + 0.785398163397448f, p);
+}
+
+/// Four-quadrant arctangent of y / x in radians. Returns zero when both are zero.
+inline float atan2(const float y, const float x) noexcept
+{
+    const float ax = std::fabs(x);
+    const float ay = std::fabs(y);
+    const float hi = std::max(ax, ay);
+    const float lo = std::min(ax, ay);
+    float r = atanUnit(lo / std::max(hi, std::numeric_limits<float>::min()));
+    r = select(ay > ax, 1.57079632679490f - r, r);
+    r = select(x < 0.0f, 3.14159265358979f - r, r);
+    return select(y < 0.0f, -r, r);
+}
+
+/// Arcsine in radians of x in [-1, 1].
+inline float asin(const float x) noexcept
+{
+    const float a = std::fabs(x);
+    const bool reduce = a > 0.5f;
+    const float z = select(reduce, 0.5f * (1.0f - a), a * a);
+    const float v = select(reduce, sqrt(z), a);
+    const float p = ((((4.2163199048e-2f * z + 2.4181311049e-2f) * z + 4.5470025998e-2f) * z + 7.4953002686e-2f) * z + 1.6666752422e-1f) * z * v + v;
+    const float r = select(reduce, 1.57079632679490f - 2.0f * p, p);
+    return select(x < 0.0f, -r, r);
+}
+
+// Double precision counterparts, after Cephes, within 3 ULP of the standard library.
+
+/**
+ * @brief Computes the sine and cosine of an angle.
+ * @param x Angle in radians, accurate for |x| < 1e9.
+ */
+inline void sinCos(const double x, double& s, double& c) noexcept
+{
+    constexpr double roundingShift = 6755399441055744.0;  // 1.5 * 2^52, adding it rounds to an integer held in the low mantissa bits
+    const double ax = std::fabs(x);
+    const double shifted = ax * 0.63661977236758134308 + roundingShift;  // Nearest multiple of pi/2
+    uint64_t n;
+    std::memcpy(&n, &shifted, sizeof(n));
+    const double y = shifted - roundingShift;
+    const double r = ((ax - y * 1.57079625129699707031) - y * 7.54978941586159635336e-8) - y * 5.39030285815811905290e-15;
+    const double z = r * r;
+    double ps = 1.58962301576546568060e-10 * z - 2.50507477628578072866e-8;
+    ps = ((ps * z + 2.75573136213857245213e-6) * z - 1.98412698295895385996e-4) * z + 8.33333333332211858878e-3;
+    ps = r + r * z * (ps * z - 1.66666666666666307295e-1);
+    double pc = -1.13585365213876817300e-11 * z + 2.08757008419747316778e-9;
+    pc = ((pc * z - 2.75573141792967388112e-7) * z + 2.48015872888517045348e-5) * z - 1.38888888888730564116e-3;
+    pc = 1.0 - 0.5 * z + z * z * (pc * z + 4.16666666666665929218e-2);
+    const bool swap = (n & 1) != 0;
+    const double sv = select(swap, pc, ps);
+    const double cv = select(swap, ps, pc);
+    s = select(((n & 2) != 0) != (x < 0.0), -sv, sv);
+    c = select(((n + 1) & 2) != 0, -cv, cv);
+}
+
+/// Reciprocal square root of x > 0, to within 3 ULP. Returns a large finite value for zero.
+inline double rsqrt(const double x) noexcept
+{
+    uint64_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    bits = 0x5fe6eb50c7b537a9u - (bits >> 1);
+    double y;
+    std::memcpy(&y, &bits, sizeof(y));
+    const double halfX = 0.5 * x;
+    y *= 1.5 - halfX * y * y;
+    y *= 1.5 - halfX * y * y;
+    y *= 1.5 - halfX * y * y;
+    y *= 1.5 - halfX * y * y;
+    return y;
+}
+
+/// Square root of x >= 0, to within 3 ULP.
+inline double sqrt(const double x) noexcept { return x * rsqrt(x); }
+
+/// Arctangent of a in [0, 1].
+inline double atanUnit(const double a) noexcept
+{
+    const bool reduce = a > 0.66;
+    const double x = select(reduce, a - 1.0, a) / select(reduce, a + 1.0, 1.0);
+    const double z = x * x;
+    double p = (-8.750608600031904122785e-1 * z - 1.615753718733365076637e1) * z - 7.500855792314704667340e1;
+    p = (p * z - 1.228866684490136173410e2) * z - 6.485021904942025371773e1;
+    double q = (z + 2.485846490142306297962e1) * z + 1.650270098316988542046e2;
+    q = ((q * z + 4.328810604912902668951e2) * z + 4.853903996359136964868e2) * z + 1.945506571482613964425e2;
+    const double r = x * (z * p / q) + x;
+    return select(reduce, r + (0.78539816339744830962 + 3.061616997868382943065e-17), r);
+}
+
+/// Four-quadrant arctangent of y / x in radians. Returns zero when both are zero.
+inline double atan2(const double y, const double x) noexcept
+{
+    const double ax = std::fabs(x);
+    const double ay = std::fabs(y);
+    const double hi = std::max(ax, ay);
+    const double lo = std::min(ax, ay);
+    double r = atanUnit(lo / std::max(hi, std::numeric_limits<double>::min()));
+    r = select(ay > ax, 1.57079632679489661923 - r, r);
+    r = select(x < 0.0, 3.14159265358979323846 - r, r);
+    return select(y < 0.0, -r, r);
+}
+
+}  // namespace Batch
+}  // namespace Math
+}  // namespace VN
+
+#endif  // VN_BATCHMATH_HPP_
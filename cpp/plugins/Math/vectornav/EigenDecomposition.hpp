@@ -28,6 +28,8 @@
 #include <complex>
 
 #include "vectornav/Debug.hpp"
+#include "vectornav/Interface/Errors.hpp"
+#include "vectornav/LinearAlgebra.hpp"
 #include "vectornav/TemplateLibrary/Matrix.hpp"
 
 namespace VN
@@ -147,6 +149,77 @@ public:
         return false;
     }
 
+    /**
+     * @brief Computes the eigenvalues and eigenvectors of a symmetric matrix by cyclic Jacobi rotations.
+     * Faster and more accurate than computeDecomposition for symmetric input such as normal equations, whose eigenvalues are all real.
+     * @tparam m The size of the matrix (m x m) and vectors (m x 1).
+     * @tparam T The type of elements in the matrix and vectors.
+     * @param mat The symmetric matrix. Only the upper triangle is read.
+     * @param[out] eigenValues The eigenvalues, in no particular order.
+     * @param[out] eigenVectors The matrix whose columns are the unit eigenvectors matching eigenValues.
+     * @return Indicates if an error occurred. True if the rotations did not converge within the maximum number of sweeps, false if successful.
+     */
+    template <uint16_t m, typename T>
+    Errored computeSymmetricDecomposition(const Matrix<m, m, T>& mat, Matrix<m, 1, T>& eigenValues, Matrix<m, m, T>& eigenVectors) noexcept
+    {
+        Matrix<m, m, T> a = mat;
+        for (uint16_t i{0}; i < m; ++i)
+        {
+            for (uint16_t j{0}; j < i; ++j) a(i, j) = a(j, i);
+        }
+        eigenVectors = Matrix<m, m, T>::identity();
+
+        for (int sweep{0}; sweep < _maxIter; ++sweep)
+        {
+            T offDiagonal{0}, diagonal{0};
+            for (uint16_t p{0}; p < m; ++p)
+            {
+                diagonal += a(p, p) * a(p, p);
+                for (uint16_t q = p + 1; q < m; ++q) offDiagonal += a(p, q) * a(p, q);
+            }
+            if (offDiagonal <= std::numeric_limits<T>::epsilon() * std::numeric_limits<T>::epsilon() * diagonal)
+            {
+                for (uint16_t i{0}; i < m; ++i) eigenValues(i) = a(i, i);
+                return false;
+            }
+
+            for (uint16_t p{0}; p < m; ++p)
+            {
+                for (uint16_t q = p + 1; q < m; ++q)
+                {
+                    if (a(p, q) == static_cast<T>(0.0)) continue;
+
+                    // Rotation through the angle that zeroes a(p, q), taking the smaller root for stability
+                    const T apq = a(p, q);
+                    const T theta = (a(q, q) - a(p, p)) / (2 * apq);
+                    const T t = (theta >= 0 ? 1 : -1) / (std::abs(theta) + std::sqrt(theta * theta + 1));
+                    const T c = 1 / std::sqrt(t * t + 1);
+                    const T s = t * c;
+
+                    // Only rows and columns p and q change, and a stays symmetric
+                    a(p, p) -= t * apq;
+                    a(q, q) += t * apq;
+                    a(p, q) = a(q, p) = 0;
+                    for (uint16_t k{0}; k < m; ++k)
+                    {
+                        if (k != p && k != q)
+                        {
+                            const T akp = a(k, p), akq = a(k, q);
+                            a(k, p) = a(p, k) = c * akp - s * akq;
+                            a(k, q) = a(q, k) = s * akp + c * akq;
+                        }
+                        const T vkp = eigenVectors(k, p), vkq = eigenVectors(k, q);
+                        eigenVectors(k, p) = c * vkp - s * vkq;
+                        eigenVectors(k, q) = s * vkp + c * vkq;
+                    }
+                }
+            }
+        }
+
+        VN_DEBUG_1("computeSymmetricDecomposition: Jacobi rotations did not converge");
+        return true;
+    }
+
 protected:
     /**
      * @brief Balances a matrix so that the rows with zero entries off the diagonal are isolated and the remaining columns and rows are resized to have one norm
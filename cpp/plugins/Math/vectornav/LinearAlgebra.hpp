@@ -26,6 +26,7 @@
 
 #include <cmath>
 #include <numeric>
+#include <optional>
 
 #include "vectornav/Debug.hpp"
 #include "vectornav/TemplateLibrary/Matrix.hpp"
@@ -229,6 +230,46 @@ Matrix<3, 3, T> inverse(const Matrix<3, 3, T>& mat) noexcept
     return nm;
 }
 
+/**
+ * @brief Computes the inverse of a 4x4 matrix.
+ * @tparam T The type of elements in the matrix.
+ * @param mat The 4x4 matrix.
+ * @return The inverse of the matrix, or a null matrix if the matrix is non-invertible.
+ */
+template <typename T>
+Matrix<4, 4, T> inverse(const Matrix<4, 4, T>& mat) noexcept
+{
+    // 2x2 minors of the top two rows (s) and bottom two rows (c), shared by the cofactors. The storage is indexed directly, since bounds checks
+    // on each of the element reads would cost more than the arithmetic.
+    const T s0 = mat[0] * mat[5] - mat[4] * mat[1];
+    const T s1 = mat[0] * mat[6] - mat[4] * mat[2];
+    const T s2 = mat[0] * mat[7] - mat[4] * mat[3];
+    const T s3 = mat[1] * mat[6] - mat[5] * mat[2];
+    const T s4 = mat[1] * mat[7] - mat[5] * mat[3];
+    const T s5 = mat[2] * mat[7] - mat[6] * mat[3];
+    const T c0 = mat[8] * mat[13] - mat[12] * mat[9];
+    const T c1 = mat[8] * mat[14] - mat[12] * mat[10];
+    const T c2 = mat[8] * mat[15] - mat[12] * mat[11];
+    const T c3 = mat[9] * mat[14] - mat[13] * mat[10];
+    const T c4 = mat[9] * mat[15] - mat[13] * mat[11];
+    const T c5 = mat[10] * mat[15] - mat[14] * mat[11];
+
+    T det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+
+    if (std::abs(det) < std::numeric_limits<T>::epsilon()) { return Matrix<4, 4, T>::null(); }
+
+    T invDet = 1 / det;
+
+    return Matrix<4, 4, T>{(mat[5] * c5 - mat[6] * c4 + mat[7] * c3) * invDet,      (-mat[1] * c5 + mat[2] * c4 - mat[3] * c3) * invDet,
+                           (mat[13] * s5 - mat[14] * s4 + mat[15] * s3) * invDet,   (-mat[9] * s5 + mat[10] * s4 - mat[11] * s3) * invDet,
+                           (-mat[4] * c5 + mat[6] * c2 - mat[7] * c1) * invDet,     (mat[0] * c5 - mat[2] * c2 + mat[3] * c1) * invDet,
+                           (-mat[12] * s5 + mat[14] * s2 - mat[15] * s1) * invDet,  (mat[8] * s5 - mat[10] * s2 + mat[11] * s1) * invDet,
+                           (mat[4] * c4 - mat[5] * c2 + mat[7] * c0) * invDet,      (-mat[0] * c4 + mat[1] * c2 - mat[3] * c0) * invDet,
+                           (mat[12] * s4 - mat[13] * s2 + mat[15] * s0) * invDet,   (-mat[8] * s4 + mat[9] * s2 - mat[11] * s0) * invDet,
+                           (-mat[4] * c3 + mat[5] * c1 - mat[6] * c0) * invDet,     (mat[0] * c3 - mat[1] * c1 + mat[2] * c0) * invDet,
+                           (-mat[12] * s3 + mat[13] * s1 - mat[14] * s0) * invDet,  (mat[8] * s3 - mat[9] * s1 + mat[10] * s0) * invDet};
+}
+
 /**
  * @brief Solves a linear system of equations (`Ux = b`) using LU decomposition.
  * @tparam n The size of the square matrix (n x n) and vectors (n X 1).
@@ -318,7 +359,7 @@ Matrix<n, m, T> transpose(const Matrix<m, n, T>& mat) noexcept
 
     for (uint16_t row = 0; row < m; row++)
     {
-        for (uint16_t col = 0; col < n; col++) { nm(col, row) = mat(row, col); }
+        for (uint16_t col = 0; col < n; col++) { nm[col * m + row] = mat[row * n + col]; }
     }
 
     return nm;
@@ -24,6 +24,7 @@
 #ifndef VN_LINEARLEASTSQUARES_HPP_
 #define VN_LINEARLEASTSQUARES_HPP_
 
+#include <array>
 #include <cmath>
 
 #include "vectornav/Debug.hpp"
@@ -40,7 +41,8 @@ namespace Math
  * @brief Class for solving Linear Least Squares problems.
  * This class provides an implementation of the Linear Least Squares (LLS) method.
  * It solves the equation `Ax = b` using the normal equation `HTH * x = HTy * b`,
- * where `H` is a matrix and `b` is a vector, by performing eigen decomposition
+ * where `H` is a matrix and `b` is a vector, by performing a symmetric eigen decomposition,
+ * or with Cholesky factorization of the normal equations or Householder QR of `H` itself.
  */
 class LinearLeastSquares
 {
@@ -71,13 +73,26 @@ public:
         LlsError error;                   ///< Error code indicating the status of the solution.
     };
 
+    /**
+     * @brief Structure holding the solution of a Linear Least Squares problem found by factorization.
+     * @tparam n The size of the solution vector (n x 1).
+     * @tparam T The type of elements in the vector.
+     */
+    template <uint16_t n, typename T>
+    struct FactorizedSolution
+    {
+        Matrix<n, 1, T> solution;  ///< Solution vector `x`. Entries past the rank are zero.
+        uint16_t rank;             ///< Number of independent columns found by the factorization.
+        LlsError error;            ///< InsufficientData if the rank is less than n.
+    };
+
     /**
      * @brief Default constructor.
      */
     LinearLeastSquares() = default;
 
     /**
-     * @brief Solves the Linear Least Squares problem using eigen decomposition.
+     * @brief Solves the Linear Least Squares problem using symmetric eigen decomposition.
      * @tparam n The size of the matrix (n x n) and vector (n x 1).
      * @tparam T The type of elements in the matrix and vector.
      * @param HTH The matrix `HTH`.
@@ -92,7 +107,7 @@ public:
         LeastSquaresSolution<n, T> solution{Matrix<n, 1, T>(0.0), Matrix<n, n, T>(0.0), Matrix<n, 1, T>(0.0), Matrix<n, 1, T>(0.0), 0.0, LlsError::None};
 
         EigenDecomposition eigenDecomp;
-        if (eigenDecomp.computeDecomposition(HTH, solution.eigenValuesReal, solution.eigenValuesImag, solution.eigenVectors))
+        if (eigenDecomp.computeSymmetricDecomposition(HTH, solution.eigenValuesReal, solution.eigenVectors))
         {
             solution.error = LlsError::FailedEigenDecomposition;
             return solution;
@@ -120,21 +135,188 @@ public:
 
         return solution;
     }
+
+    /**
+     * @brief Solves the Linear Least Squares problem by Cholesky factorization of the normal equations.
+     * The cheapest path when `HTH` and `HTy` are already accumulated, but the normal equations square the condition number of `H`.
+     * @tparam n The size of the matrix (n x n) and vector (n x 1).
+     * @tparam T The type of elements in the matrix and vector.
+     * @param HTH The symmetric matrix `HTH`. Only the lower triangle is read.
+     * @param HTy The matrix `HTy`.
+     * @param rankTolerance Pivots at or below this fraction of the largest diagonal element of `HTH` end the factorization.
+     * @return A structure containing the solution, or InsufficientData with a zero solution if `HTH` is not positive definite.
+     */
+    template <uint16_t n, typename T>
+    FactorizedSolution<n, T> solveCholesky(const Matrix<n, n, T>& HTH, const Matrix<n, 1, T>& HTy,
+                                           T rankTolerance = n * std::numeric_limits<T>::epsilon()) noexcept
+    {
+        FactorizedSolution<n, T> solution{Matrix<n, 1, T>(0.0), 0, LlsError::None};
+
+        T maxDiagonal{0};
+        for (uint16_t i{0}; i < n; ++i) maxDiagonal = std::max(maxDiagonal, HTH(i, i));
+
+        // HTH = L * transpose(L), with L overwriting the lower triangle of l
+        Matrix<n, n, T> l = HTH;
+        for (uint16_t j{0}; j < n; ++j)
+        {
+            T pivot = l(j, j);
+            for (uint16_t k{0}; k < j; ++k) pivot -= l(j, k) * l(j, k);
+            if (!(pivot > rankTolerance * maxDiagonal))
+            {
+                solution.rank = j;
+                solution.error = LlsError::InsufficientData;
+                return solution;
+            }
+            l(j, j) = std::sqrt(pivot);
+            for (uint16_t i = j + 1; i < n; ++i)
+            {
+                T sum = l(i, j);
+                for (uint16_t k{0}; k < j; ++k) sum -= l(i, k) * l(j, k);
+                l(i, j) = sum / l(j, j);
+            }
+        }
+        solution.rank = n;
+
+        // Forward substitution for L * z = HTy, then back substitution for transpose(L) * x = z
+        Matrix<n, 1, T>& x = solution.solution;
+        for (uint16_t i{0}; i < n; ++i)
+        {
+            T sum = HTy(i);
+            for (uint16_t k{0}; k < i; ++k) sum -= l(i, k) * x(k);
+            x(i) = sum / l(i, i);
+        }
+        for (int i = n - 1; i >= 0; --i)
+        {
+            T sum = x(i);
+            for (uint16_t k = i + 1; k < n; ++k) sum -= l(k, i) * x(k);
+            x(i) = sum / l(i, i);
+        }
+
+        return solution;
+    }
+
+    /**
+     * @brief Solves the Linear Least Squares problem `Hx = y` by Householder QR with column pivoting.
+     * Works on `H` directly rather than forming the normal equations, so accuracy degrades with the condition number of `H` instead of its
+     * square. Rank-deficient problems get the basic solution, with the dependent columns' entries zero.
+     * @tparam m The number of rows in the matrix and size of vector.
+     * @tparam n The number of columns in the matrix.
+     * @tparam T The type of elements in the matrix and vector.
+     * @param H The matrix `H`, overwritten by the factorization.
+     * @param y The vector `y`, overwritten by `transpose(Q) * y`.
+     * @param rankTolerance Diagonal elements of `R` at or below this fraction of the largest end the rank.
+     * @return A structure containing the solution and the numerical rank of `H`.
+     */
+    template <uint16_t m, uint16_t n, typename T>
+    FactorizedSolution<n, T> solveQR(Matrix<m, n, T>& H, Matrix<m, 1, T>& y, T rankTolerance = m * std::numeric_limits<T>::epsilon()) noexcept
+    {
+        static_assert(m >= n, "Least squares needs at least as many rows as unknowns.");
+        FactorizedSolution<n, T> solution{Matrix<n, 1, T>(0.0), 0, LlsError::None};
+
+        std::array<uint16_t, n> permutation;
+        std::array<T, n> columnNorms;  // Squared norms of the unreduced part of each column
+        std::array<T, n> columnNormsAtCheck;
+        columnNorms.fill(0);
+        for (uint16_t i{0}; i < m; ++i)
+        {
+            for (uint16_t j{0}; j < n; ++j) columnNorms[j] += H[i * n + j] * H[i * n + j];
+        }
+        for (uint16_t j{0}; j < n; ++j) permutation[j] = j;
+        columnNormsAtCheck = columnNorms;
+
+        uint16_t rank{0};
+        T firstDiagonal{0};
+        for (uint16_t k{0}; k < n; ++k)
+        {
+            // Bring the column with the most remaining norm to k
+            uint16_t pivot = k;
+            for (uint16_t j = k + 1; j < n; ++j)
+            {
+                if (columnNorms[j] > columnNorms[pivot]) pivot = j;
+            }
+            if (pivot != k)
+            {
+                for (uint16_t i{0}; i < m; ++i) std::swap(H(i, k), H(i, pivot));
+                std::swap(permutation[k], permutation[pivot]);
+                std::swap(columnNorms[k], columnNorms[pivot]);
+                std::swap(columnNormsAtCheck[k], columnNormsAtCheck[pivot]);
+            }
+
+            // Householder reflection I - 2vv'/v'v taking H(k:m, k) to (alpha, 0, ...), with v stored in place below the diagonal
+            T alpha{0};
+            for (uint16_t i = k; i < m; ++i) alpha += H(i, k) * H(i, k);
+            alpha = std::sqrt(alpha);
+            if (k == 0) firstDiagonal = alpha;
+            if (!(alpha > rankTolerance * firstDiagonal)) break;
+            if (H(k, k) > 0) alpha = -alpha;
+            const T v0 = H(k, k) - alpha;
+            const T vNormSquared = -2 * alpha * v0;  // v'v, as |H(k:m, k)|^2 == alpha^2
+            H(k, k) = alpha;
+            ++rank;
+
+            // Apply the reflection to the remaining columns and y, a row at a time to stay in contiguous memory
+            std::array<T, n + 1> scale;  // 2 v'c / v'v for each remaining column c, then for y
+            for (uint16_t j = k + 1; j < n; ++j) scale[j] = v0 * H[k * n + j];
+            scale[n] = v0 * y[k];
+            for (uint16_t i = k + 1; i < m; ++i)
+            {
+                const T vi = H[i * n + k];
+                for (uint16_t j = k + 1; j < n; ++j) scale[j] += vi * H[i * n + j];
+                scale[n] += vi * y[i];
+            }
+            for (uint16_t j = k + 1; j <= n; ++j) scale[j] *= 2 / vNormSquared;
+
+            for (uint16_t j = k + 1; j < n; ++j) H[k * n + j] -= scale[j] * v0;
+            y[k] -= scale[n] * v0;
+            for (uint16_t i = k + 1; i < m; ++i)
+            {
+                const T vi = H[i * n + k];
+                for (uint16_t j = k + 1; j < n; ++j) H[i * n + j] -= scale[j] * vi;
+                y[i] -= scale[n] * vi;
+            }
+
+            // Downdate the remaining norms, recomputing one once cancellation has eaten most of its digits
+            for (uint16_t j = k + 1; j < n; ++j)
+            {
+                columnNorms[j] -= H(k, j) * H(k, j);
+                if (columnNorms[j] < static_cast<T>(0.01) * columnNormsAtCheck[j])
+                {
+                    columnNorms[j] = 0;
+                    for (uint16_t i = k + 1; i < m; ++i) columnNorms[j] += H(i, j) * H(i, j);
+                    columnNormsAtCheck[j] = columnNorms[j];
+                }
+            }
+        }
+
+        // Back substitution on the leading rank x rank block of R, undoing the column pivoting
+        Matrix<n, 1, T> z(0.0);
+        for (int i = rank - 1; i >= 0; --i)
+        {
+            T sum = y(i);
+            for (uint16_t j = i + 1; j < rank; ++j) sum -= H(i, j) * z(j);
+            z(i) = sum / H(i, i);
+        }
+        for (uint16_t j{0}; j < n; ++j) solution.solution(permutation[j]) = z(j);
+
+        solution.rank = rank;
+        if (rank < n) solution.error = LlsError::InsufficientData;
+        return solution;
+    }
 };
 
 /**
- * @brief Solves the Linear Least Squares problem using LU decomposition.
+ * @brief Solves the Linear Least Squares problem using Householder QR decomposition.
  * @tparam m The number of rows in the matrix and size of vector.
  * @tparam n The number of columns in the matrix.
  * @tparam T The the type of elements in the matrix and vector.
  * @param A The matrix `A` in the equation `Ax = y`.
  * @param y The vector `y` in the equation `Ax = y`.
- * @return The solution vector `x`.
+ * @return The solution vector `x`. Entries for columns found to be linearly dependent are zero.
  */
 template <uint16_t m, uint16_t n, typename T>
-Matrix<n, 1, T> solveLinearLeastSquares(Matrix<m, n, T> A, const Matrix<m, 1, T>& y) noexcept
+Matrix<n, 1, T> solveLinearLeastSquares(Matrix<m, n, T> A, Matrix<m, 1, T> y) noexcept
 {
-    return solveLinearSystemLU(transpose(A) * A, transpose(A) * y);
+    return LinearLeastSquares().solveQR(A, y).solution;
 }
 
 }  // namespace Math
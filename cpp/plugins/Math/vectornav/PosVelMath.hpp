@@ -25,6 +25,7 @@
 #define VN_POSVELMATH_HPP_
 #include <cmath>
 
+#include "vectornav/BatchMath.hpp"
 #include "vectornav/Conversions.hpp"
 #include "vectornav/Implementation/MeasurementDatatypes.hpp"
 #include "vectornav/TemplateLibrary/Matrix.hpp"
@@ -84,12 +85,12 @@ inline Lla ecef2lla(const Vec3d& ecef) noexcept
     double betaNew = std::atan2(C_EPSILON * std::sin(phi), std::cos(phi));
 
     int count = 0;
-    while ((std::fabs(beta - betaNew) < 1e-11) && (count < 5))
+    while ((std::fabs(beta - betaNew) > 1e-11) && (count < 5))
     {
         beta = betaNew;
         sb = std::sin(betaNew);
         cb = std::cos(betaNew);
-        phi = std::atan2(ecef[2] + C_BBAR * sb * sb * sb, rho - C_EPSILON * cb * cb * cb);
+        phi = std::atan2(ecef[2] + C_BBAR * sb * sb * sb, rho - C_ABAR * cb * cb * cb);
         betaNew = std::atan2(C_EPSILON * sin(phi), cos(phi));
         count++;
     }
@@ -128,6 +129,208 @@ inline Vec3d lla2ecef(const Lla& lla) noexcept
     };
 }
 
+// ------------------------------------------
+// Batched conversions
+// ------------------------------------------
+// These convert arrays of positions with the fixed-lane kernels of BatchMath.hpp. Outputs may alias inputs.
+
+/// Latitude, longitude and altitude samples, one array per component.
+struct LlaArrays
+{
+    double* lat;
+    double* lon;
+    double* alt;
+};
+
+/// Three-component vector samples, one array per component.
+struct Vec3dArrays
+{
+    double* x;
+    double* y;
+    double* z;
+};
+
+namespace Batch
+{
+
+/**
+ * @brief Lane form of ecef2lla.
+ * @details Runs Bowring's iteration a fixed two times, carrying the parametric and geodetic latitudes as sine-cosine pairs rather than angles.
+ * The error after two iterations is below 1 um in latitude and altitude from the Earth's centre out past geostationary orbit.
+ */
+inline void ecef2lla(const double x, const double y, const double z, double& lat, double& lon, double& alt) noexcept
+{
+    const double rho = sqrt(x * x + y * y);
+    double u = C_EPSILON * rho;  // cos(beta) and sin(beta), unnormalized
+    double v = z;
+    double num = 0.0, den = 0.0, sinPhi = 0.0, cosPhi = 0.0;
+    for (uint8_t iteration = 0; iteration < 2; ++iteration)
+    {
+        const double kBeta = rsqrt(u * u + v * v);
+        const double sb = v * kBeta;
+        const double cb = u * kBeta;
+        num = z + C_BBAR * sb * sb * sb;
+        den = rho - C_ABAR * cb * cb * cb;
+        const double kPhi = rsqrt(num * num + den * den);
+        sinPhi = num * kPhi;
+        cosPhi = den * kPhi;
+        u = cosPhi;
+        v = C_EPSILON * sinPhi;
+    }
+    const double n = C_EARTHR * rsqrt(1.0 - C_E2 * sinPhi * sinPhi);
+    lat = rad2deg(atan2(num, den));
+    lon = rad2deg(atan2(y, x));
+    alt = rho * cosPhi + (z + C_E2 * n * sinPhi) * sinPhi - n;
+}
+
+/// Lane form of lla2ecef, in the prime vertical radius of curvature form.
+inline void lla2ecef(const double lat, const double lon, const double alt, double& x, double& y, double& z) noexcept
+{
+    double sinLat, cosLat, sinLon, cosLon;
+    sinCos(deg2rad(lat), sinLat, cosLat);
+    sinCos(deg2rad(lon), sinLon, cosLon);
+    const double n = C_EARTHR * rsqrt(1.0 - C_E2 * sinLat * sinLat);
+    x = (n + alt) * cosLat * cosLon;
+    y = (n + alt) * cosLat * sinLon;
+    z = (n * (1.0 - C_E2) + alt) * sinLat;
+}
+
+}  // namespace Batch
+
+/**
+ * @brief Converts ECEF position samples to LLA, to within 1 um of ecef2lla(const Vec3d&).
+ * @param ecef ECEF positions (meters).
+ * @param lla Receives latitude and longitude (degrees) and altitude (meters).
+ * @param count Number of samples.
+ */
+inline void ecef2lla(const Vec3dArrays& ecef, const LlaArrays& lla, const size_t count) noexcept
+{
+    Batch::forEachBlock({ecef.x, ecef.y, ecef.z}, {lla.lat, lla.lon, lla.alt}, count, [](const auto& in, auto& out) {
+        for (uint8_t l = 0; l < Batch::LANES; ++l) { Batch::ecef2lla(in[0][l], in[1][l], in[2][l], out[0][l], out[1][l], out[2][l]); }
+    });
+}
+
+/**
+ * @brief Converts LLA position samples to ECEF, to within 1 um of lla2ecef(const Lla&).
+ * @param lla Latitude and longitude (degrees) and altitude (meters).
+ * @param ecef Receives ECEF positions (meters).
+ * @param count Number of samples.
+ */
+inline void lla2ecef(const LlaArrays& lla, const Vec3dArrays& ecef, const size_t count) noexcept
+{
+    Batch::forEachBlock({lla.lat, lla.lon, lla.alt}, {ecef.x, ecef.y, ecef.z}, count, [](const auto& in, auto& out) {
+        for (uint8_t l = 0; l < Batch::LANES; ++l) { Batch::lla2ecef(in[0][l], in[1][l], in[2][l], out[0][l], out[1][l], out[2][l]); }
+    });
+}
+
+/**
+ * @brief A local tangent plane about a reference position, converting ECEF positions to and from north-east-down (NED) and east-north-up
+ * (ENU) offsets.
+ * @details The reference's ECEF position and the ECEF to NED rotation are computed once on construction.
+ */
+class LocalTangentPlane
+{
+public:
+    /// @param reference Origin of the plane given as LLA.
+    explicit LocalTangentPlane(const Lla& reference) noexcept : _reference(reference), _originEcef(lla2ecef(reference))
+    {
+        const double lat = deg2rad(reference.lat);
+        const double lon = deg2rad(reference.lon);
+        const double sinLat = std::sin(lat), cosLat = std::cos(lat);
+        const double sinLon = std::sin(lon), cosLon = std::cos(lon);
+        _ecefToNed = Mat3d{-sinLat * cosLon, -sinLat * sinLon, cosLat,  //
+                           -sinLon,          cosLon,           0.0,     //
+                           -cosLat * cosLon, -cosLat * sinLon, -sinLat};
+        _ecefToEnu = Mat3d{-sinLon,         cosLon,          0.0,     //
+                           -sinLat * cosLon, -sinLat * sinLon, cosLat,  //
+                           cosLat * cosLon, cosLat * sinLon, sinLat};
+    }
+
+    const Lla& reference() const noexcept { return _reference; }
+    const Vec3d& originEcef() const noexcept { return _originEcef; }
+    /// Rotation taking ECEF vectors to NED.
+    const Mat3d& ecefToNed() const noexcept { return _ecefToNed; }
+    /// Rotation taking ECEF vectors to ENU.
+    const Mat3d& ecefToEnu() const noexcept { return _ecefToEnu; }
+
+    Vec3d ecef2ned(const Vec3d& ecef) const noexcept { return _toLocal(_ecefToNed, ecef); }
+    Vec3d ned2ecef(const Vec3d& ned) const noexcept { return _toEcef(_ecefToNed, ned); }
+    Vec3d ecef2enu(const Vec3d& ecef) const noexcept { return _toLocal(_ecefToEnu, ecef); }
+    Vec3d enu2ecef(const Vec3d& enu) const noexcept { return _toEcef(_ecefToEnu, enu); }
+
+    /**
+     * @brief Converts ECEF position samples to NED offsets from the reference.
+     * @param ecef ECEF positions (meters).
+     * @param ned Receives north, east and down offsets (meters).
+     * @param count Number of samples.
+     */
+    void ecef2ned(const Vec3dArrays& ecef, const Vec3dArrays& ned, const size_t count) const noexcept
+    {
+        _rotate(_ecefToNed, _originEcef, {ecef.x, ecef.y, ecef.z}, {ned.x, ned.y, ned.z}, count, false);
+    }
+
+    /// Inverse of ecef2ned.
+    void ned2ecef(const Vec3dArrays& ned, const Vec3dArrays& ecef, const size_t count) const noexcept
+    {
+        _rotate(_ecefToNed, _originEcef, {ned.x, ned.y, ned.z}, {ecef.x, ecef.y, ecef.z}, count, true);
+    }
+
+    /// As ecef2ned, with the outputs as east, north and up offsets.
+    void ecef2enu(const Vec3dArrays& ecef, const Vec3dArrays& enu, const size_t count) const noexcept
+    {
+        _rotate(_ecefToEnu, _originEcef, {ecef.x, ecef.y, ecef.z}, {enu.x, enu.y, enu.z}, count, false);
+    }
+
+    /// Inverse of ecef2enu.
+    void enu2ecef(const Vec3dArrays& enu, const Vec3dArrays& ecef, const size_t count) const noexcept
+    {
+        _rotate(_ecefToEnu, _originEcef, {enu.x, enu.y, enu.z}, {ecef.x, ecef.y, ecef.z}, count, true);
+    }
+
+private:
+    Lla _reference;
+    Vec3d _originEcef;
+    Mat3d _ecefToNed;
+    Mat3d _ecefToEnu;
+
+    Vec3d _toLocal(const Mat3d& r, const Vec3d& ecef) const noexcept
+    {
+        const Vec3d d = ecef - _originEcef;
+        return Vec3d{r(0, 0) * d[0] + r(0, 1) * d[1] + r(0, 2) * d[2],  //
+                     r(1, 0) * d[0] + r(1, 1) * d[1] + r(1, 2) * d[2],  //
+                     r(2, 0) * d[0] + r(2, 1) * d[1] + r(2, 2) * d[2]};
+    }
+
+    Vec3d _toEcef(const Mat3d& r, const Vec3d& local) const noexcept
+    {
+        return Vec3d{r(0, 0) * local[0] + r(1, 0) * local[1] + r(2, 0) * local[2] + _originEcef[0],  //
+                     r(0, 1) * local[0] + r(1, 1) * local[1] + r(2, 1) * local[2] + _originEcef[1],  //
+                     r(0, 2) * local[0] + r(1, 2) * local[1] + r(2, 2) * local[2] + _originEcef[2]};
+    }
+
+    /// Applies out = r * (in - offset) or, for the inverse, out = transpose(r) * in + offset.
+    static void _rotate(const Mat3d& r, const Vec3d& offset, const double* const (&in)[3], double* const (&out)[3], const size_t count,
+                        const bool inverse) noexcept
+    {
+        const double r00 = r(0, 0), r11 = r(1, 1), r22 = r(2, 2);
+        const double r01 = inverse ? r(1, 0) : r(0, 1), r02 = inverse ? r(2, 0) : r(0, 2), r12 = inverse ? r(2, 1) : r(1, 2);
+        const double r10 = inverse ? r(0, 1) : r(1, 0), r20 = inverse ? r(0, 2) : r(2, 0), r21 = inverse ? r(1, 2) : r(2, 1);
+        const double pre0 = inverse ? 0.0 : offset[0], pre1 = inverse ? 0.0 : offset[1], pre2 = inverse ? 0.0 : offset[2];
+        const double post0 = inverse ? offset[0] : 0.0, post1 = inverse ? offset[1] : 0.0, post2 = inverse ? offset[2] : 0.0;
+        Batch::forEachBlock(in, out, count, [&](const auto& blockIn, auto& blockOut) {
+            for (uint8_t l = 0; l < Batch::LANES; ++l)
+            {
+                const double a = blockIn[0][l] - pre0;
+                const double b = blockIn[1][l] - pre1;
+                const double c = blockIn[2][l] - pre2;
+                blockOut[0][l] = r00 * a + r01 * b + r02 * c + post0;
+                blockOut[1][l] = r10 * a + r11 * b + r12 * c + post1;
+                blockOut[2][l] = r20 * a + r21 * b + r22 * c + post2;
+            }
+        });
+    }
+};
+
 }  // namespace Math
 }  // namespace VN
 
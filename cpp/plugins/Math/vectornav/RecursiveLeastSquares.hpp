@@ -0,0 +1,169 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.99.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef VN_RECURSIVELEASTSQUARES_HPP_
+#define VN_RECURSIVELEASTSQUARES_HPP_
+
+#include <cmath>
+#include <cstdint>
+
+#include "vectornav/LinearLeastSquares.hpp"
+#include "vectornav/TemplateLibrary/Matrix.hpp"
+
+namespace VN
+{
+namespace Math
+{
+
+/**
+ * @brief Streaming solver for Linear Least Squares problems `Hx = y` whose rows arrive over time.
+ * Holds the upper triangular factor `R` of the rows seen so far and `transpose(Q) * y`, folding each new row in with Givens rotations.
+ * Memory is fixed at O(n^2) however many rows are added, each row costs O(n^2), and the current solution is a back substitution away.
+ * With a forgetting factor below one, the weight of older rows decays geometrically so the fit tracks slowly varying parameters.
+ * @tparam n The number of unknowns.
+ * @tparam T The type of elements in the matrices and vectors.
+ */
+template <uint16_t n, typename T>
+class RecursiveLeastSquares
+{
+public:
+    using Solution = LinearLeastSquares::FactorizedSolution<n, T>;
+
+    /**
+     * @brief Constructor.
+     * @param forgettingFactor Weight in (0, 1] applied to all earlier rows each time a row is added. One keeps every row at full weight.
+     */
+    explicit RecursiveLeastSquares(T forgettingFactor = 1) noexcept : _sqrtForgettingFactor(std::sqrt(forgettingFactor)) {}
+
+    /**
+     * @brief Adds one row of the system.
+     * @param h The row of `H`.
+     * @param y The matching element of `y`.
+     * @param weight Weight of this row relative to the others.
+     */
+    void addRow(const Matrix<n, 1, T>& h, T y, T weight = 1) noexcept
+    {
+        if (_sqrtForgettingFactor != 1)
+        {
+            _R *= _sqrtForgettingFactor;
+            _Qty *= _sqrtForgettingFactor;
+            _residualSumOfSquares *= _sqrtForgettingFactor * _sqrtForgettingFactor;
+        }
+
+        const T sqrtWeight = std::sqrt(weight);
+        Matrix<n, 1, T> row = h * sqrtWeight;
+        y *= sqrtWeight;
+
+        // Rotate the new row into R one column at a time, zeroing it from the left
+        for (uint16_t k{0}; k < n; ++k)
+        {
+            if (row(k) == 0) continue;
+            const T rho = std::sqrt(_R(k, k) * _R(k, k) + row(k) * row(k));
+            const T c = _R(k, k) / rho;
+            const T s = row(k) / rho;
+            _R(k, k) = rho;
+            for (uint16_t j = k + 1; j < n; ++j)
+            {
+                const T rkj = _R(k, j);
+                _R(k, j) = c * rkj + s * row(j);
+                row(j) = c * row(j) - s * rkj;
+            }
+            const T qk = _Qty(k);
+            _Qty(k) = c * qk + s * y;
+            y = c * y - s * qk;
+        }
+
+        _residualSumOfSquares += y * y;  // What the rotations leave of y is this row's residual
+        _rowCount++;
+    }
+
+    /**
+     * @brief Adds a batch of rows of the system, in order.
+     * @tparam m The number of rows in the batch.
+     * @param H The rows of `H`.
+     * @param y The matching elements of `y`.
+     */
+    template <uint16_t m>
+    void addRows(const Matrix<m, n, T>& H, const Matrix<m, 1, T>& y) noexcept
+    {
+        Matrix<n, 1, T> h;
+        for (uint16_t i{0}; i < m; ++i)
+        {
+            for (uint16_t j{0}; j < n; ++j) h(j) = H(i, j);
+            addRow(h, y(i));
+        }
+    }
+
+    /**
+     * @brief Solves for the current least squares estimate.
+     * @param rankTolerance Diagonal elements of `R` at or below this fraction of the largest mark their unknown as undetermined.
+     * @return A structure containing the solution. Undetermined unknowns are zero, and make the error InsufficientData.
+     */
+    Solution solve(T rankTolerance = n * std::numeric_limits<T>::epsilon()) const noexcept
+    {
+        Solution solution{Matrix<n, 1, T>(0.0), 0, LinearLeastSquares::LlsError::None};
+
+        T maxDiagonal{0};
+        for (uint16_t k{0}; k < n; ++k) maxDiagonal = std::max(maxDiagonal, std::abs(_R(k, k)));
+
+        Matrix<n, 1, T>& x = solution.solution;
+        for (int i = n - 1; i >= 0; --i)
+        {
+            if (!(std::abs(_R(i, i)) > rankTolerance * maxDiagonal)) continue;  // Leave undetermined unknowns at zero
+            T sum = _Qty(i);
+            for (uint16_t j = i + 1; j < n; ++j) sum -= _R(i, j) * x(j);
+            x(i) = sum / _R(i, i);
+            solution.rank++;
+        }
+
+        if (solution.rank < n) solution.error = LinearLeastSquares::LlsError::InsufficientData;
+        return solution;
+    }
+
+    /// Clears all rows, keeping the forgetting factor.
+    void reset() noexcept
+    {
+        _R = Matrix<n, n, T>(0);
+        _Qty = Matrix<n, 1, T>(0);
+        _residualSumOfSquares = 0;
+        _rowCount = 0;
+    }
+
+    /// Upper triangular factor of the weighted rows, such that transpose(R) * R == transpose(H) * H.
+    const Matrix<n, n, T>& getR() const noexcept { return _R; }
+    /// Weighted sum of squared residuals of the current solution.
+    T getResidualSumOfSquares() const noexcept { return _residualSumOfSquares; }
+    uint64_t getRowCount() const noexcept { return _rowCount; }
+
+private:
+    T _sqrtForgettingFactor;
+    Matrix<n, n, T> _R = Matrix<n, n, T>(0);
+    Matrix<n, 1, T> _Qty = Matrix<n, 1, T>(0);
+    T _residualSumOfSquares{0};
+    uint64_t _rowCount{0};
+};
+
+}  // namespace Math
+}  // namespace VN
+
+#endif  // VN_RECURSIVELEASTSQUARES_HPP_
@@ -24,6 +24,11 @@
 #ifndef VN_SAMPLESTATS_HPP_
 #define VN_SAMPLESTATS_HPP_
 
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
 #include "vectornav/Implementation/MeasurementDatatypes.hpp"
 #include "vectornav/LinearAlgebra.hpp"
 #include "vectornav/TemplateLibrary/Matrix.hpp"
@@ -33,45 +38,313 @@ namespace VN
 namespace Math
 {
 
+/// @brief Count, mean and sum of squared deviations of a set of samples. Two sets are combined with Chan's parallel update, which stays accurate
+/// however large the sets are.
+template <uint16_t n, typename T>
+struct SampleMoments
+{
+    static constexpr uint16_t LANES = 4;
+    static constexpr uint16_t STRIDE = LANES * n;
+    static_assert(sizeof(Matrix<n, 1, T>) == n * sizeof(T), "Batched kernels treat runs of samples as one packed array.");
+
+    uint64_t count = 0;
+    Matrix<n, 1, T> mean = Matrix<n, 1, T>(0);
+    Matrix<n, 1, T> sumSqDev = Matrix<n, 1, T>(0);
+
+    /// Two-pass moments of a contiguous run of samples, shifted by the first sample so large offsets do not cost precision. The samples are walked
+    /// as a flat array, STRIDE values (LANES samples) at a time into independent accumulators, so the additions vectorize and do not wait on each
+    /// other.
+    static SampleMoments fromSamples(const Matrix<n, 1, T>* samples, size_t sampleCount) noexcept
+    {
+        SampleMoments out;
+        if (sampleCount == 0) { return out; }
+        const T* data = samples[0].data();
+        const size_t laneEnd = (sampleCount - sampleCount % LANES) * n;
+        const size_t end = sampleCount * n;
+
+        std::array<T, STRIDE> offset;
+        for (uint16_t k = 0; k < STRIDE; k++) { offset[k] = data[k % n]; }
+        std::array<T, STRIDE> acc{};
+        for (size_t i = 0; i < laneEnd; i += STRIDE)
+        {
+            for (uint16_t k = 0; k < STRIDE; k++) { acc[k] += data[i + k] - offset[k]; }
+        }
+        for (size_t i = laneEnd; i < end; i++) { acc[i - laneEnd] += data[i] - offset[i - laneEnd]; }
+        for (uint16_t c = 0; c < n; c++)
+        {
+            T sum{0};
+            for (uint16_t j = 0; j < LANES; j++) { sum += acc[j * n + c]; }
+            out.mean[c] = offset[c] + sum / static_cast<T>(sampleCount);
+        }
+
+        for (uint16_t k = 0; k < STRIDE; k++) { offset[k] = out.mean[k % n]; }
+        acc.fill(T{0});
+        for (size_t i = 0; i < laneEnd; i += STRIDE)
+        {
+            for (uint16_t k = 0; k < STRIDE; k++)
+            {
+                const T d = data[i + k] - offset[k];
+                acc[k] += d * d;
+            }
+        }
+        for (size_t i = laneEnd; i < end; i++)
+        {
+            const T d = data[i] - offset[i - laneEnd];
+            acc[i - laneEnd] += d * d;
+        }
+        for (uint16_t c = 0; c < n; c++)
+        {
+            for (uint16_t j = 0; j < LANES; j++) { out.sumSqDev[c] += acc[j * n + c]; }
+        }
+        out.count = sampleCount;
+        return out;
+    }
+
+    /// Largest squared norm in a contiguous run of samples, starting from initial.
+    static T maxNormSquared(const Matrix<n, 1, T>* samples, size_t sampleCount, T initial) noexcept
+    {
+        const T* data = samples[0].data();
+        const size_t laneEnd = (sampleCount - sampleCount % LANES) * n;
+        std::array<T, LANES> best;
+        best.fill(initial);
+        for (size_t i = 0; i < laneEnd; i += STRIDE)
+        {
+            std::array<T, STRIDE> sq;
+            for (uint16_t k = 0; k < STRIDE; k++) { sq[k] = data[i + k] * data[i + k]; }
+            for (uint16_t j = 0; j < LANES; j++)
+            {
+                T normSquared{0};
+                for (uint16_t c = 0; c < n; c++) { normSquared += sq[j * n + c]; }
+                best[j] = (normSquared > best[j]) ? normSquared : best[j];
+            }
+        }
+        for (size_t i = laneEnd / n; i < sampleCount; i++)
+        {
+            T normSquared{0};
+            for (uint16_t c = 0; c < n; c++) { normSquared += samples[i][c] * samples[i][c]; }
+            best[0] = (normSquared > best[0]) ? normSquared : best[0];
+        }
+        T out = best[0];
+        for (uint16_t j = 1; j < LANES; j++) { out = (best[j] > out) ? best[j] : out; }
+        return out;
+    }
+
+    void addSample(const Matrix<n, 1, T>& meas) noexcept
+    {
+        count++;
+        const T invCount = static_cast<T>(1) / static_cast<T>(count);
+        for (uint16_t c = 0; c < n; c++)
+        {
+            const T delta = meas[c] - mean[c];
+            mean[c] += delta * invCount;
+            sumSqDev[c] += delta * (meas[c] - mean[c]);
+        }
+    }
+
+    void merge(const SampleMoments& other) noexcept
+    {
+        if (other.count == 0) { return; }
+        if (count == 0)
+        {
+            *this = other;
+            return;
+        }
+        const uint64_t total = count + other.count;
+        const T otherWeight = static_cast<T>(other.count) / static_cast<T>(total);
+        const T crossWeight = static_cast<T>(count) * otherWeight;
+        for (uint16_t c = 0; c < n; c++)
+        {
+            const T delta = other.mean[c] - mean[c];
+            mean[c] += delta * otherWeight;
+            sumSqDev[c] += other.sumSqDev[c] + delta * delta * crossWeight;
+        }
+        count = total;
+    }
+
+    Matrix<n, 1, T> getVariance() const noexcept { return (count > 1) ? sumSqDev / static_cast<T>(count - 1) : Matrix<n, 1, T>(0); }
+};
+
+/// @brief Cumulative mean, variance and maximum norm of a stream of samples.
+/// Samples are gathered into blocks of BLOCK_SIZE, and full blocks are merged pairwise (like a binary counter). The rounding error then grows with
+/// the log of the sample count instead of linearly, which keeps single precision usable past 10^9 samples.
 template <uint16_t n, typename T>
 class SampleStats
 {
 public:
+    using Moments = SampleMoments<n, T>;
+    static constexpr uint32_t BLOCK_SIZE = 1024;
+
     SampleStats() = default;
 
-    void addSample(Matrix<n, 1, T> meas) noexcept
+    void addSample(const Matrix<n, 1, T>& meas) noexcept
+    {
+        _count++;
+        const T normSquared = _normSquared(meas);
+        if (normSquared > _maxNormSquared) { _maxNormSquared = normSquared; }
+        _block.addSample(meas);
+        if (_block.count == BLOCK_SIZE)
+        {
+            _pushBlock(_block);
+            _block = Moments{};
+        }
+    }
+
+    /// Adds sampleCount contiguous samples. Whole blocks are reduced with the two-pass kernel, which is several times faster than per-sample updates.
+    void addSamples(const Matrix<n, 1, T>* samples, size_t sampleCount) noexcept
+    {
+        size_t i = 0;
+        while (i < sampleCount && _block.count != 0) { addSample(samples[i++]); }
+        for (; i + BLOCK_SIZE <= sampleCount; i += BLOCK_SIZE)
+        {
+            _maxNormSquared = Moments::maxNormSquared(samples + i, BLOCK_SIZE, _maxNormSquared);
+            _pushBlock(Moments::fromSamples(samples + i, BLOCK_SIZE));
+            _count += BLOCK_SIZE;
+        }
+        for (; i < sampleCount; i++) { addSample(samples[i]); }
+    }
+
+    /// Folds in statistics gathered elsewhere, e.g. by another thread over a different slice of the data.
+    void merge(const SampleStats& other) noexcept
+    {
+        if (other._count == 0) { return; }
+        _merged.merge(other.getMoments());
+        if (other._maxNormSquared > _maxNormSquared) { _maxNormSquared = other._maxNormSquared; }
+        _count += other._count;
+    }
+
+    Moments getMoments() const noexcept
     {
-        _cnt++;
+        Moments out = _block;
+        for (const auto& level : _levels) { out.merge(level); }
+        out.merge(_merged);
+        return out;
+    }
+
+    Matrix<n, 1, T> getMean() const noexcept { return getMoments().mean; }
+    Matrix<n, 1, T> getVariance() const noexcept { return getMoments().getVariance(); }
+    Matrix<n, 1, T> getStdDev() const noexcept { return element_sqrt(getVariance()); }
+    T getMaxNorm() const noexcept { return std::sqrt(_maxNormSquared); }
+    uint64_t getCount() const noexcept { return _count; }
+    void reset() noexcept { *this = SampleStats{}; }
+
+private:
+    // Level k holds either nothing or exactly 2^k blocks, enough levels for 2^64 samples.
+    static constexpr uint8_t LEVEL_COUNT = 55;
+
+    Moments _block;
+    std::array<Moments, LEVEL_COUNT> _levels{};
+    Moments _merged;
+    T _maxNormSquared{0};
+
+    uint64_t _count = 0;
+
+    static T _normSquared(const Matrix<n, 1, T>& meas) noexcept
+    {
+        T out{0};
+        for (uint16_t c = 0; c < n; c++) { out += meas[c] * meas[c]; }
+        return out;
+    }
 
-        T measNorm = Math::norm(meas);
-        if (_cnt == 1)
+    void _pushBlock(Moments carry) noexcept
+    {
+        for (uint8_t level = 0; level < LEVEL_COUNT - 1; level++)
         {
-            _mean = meas;
-            _Q = meas - _mean;  // initializes to zero
-            _max = measNorm;
+            if (_levels[level].count == 0)
+            {
+                _levels[level] = carry;
+                return;
+            }
+            carry.merge(_levels[level]);
+            _levels[level] = Moments{};
         }
+        _levels[LEVEL_COUNT - 1].merge(carry);
+    }
+};
+
+/// @brief Mean, variance and maximum norm over the most recent Capacity samples, updated in O(1) per sample.
+/// Once the window is full, the mean and squared deviations are updated by swapping the oldest sample for the newest, and recomputed from the window
+/// every Capacity replacements so rounding does not drift. The maximum norm is tracked with a monotonic queue.
+template <uint16_t n, typename T, uint32_t Capacity>
+class WindowedSampleStats
+{
+    static_assert(Capacity > 1, "A window needs at least two samples.");
+
+public:
+    using Moments = SampleMoments<n, T>;
+
+    WindowedSampleStats() = default;
+
+    void addSample(const Matrix<n, 1, T>& meas) noexcept
+    {
+        const uint32_t slot = _slot;
+        _slot = (slot + 1 == Capacity) ? 0 : slot + 1;
+
+        bool refresh = false;
+        if (_moments.count < Capacity) { _moments.addSample(meas); }
         else
         {
-            Matrix<n, 1, T> res = (meas - _mean) / static_cast<T>(_cnt);
-            _mean += res;
-            _Q += static_cast<T>((_cnt - 1) * _cnt) * element_mul(res, res);
-            if (measNorm > _max) { _max = measNorm; }
+            const Matrix<n, 1, T>& oldest = _samples[slot];
+            constexpr T invCount = static_cast<T>(1) / static_cast<T>(Capacity);
+            for (uint16_t c = 0; c < n; c++)
+            {
+                const T oldMean = _moments.mean[c];
+                const T delta = meas[c] - oldest[c];
+                _moments.mean[c] += delta * invCount;
+                _moments.sumSqDev[c] += delta * (meas[c] - _moments.mean[c] + oldest[c] - oldMean);
+            }
+            refresh = (++_sinceRefresh == Capacity);
+        }
+
+        // The slot being overwritten holds the oldest sample, so it can only be at the head of the queue.
+        if (_maxSize != 0 && _maxQueue[_maxHead] == slot)
+        {
+            _maxHead = _wrap(_maxHead + 1);
+            _maxSize--;
+        }
+        T normSquared{0};
+        for (uint16_t c = 0; c < n; c++) { normSquared += meas[c] * meas[c]; }
+        while (_maxSize != 0 && _normsSquared[_maxQueue[_wrap(_maxHead + _maxSize - 1)]] <= normSquared) { _maxSize--; }
+        _maxQueue[_wrap(_maxHead + _maxSize)] = slot;
+        _maxSize++;
+
+        _samples[slot] = meas;
+        _normsSquared[slot] = normSquared;
+
+        if (refresh)
+        {
+            _moments = Moments::fromSamples(_samples.data(), Capacity);
+            _sinceRefresh = 0;
         }
     }
 
-    Matrix<n, 1, T> getMean() const noexcept { return _mean; }
-    Matrix<n, 1, T> getVariance() const noexcept { return (_cnt > 1) ? _Q / static_cast<T>(_cnt - 1) : Matrix<n, 1, T>{0}; }
+    Moments getMoments() const noexcept { return _moments; }
+    Matrix<n, 1, T> getMean() const noexcept { return _moments.mean; }
+    Matrix<n, 1, T> getVariance() const noexcept { return _moments.getVariance(); }
     Matrix<n, 1, T> getStdDev() const noexcept { return element_sqrt(getVariance()); }
-    T getMaxNorm() const noexcept { return _max; }
-    uint16_t getCount() const noexcept { return _cnt; }
-    void reset() noexcept { _cnt = 0; }
+    T getMaxNorm() const noexcept { return (_maxSize == 0) ? T{0} : std::sqrt(_normsSquared[_maxQueue[_maxHead]]); }
+    uint32_t getCount() const noexcept { return static_cast<uint32_t>(_moments.count); }
+    bool isFull() const noexcept { return _moments.count == Capacity; }
+    void reset() noexcept
+    {
+        _moments = Moments{};
+        _slot = 0;
+        _sinceRefresh = 0;
+        _maxHead = 0;
+        _maxSize = 0;
+    }
 
 private:
-    Matrix<n, 1, T> _mean = Matrix<n, 1, T>(0);
-    Matrix<n, 1, T> _Q = Matrix<n, 1, T>(0);
-    T _max{0};
+    std::array<Matrix<n, 1, T>, Capacity> _samples{};
+    std::array<T, Capacity> _normsSquared{};
+    std::array<uint32_t, Capacity> _maxQueue{};  // Slots of samples with decreasing norms, oldest first
+    uint32_t _maxHead = 0;
+    uint32_t _maxSize = 0;
+
+    Moments _moments;
+    uint32_t _slot = 0;
+    uint32_t _sinceRefresh = 0;
 
-    uint16_t _cnt = 0;
+    static uint32_t _wrap(uint32_t idx) noexcept { return (idx >= Capacity) ? idx - Capacity : idx; }
 };
 
 }  // namespace Math
@@ -0,0 +1,484 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.99.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef VN_TIMEALIGNMENT_HPP_
+#define VN_TIMEALIGNMENT_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "vectornav/AttitudeMath.hpp"
+#include "vectornav/Config.hpp"
+#include "vectornav/Interface/CompositeData.hpp"
+#include "vectornav/Interface/Errors.hpp"
+#include "vectornav/TemplateLibrary/DirectAccessQueue.hpp"
+#include "vectornav/TemplateLibrary/Matrix.hpp"
+
+namespace VN
+{
+namespace Math
+{
+
+/// @brief The time group output a measurement is indexed by. TimeSyncIn restarts at every SyncIn event, so it only orders measurements between two
+/// events.
+enum class TimeSource : uint8_t
+{
+    TimeStartup,
+    TimeGps,
+    TimeSyncIn
+};
+
+/// @brief Returns the measurement's time in nanoseconds from the requested source, or nullopt if the measurement does not carry it.
+inline std::optional<uint64_t> getTimestamp([[maybe_unused]] const CompositeData& compositeData, const TimeSource source) noexcept
+{
+    switch (source)
+    {
+#if (TIME_GROUP_ENABLE & TIME_TIMESTARTUP_BIT)
+        case TimeSource::TimeStartup:
+            if (compositeData.time.timeStartup.has_value()) { return compositeData.time.timeStartup->nanoseconds(); }
+            break;
+#endif
+#if (TIME_GROUP_ENABLE & TIME_TIMEGPS_BIT)
+        case TimeSource::TimeGps:
+            if (compositeData.time.timeGps.has_value()) { return compositeData.time.timeGps->nanoseconds(); }
+            break;
+#endif
+#if (TIME_GROUP_ENABLE & TIME_TIMESYNCIN_BIT)
+        case TimeSource::TimeSyncIn:
+            if (compositeData.time.timeSyncIn.has_value()) { return compositeData.time.timeSyncIn->nanoseconds(); }
+            break;
+#endif
+        default:
+            break;
+    }
+    return std::nullopt;
+}
+
+namespace TimeAlignment
+{
+inline float lerp(const float a, const float b, const double fraction) noexcept { return a + (b - a) * static_cast<float>(fraction); }
+
+template <uint16_t n, typename T>
+Matrix<n, 1, T> lerp(const Matrix<n, 1, T>& a, const Matrix<n, 1, T>& b, const double fraction) noexcept
+{
+    return a + (b - a) * static_cast<T>(fraction);
+}
+
+inline Lla lerp(const Lla& a, const Lla& b, const double fraction) noexcept
+{
+    double dLon = b.lon - a.lon;  // Across the antimeridian, go the short way round
+    if (dLon > 180.0) { dLon -= 360.0; }
+    else if (dLon < -180.0) { dLon += 360.0; }
+    double lon = a.lon + dLon * fraction;
+    if (lon > 180.0) { lon -= 360.0; }
+    else if (lon < -180.0) { lon += 360.0; }
+    return Lla{a.lat + (b.lat - a.lat) * fraction, lon, a.alt + (b.alt - a.alt) * fraction};
+}
+
+inline Quat lerp(const Quat& a, const Quat& b, const double fraction) noexcept { return slerpQuat(a, b, static_cast<float>(fraction)); }
+
+inline Ypr lerp(const Ypr& a, const Ypr& b, const double fraction) noexcept
+{
+    return quat2ypr(slerpQuat(ypr2quat(a), ypr2quat(b), static_cast<float>(fraction)));
+}
+
+inline Mat3f lerp(const Mat3f& a, const Mat3f& b, const double fraction) noexcept
+{
+    return quat2dcm(slerpQuat(dcm2quat(a), dcm2quat(b), static_cast<float>(fraction)));
+}
+
+/// Overwrites out, which already holds the nearer sample's value, when both neighbours carry the field.
+template <typename T>
+void interpolateField(std::optional<T>& out, const std::optional<T>& a, const std::optional<T>& b, const double fraction) noexcept
+{
+    if (a.has_value() && b.has_value()) { out = lerp(*a, *b, fraction); }
+}
+
+/// Interpolates the continuous vector and attitude fields of out between a and b. Vectors are interpolated linearly and attitudes (quaternion,
+/// yaw-pitch-roll and DCM) spherically. Everything else, such as status words, counters and the integrated deltas, is left as out holds it.
+inline void interpolateFields([[maybe_unused]] CompositeData& out, [[maybe_unused]] const CompositeData& a, [[maybe_unused]] const CompositeData& b,
+                              [[maybe_unused]] const double fraction) noexcept
+{
+#if (IMU_GROUP_ENABLE & IMU_UNCOMPMAG_BIT)
+    interpolateField(out.imu.uncompMag, a.imu.uncompMag, b.imu.uncompMag, fraction);
+#endif
+#if (IMU_GROUP_ENABLE & IMU_UNCOMPACCEL_BIT)
+    interpolateField(out.imu.uncompAccel, a.imu.uncompAccel, b.imu.uncompAccel, fraction);
+#endif
+#if (IMU_GROUP_ENABLE & IMU_UNCOMPGYRO_BIT)
+    interpolateField(out.imu.uncompGyro, a.imu.uncompGyro, b.imu.uncompGyro, fraction);
+#endif
+#if (IMU_GROUP_ENABLE & IMU_TEMPERATURE_BIT)
+    interpolateField(out.imu.temperature, a.imu.temperature, b.imu.temperature, fraction);
+#endif
+#if (IMU_GROUP_ENABLE & IMU_PRESSURE_BIT)
+    interpolateField(out.imu.pressure, a.imu.pressure, b.imu.pressure, fraction);
+#endif
+#if (IMU_GROUP_ENABLE & IMU_MAG_BIT)
+    interpolateField(out.imu.mag, a.imu.mag, b.imu.mag, fraction);
+#endif
+#if (IMU_GROUP_ENABLE & IMU_ACCEL_BIT)
+    interpolateField(out.imu.accel, a.imu.accel, b.imu.accel, fraction);
+#endif
+#if (IMU_GROUP_ENABLE & IMU_ANGULARRATE_BIT)
+    interpolateField(out.imu.angularRate, a.imu.angularRate, b.imu.angularRate, fraction);
+#endif
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_YPR_BIT)
+    interpolateField(out.attitude.ypr, a.attitude.ypr, b.attitude.ypr, fraction);
+#endif
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_QUATERNION_BIT)
+    interpolateField(out.attitude.quaternion, a.attitude.quaternion, b.attitude.quaternion, fraction);
+#endif
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_DCM_BIT)
+    interpolateField(out.attitude.dcm, a.attitude.dcm, b.attitude.dcm, fraction);
+#endif
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_MAGNED_BIT)
+    interpolateField(out.attitude.magNed, a.attitude.magNed, b.attitude.magNed, fraction);
+#endif
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_ACCELNED_BIT)
+    interpolateField(out.attitude.accelNed, a.attitude.accelNed, b.attitude.accelNed, fraction);
+#endif
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_LINBODYACC_BIT)
+    interpolateField(out.attitude.linBodyAcc, a.attitude.linBodyAcc, b.attitude.linBodyAcc, fraction);
+#endif
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_LINACCELNED_BIT)
+    interpolateField(out.attitude.linAccelNed, a.attitude.linAccelNed, b.attitude.linAccelNed, fraction);
+#endif
+#if (INS_GROUP_ENABLE & INS_POSLLA_BIT)
+    interpolateField(out.ins.posLla, a.ins.posLla, b.ins.posLla, fraction);
+#endif
+#if (INS_GROUP_ENABLE & INS_POSECEF_BIT)
+    interpolateField(out.ins.posEcef, a.ins.posEcef, b.ins.posEcef, fraction);
+#endif
+#if (INS_GROUP_ENABLE & INS_VELBODY_BIT)
+    interpolateField(out.ins.velBody, a.ins.velBody, b.ins.velBody, fraction);
+#endif
+#if (INS_GROUP_ENABLE & INS_VELNED_BIT)
+    interpolateField(out.ins.velNed, a.ins.velNed, b.ins.velNed, fraction);
+#endif
+#if (INS_GROUP_ENABLE & INS_VELECEF_BIT)
+    interpolateField(out.ins.velEcef, a.ins.velEcef, b.ins.velEcef, fraction);
+#endif
+#if (INS_GROUP_ENABLE & INS_MAGECEF_BIT)
+    interpolateField(out.ins.magEcef, a.ins.magEcef, b.ins.magEcef, fraction);
+#endif
+#if (INS_GROUP_ENABLE & INS_ACCELECEF_BIT)
+    interpolateField(out.ins.accelEcef, a.ins.accelEcef, b.ins.accelEcef, fraction);
+#endif
+#if (INS_GROUP_ENABLE & INS_LINACCELECEF_BIT)
+    interpolateField(out.ins.linAccelEcef, a.ins.linAccelEcef, b.ins.linAccelEcef, fraction);
+#endif
+}
+
+inline void setTimestamp([[maybe_unused]] CompositeData& compositeData, const TimeSource source, [[maybe_unused]] const uint64_t time) noexcept
+{
+    switch (source)
+    {
+#if (TIME_GROUP_ENABLE & TIME_TIMESTARTUP_BIT)
+        case TimeSource::TimeStartup:
+            compositeData.time.timeStartup = Time{time};
+            break;
+#endif
+#if (TIME_GROUP_ENABLE & TIME_TIMEGPS_BIT)
+        case TimeSource::TimeGps:
+            compositeData.time.timeGps = Time{time};
+            break;
+#endif
+#if (TIME_GROUP_ENABLE & TIME_TIMESYNCIN_BIT)
+        case TimeSource::TimeSyncIn:
+            compositeData.time.timeSyncIn = Time{time};
+            break;
+#endif
+        default:
+            break;
+    }
+}
+}  // namespace TimeAlignment
+
+/**
+ * @brief A ring of the most recent measurements of one stream, ordered by time, with O(log n) lookup and interpolation to arbitrary times.
+ * Measurements are indexed by a time group output (see TimeSource) or by a caller-supplied time, such as a host clock or a time already mapped
+ * between sensors. Times must strictly increase; when the ring is full, the oldest measurement is replaced.
+ * @tparam Capacity Measurements held, a power of two.
+ */
+template <uint16_t Capacity = 256>
+class TimeAlignedBuffer
+{
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two of at least 2.");
+
+public:
+    explicit TimeAlignedBuffer(const TimeSource source = TimeSource::TimeStartup)
+        : _source(source), _times(new uint64_t[Capacity]), _measurements(new CompositeData[Capacity])
+    {
+    }
+
+    /// @brief Adds a measurement, indexed by its own time from the buffer's TimeSource.
+    /// @return Error (true) if the measurement lacks that time or is not newer than the newest one held.
+    Errored push(const CompositeData& compositeData) noexcept
+    {
+        const std::optional<uint64_t> time = getTimestamp(compositeData, _source);
+        if (!time.has_value()) { return true; }
+        return push(compositeData, *time);
+    }
+
+    /// @brief Adds a measurement indexed by the passed time in nanoseconds.
+    /// @return Error (true) if time is not newer than the newest measurement held.
+    Errored push(const CompositeData& compositeData, const uint64_t time) noexcept
+    {
+        if (_size > 0 && time <= newestTime()) { return true; }
+        const uint16_t slot = _slot(_size);
+        if (_size == Capacity) { _head = _slot(1); }
+        else { ++_size; }
+        _times[slot] = time;
+        _measurements[slot] = compositeData;
+        return false;
+    }
+
+    /// @brief Moves every measurement waiting in a queue into the buffer.
+    /// @return Error (true) if any of them could not be indexed; the rest are still added.
+    Errored pushFrom(DirectAccessQueue_Interface<CompositeData>& queue) noexcept
+    {
+        bool errored = false;
+        while (auto measurement = queue.get())
+        {
+            if (push(*measurement)) { errored = true; }
+        }
+        return errored;
+    }
+
+    TimeSource timeSource() const noexcept { return _source; }
+    uint16_t size() const noexcept { return _size; }
+    bool isEmpty() const noexcept { return _size == 0; }
+    static constexpr uint16_t capacity() noexcept { return Capacity; }
+
+    /// Time of the i-th oldest measurement held.
+    uint64_t timeAt(const uint16_t i) const noexcept { return _times[_slot(i)]; }
+    /// The i-th oldest measurement held.
+    const CompositeData& at(const uint16_t i) const noexcept { return _measurements[_slot(i)]; }
+
+    uint64_t oldestTime() const noexcept { return timeAt(0); }
+    uint64_t newestTime() const noexcept { return timeAt(_size - 1); }
+
+    /// @brief Index of the oldest measurement at or after time, or size() if there is none. O(log n).
+    uint16_t lowerBound(const uint64_t time) const noexcept
+    {
+        uint16_t first = 0;
+        uint16_t count = _size;
+        while (count > 0)
+        {
+            const uint16_t half = count / 2;
+            if (timeAt(first + half) < time)
+            {
+                first += half + 1;
+                count -= half + 1;
+            }
+            else { count = half; }
+        }
+        return first;
+    }
+
+    /// @brief The measurement nearest to time, or nullptr if the buffer is empty.
+    const CompositeData* nearest(const uint64_t time) const noexcept
+    {
+        if (_size == 0) { return nullptr; }
+        const uint16_t i = lowerBound(time);
+        if (i == _size) { return &at(_size - 1); }
+        if (i == 0 || timeAt(i) - time < time - timeAt(i - 1)) { return &at(i); }
+        return &at(i - 1);
+    }
+
+    /**
+     * @brief Interpolates the held measurements to time, which must lie between the oldest and newest held; there is no extrapolation.
+     * The result is the nearer neighbour with its vector and attitude fields interpolated (see TimeAlignment::interpolateFields) and its
+     * TimeSource field set to time.
+     * @return Error (true) if time is outside the span held.
+     */
+    Errored interpolate(const uint64_t time, CompositeData& out) const noexcept
+    {
+        if (_size == 0 || time < oldestTime() || time > newestTime()) { return true; }
+        const uint16_t i = lowerBound(time);
+        if (timeAt(i) == time)
+        {
+            out = at(i);
+            return false;
+        }
+        const uint64_t before = timeAt(i - 1);
+        const double fraction = static_cast<double>(time - before) / static_cast<double>(timeAt(i) - before);
+        out = (fraction < 0.5) ? at(i - 1) : at(i);
+        TimeAlignment::interpolateFields(out, at(i - 1), at(i), fraction);
+        TimeAlignment::setTimestamp(out, _source, time);
+        return false;
+    }
+
+    /// @brief Drops measurements no longer needed to interpolate at time or later, keeping the newest one at or before it.
+    void discardBefore(const uint64_t time) noexcept
+    {
+        const uint16_t i = lowerBound(time);
+        const uint16_t dropped = (i > 0 && (i == _size || timeAt(i) != time)) ? i - 1 : i;
+        _head = _slot(dropped);
+        _size -= dropped;
+    }
+
+    void reset() noexcept
+    {
+        _head = 0;
+        _size = 0;
+    }
+
+private:
+    static constexpr uint16_t MASK = Capacity - 1;
+
+    TimeSource _source;
+    std::unique_ptr<uint64_t[]> _times;  // Kept apart from the measurements so a lookup touches only a few cache lines
+    std::unique_ptr<CompositeData[]> _measurements;
+    uint16_t _head = 0;
+    uint16_t _size = 0;
+
+    uint16_t _slot(const uint16_t i) const noexcept { return static_cast<uint16_t>((_head + i) & MASK); }
+};
+
+/**
+ * @brief Joins several measurement streams, such as binary outputs at different rates or several sensors, on a common time axis.
+ * All streams must be indexed by the same clock: either a TimeSource they share (e.g. TimeGps) or times the caller maps onto one clock before
+ * pushing. Works the same in real time, fed as measurements arrive, and offline, fed from a replayed file and flushed at the end.
+ * @tparam Streams Number of streams joined.
+ * @tparam Capacity Measurements held per stream, a power of two. It must cover the largest lag between the streams.
+ */
+template <size_t Streams, uint16_t Capacity = 256>
+class TimeAlignedJoin
+{
+    static_assert(Streams > 0, "A join needs at least one stream.");
+
+public:
+    using Buffer = TimeAlignedBuffer<Capacity>;
+
+    explicit TimeAlignedJoin(const TimeSource source = TimeSource::TimeStartup) : _streams(_makeStreams(source, std::make_index_sequence<Streams>{})) {}
+
+    Buffer& stream(const size_t i) noexcept { return _streams[i]; }
+    const Buffer& stream(const size_t i) const noexcept { return _streams[i]; }
+
+    Errored push(const size_t stream, const CompositeData& compositeData) noexcept { return _streams[stream].push(compositeData); }
+    Errored push(const size_t stream, const CompositeData& compositeData, const uint64_t time) noexcept
+    {
+        return _streams[stream].push(compositeData, time);
+    }
+
+    /// @brief The latest time every stream has reached. No measurement at or before it can still arrive, so joins and merges up to it are final.
+    std::optional<uint64_t> watermark() const noexcept
+    {
+        uint64_t minimum = std::numeric_limits<uint64_t>::max();
+        for (const auto& buffer : _streams)
+        {
+            if (buffer.isEmpty()) { return std::nullopt; }
+            minimum = std::min(minimum, buffer.newestTime());
+        }
+        return minimum;
+    }
+
+    /// @brief Interpolates every stream to time.
+    /// @return Error (true) if time is outside the span held by any stream; out is then partially written.
+    Errored sampleAt(const uint64_t time, std::array<CompositeData, Streams>& out) const noexcept
+    {
+        for (size_t i = 0; i < Streams; ++i)
+        {
+            if (_streams[i].interpolate(time, out[i])) { return true; }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Emits the measurements of all streams not yet emitted in time order, as onMeasurement(stream, time, measurement). Equal times are
+     * emitted in stream order.
+     * @param flush If false, only measurements up to the watermark are emitted, so the order is final even while streams are still being fed. If
+     * true, everything held is emitted, as at the end of a replayed file.
+     * @return The number of measurements emitted.
+     */
+    template <typename Callback>
+    size_t merge(Callback&& onMeasurement, const bool flush = false) noexcept
+    {
+        uint64_t limit = std::numeric_limits<uint64_t>::max();
+        if (!flush)
+        {
+            const std::optional<uint64_t> mark = watermark();
+            if (!mark.has_value()) { return 0; }
+            limit = *mark;
+        }
+
+        std::array<uint16_t, Streams> next;
+        for (size_t i = 0; i < Streams; ++i)
+        {
+            next[i] = _emitted[i].has_value() ? _streams[i].lowerBound(*_emitted[i] + 1) : 0;
+        }
+
+        size_t emitted = 0;
+        while (true)
+        {
+            size_t earliest = Streams;
+            uint64_t earliestTime = limit;
+            for (size_t i = 0; i < Streams; ++i)
+            {
+                if (next[i] == _streams[i].size()) { continue; }
+                const uint64_t time = _streams[i].timeAt(next[i]);
+                if (time <= limit && (earliest == Streams || time < earliestTime))
+                {
+                    earliest = i;
+                    earliestTime = time;
+                }
+            }
+            if (earliest == Streams) { break; }
+            onMeasurement(earliest, earliestTime, _streams[earliest].at(next[earliest]));
+            _emitted[earliest] = earliestTime;
+            ++next[earliest];
+            ++emitted;
+        }
+        return emitted;
+    }
+
+    void reset() noexcept
+    {
+        for (auto& buffer : _streams) { buffer.reset(); }
+        _emitted.fill(std::nullopt);
+    }
+
+private:
+    std::array<Buffer, Streams> _streams;
+    std::array<std::optional<uint64_t>, Streams> _emitted{};  // Time of the last measurement merged from each stream
+
+    template <size_t... I>
+    static std::array<Buffer, Streams> _makeStreams(const TimeSource source, std::index_sequence<I...>)
+    {
+        return {{((void)I, Buffer{source})...}};
+    }
+};
+
+}  // namespace Math
+}  // namespace VN
+
+#endif  // VN_TIMEALIGNMENT_HPP_
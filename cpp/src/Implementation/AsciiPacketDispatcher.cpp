@@ -41,15 +41,15 @@ Error AsciiPacketDispatcher::dispatchPacket(const ByteBuffer& byteBuffer, const
     Error error{Error::None};
     if (StringUtils::startsWith(_latestPacketMetadata.header, "VN"))
     {
-        AsciiPacketProtocol::AsciiMeasurementHeader asciiHeader = AsciiPacketProtocol::getMeasHeader(_latestPacketMetadata.header);
-        if (asciiHeader != AsciiPacketProtocol::AsciiMeasurementHeader::None)
+        const AsciiPacketProtocol::AsciiMeasurementDescriptor* measurement = _latestPacketMetadata.measurement;
+        if (measurement != nullptr)
         {
             error = _invokeSubscribers(byteBuffer, syncByteIndex, _latestPacketMetadata);
             if constexpr (Config::PacketDispatchers::compositeDataQueueCapacity > 0)
             {
-                if (_parseToCD && AsciiPacketProtocol::asciiIsParsable(asciiHeader))
+                if (_parseToCD && measurement->numFields != 0)
                 {
-                    Error latestError = _tryPushToCompositeDataQueue(byteBuffer, syncByteIndex, _latestPacketMetadata, asciiHeader);
+                    Error latestError = _tryPushToCompositeDataQueue(byteBuffer, syncByteIndex, _latestPacketMetadata);
                     if (latestError != Error::None) { error = latestError; }
                 }
             }
@@ -75,14 +75,19 @@ Error AsciiPacketDispatcher::addSubscriber(PacketQueue_Interface* subscriber, co
     if (subscriber == nullptr) { return Error::PacketQueueNull; }
     if (headerToUse.empty()) { filterType = SubscriberFilterType::StartsWith; }
     if (_subscribers.push_back(Subscriber{subscriber, headerToUse, filterType})) { return Error::MessageSubscriberCapacityReached; }
-    else { return Error::None; }
+    _reserveSharedBuffers(subscriber->capacity());
+    return Error::None;
 }
 
 void AsciiPacketDispatcher::removeSubscriber(PacketQueue_Interface* subscriberToRemove) noexcept
 {
     for (auto itr = _subscribers.begin(); itr != _subscribers.end();)
     {
-        if (subscriberToRemove == itr->queueToPush) { itr = _subscribers.erase(itr); }
+        if (subscriberToRemove == itr->queueToPush)
+        {
+            _unreserveSharedBuffers(itr->queueToPush->capacity());
+            itr = _subscribers.erase(itr);
+        }
         else { ++itr; }
     }
 }
@@ -91,17 +96,20 @@ void AsciiPacketDispatcher::removeSubscriber(PacketQueue_Interface* subscriberTo
 {
     for (auto itr = _subscribers.begin(); itr != _subscribers.end();)
     {
-        if (subscriberToRemove == itr->queueToPush && headerToUse == itr->headerFilter) { itr = _subscribers.erase(itr); }
+        if (subscriberToRemove == itr->queueToPush && headerToUse == itr->headerFilter)
+        {
+            _unreserveSharedBuffers(itr->queueToPush->capacity());
+            itr = _subscribers.erase(itr);
+        }
         else { ++itr; }
     }
 }
 
 Error AsciiPacketDispatcher::_tryPushToCompositeDataQueue(const ByteBuffer& byteBuffer, const size_t syncByteIndex,
-                                                          const AsciiPacketProtocol::Metadata& metadata,
-                                                          AsciiPacketProtocol::AsciiMeasurementHeader measEnum) noexcept
+                                                          const AsciiPacketProtocol::Metadata& metadata) noexcept
 {
     // if (!AsciiPacketProtocol::anyDataIsEnabled(metadata.header, _enabledMeasurements)) { return false; }
-    auto compositeData = AsciiPacketProtocol::parsePacket(byteBuffer, syncByteIndex, metadata, measEnum);
+    auto compositeData = AsciiPacketProtocol::parsePacket(byteBuffer, syncByteIndex, metadata);
     if (!compositeData.has_value()) { return Error::ParsingFailed; }
 
     // Copy to the output queue
@@ -116,13 +124,14 @@ Error AsciiPacketDispatcher::_invokeSubscribers(const ByteBuffer& byteBuffer, co
                                                 const AsciiPacketProtocol::Metadata& metadata) noexcept
 {
     Error error{Error::None};
+    SharedPacketPool::Ref shared;
     for (auto& subscriber : _subscribers)
     {
         if (StringUtils::startsWith(metadata.header, subscriber.headerFilter))
         {
             if (subscriber.filterType == SubscriberFilterType::StartsWith)
             {
-                const Error latestError = _tryPushToSubscriber(byteBuffer, syncByteIndex, metadata, subscriber);
+                const Error latestError = _tryPushToSubscriber(byteBuffer, syncByteIndex, metadata, subscriber, shared);
                 if (latestError != Error::None) { error = latestError; }
             }
         }
@@ -130,7 +139,7 @@ Error AsciiPacketDispatcher::_invokeSubscribers(const ByteBuffer& byteBuffer, co
         {
             if (subscriber.filterType == SubscriberFilterType::DoesNotStartWith)
             {
-                const Error latestError = _tryPushToSubscriber(byteBuffer, syncByteIndex, metadata, subscriber);
+                const Error latestError = _tryPushToSubscriber(byteBuffer, syncByteIndex, metadata, subscriber, shared);
                 if (latestError != Error::None) { error = latestError; }
             }
         }
@@ -140,20 +149,19 @@ Error AsciiPacketDispatcher::_invokeSubscribers(const ByteBuffer& byteBuffer, co
 }
 
 Error AsciiPacketDispatcher::_tryPushToSubscriber(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const AsciiPacketProtocol::Metadata& metadata,
-                                                  Subscriber& subscriber) noexcept
+                                                  Subscriber& subscriber, SharedPacketPool::Ref& shared) noexcept
 {
     auto putSlot = subscriber.queueToPush->put();
     if (putSlot)
     {
-        if (putSlot->capacity >= metadata.length)
+        if (!putSlot->fill(byteBuffer, syncByteIndex, metadata.length, _sharedPacketPool, shared))
         {
             putSlot->details.syncByte = PacketDetails::SyncByte::Ascii;
             putSlot->details.asciiMetadata = metadata;
-            byteBuffer.peek_unchecked(putSlot->buffer, metadata.length, syncByteIndex);
         }
         else
         {
-            putSlot->details = PacketDetails();
+            subscriber.queueToPush->cancelPut(putSlot);
             return Error::PacketQueueOverrun;
         }
     }
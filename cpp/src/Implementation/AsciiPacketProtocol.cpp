@@ -23,7 +23,9 @@
 
 #include "vectornav/Implementation/AsciiPacketProtocol.hpp"
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
 
 #include "vectornav/Config.hpp"
 #include "vectornav/Debug.hpp"
@@ -36,124 +38,312 @@ namespace VN
 {
 namespace AsciiPacketProtocol
 {
-// namespace {
-struct AsciiMeasurementIndices
+namespace
 {
-    AsciiMeasurementIndices() {};
-    AsciiMeasurementIndices(uint8_t MeasGroupIndex, uint8_t MeasTypeIndex) : measGroupIndex(MeasGroupIndex), measTypeIndex(MeasTypeIndex) {};
-    uint8_t measGroupIndex;
-    uint8_t measTypeIndex;
-};
-
-std::optional<Vector<AsciiMeasurementIndices, 9>> _getAsciiMeasurementIndices(const AsciiMeasurementHeader asciiHeader);
-bool _parseAsciiMessage(const AsciiMeasurementHeader asciiHeader, const ByteBuffer& buffer, const size_t syncByteIdx, const Metadata& metadata,
-                        CompositeData& compositeData);
-
-using HeaderChars = std::array<char, 5>;
+using F = AsciiMeasurementField;
+
+// Ordered as AsciiMeasurementHeader, so the enum value minus one indexes into this table.
+constexpr std::array<AsciiMeasurementDescriptor, 22> measurementDescriptors = {{
+    {{'I', 'N', 'S'},
+     AsciiMeasurementHeader::INS,
+     15,
+     9,
+     {{
+         F{1, 2},   // GpsTow
+         F{1, 3},   // GpsWeek
+         F{5, 0},   // InsStatus
+         F{4, 1},   // Ypr
+         F{5, 1},   // PosLla
+         F{5, 4},   // VelNed
+         F{4, 13},  // AttU
+         F{5, 9},   // PosU
+         F{5, 10},  // VelU
+     }}},
+    {{'Y', 'P', 'R'},
+     AsciiMeasurementHeader::YPR,
+     3,
+     1,
+     {{
+         F{4, 1},  // Ypr
+     }}},
+    {{'Q', 'T', 'N'},
+     AsciiMeasurementHeader::QTN,
+     4,
+     1,
+     {{
+         F{4, 2},  // Quaternion
+     }}},
+    {{'Q', 'M', 'R'},
+     AsciiMeasurementHeader::QMR,
+     13,
+     4,
+     {{
+         F{4, 2},   // Quaternion
+         F{2, 8},   // Mag
+         F{2, 9},   // Accel
+         F{2, 10},  // AngularRate
+     }}},
+    {{'M', 'A', 'G'},
+     AsciiMeasurementHeader::MAG,
+     3,
+     1,
+     {{
+         F{2, 8},  // Mag
+     }}},
+    {{'A', 'C', 'C'},
+     AsciiMeasurementHeader::ACC,
+     3,
+     1,
+     {{
+         F{2, 9},  // Accel
+     }}},
+    {{'G', 'Y', 'R'},
+     AsciiMeasurementHeader::GYR,
+     3,
+     1,
+     {{
+         F{2, 10},  // AngularRate
+     }}},
+    {{'M', 'A', 'R'},
+     AsciiMeasurementHeader::MAR,
+     9,
+     3,
+     {{
+         F{2, 8},   // Mag
+         F{2, 9},   // Accel
+         F{2, 10},  // AngularRate
+     }}},
+    {{'Y', 'M', 'R'},
+     AsciiMeasurementHeader::YMR,
+     12,
+     4,
+     {{
+         F{4, 1},   // Ypr
+         F{2, 8},   // Mag
+         F{2, 9},   // Accel
+         F{2, 10},  // AngularRate
+     }}},
+    {{'Y', 'B', 'A'},
+     AsciiMeasurementHeader::YBA,
+     9,
+     3,
+     {{
+         F{4, 1},   // Ypr
+         F{4, 6},   // LinBodyAcc
+         F{2, 10},  // AngularRate
+     }}},
+    {{'Y', 'I', 'A'},
+     AsciiMeasurementHeader::YIA,
+     9,
+     3,
+     {{
+         F{4, 1},   // Ypr
+         F{4, 7},   // LinAccelNed
+         F{2, 10},  // AngularRate
+     }}},
+    {{'I', 'M', 'U'},
+     AsciiMeasurementHeader::IMU,
+     11,
+     5,
+     {{
+         F{2, 1},  // UncompMag
+         F{2, 2},  // UncompAccel
+         F{2, 3},  // UncompGyro
+         F{2, 4},  // Temperature
+         F{2, 5},  // Pressure
+     }}},
+    {{'G', 'P', 'S'},
+     AsciiMeasurementHeader::GPS,
+     15,
+     9,
+     {{
+         F{3, 1},   // GpsTow
+         F{3, 2},   // GpsWeek
+         F{3, 4},   // GnssFix
+         F{3, 3},   // NumSats
+         F{3, 5},   // GnssPosLla
+         F{3, 7},   // GnssVelNed
+         F{3, 9},   // GnssPosUncertainty
+         F{3, 10},  // GnssVelUncertainty
+         F{3, 11},  // GnssTimeUncertainty
+     }}},
+    {{'G', 'P', 'E'},
+     AsciiMeasurementHeader::GPE,
+     15,
+     9,
+     {{
+         F{3, 1},   // GpsTow
+         F{3, 2},   // GpsWeek
+         F{3, 4},   // GnssFix
+         F{3, 3},   // NumSats
+         F{3, 6},   // GnssPosEcef
+         F{3, 8},   // GnssVelEcef
+         F{3, 9},   // GnssPosUncertaintyEcef
+         F{3, 10},  // GnssVelUncertainty
+         F{3, 11},  // GnssTimeUncertainty
+     }}},
+    {{'I', 'N', 'E'},
+     AsciiMeasurementHeader::INE,
+     15,
+     9,
+     {{
+         F{1, 2},   // GpsTow
+         F{1, 3},   // GpsWeek
+         F{5, 0},   // InsStatus
+         F{4, 1},   // Ypr
+         F{5, 2},   // PosEcef
+         F{5, 5},   // VelEcef
+         F{4, 13},  // AttU
+         F{5, 9},   // PosU
+         F{5, 10},  // VelU
+     }}},
+    {{'I', 'S', 'L'},
+     AsciiMeasurementHeader::ISL,
+     15,
+     5,
+     {{
+         F{4, 1},   // Ypr
+         F{5, 1},   // PosLla
+         F{5, 4},   // VelNed
+         F{2, 9},   // Accel
+         F{2, 10},  // AngularRate
+     }}},
+    {{'I', 'S', 'E'},
+     AsciiMeasurementHeader::ISE,
+     15,
+     5,
+     {{
+         F{4, 1},   // Ypr
+         F{5, 2},   // PosEcef
+         F{5, 5},   // VelEcef
+         F{2, 9},   // Accel
+         F{2, 10},  // AngularRate
+     }}},
+    {{'D', 'T', 'V'},
+     AsciiMeasurementHeader::DTV,
+     7,
+     2,
+     {{
+         F{2, 6},  // DeltaTheta
+         F{2, 7},  // DeltaVel
+     }}},
+    {{'G', '2', 'S'},
+     AsciiMeasurementHeader::G2S,
+     15,
+     9,
+     {{
+         F{6, 1},   // GpsTow
+         F{6, 2},   // GpsWeek
+         F{6, 4},   // GnssFix
+         F{6, 3},   // NumSats
+         F{6, 5},   // GnssPosLla
+         F{6, 7},   // GnssVelNed
+         F{6, 9},   // GnssPosUncertainty
+         F{6, 10},  // GnssVelUncertainty
+         F{6, 11},  // GnssTimeUncertainty
+     }}},
+    {{'G', '2', 'E'},
+     AsciiMeasurementHeader::G2E,
+     15,
+     9,
+     {{
+         F{6, 1},   // GpsTow
+         F{6, 2},   // GpsWeek
+         F{6, 4},   // GnssFix
+         F{6, 3},   // NumSats
+         F{6, 6},   // GnssPosEcef
+         F{6, 8},   // GnssVelEcef
+         F{6, 9},   // GnssPosUncertaintyEcef
+         F{6, 10},  // GnssVelUncertainty
+         F{6, 11},  // GnssTimeUncertainty
+     }}},
+    {{'H', 'V', 'E'},
+     AsciiMeasurementHeader::HVE,
+     3,
+     1,
+     {{
+         F{4, 12},  // Heave
+     }}},
+    {{'R', 'T', 'K'},  // Deprecated or unused measurements
+     AsciiMeasurementHeader::RTK,
+     0,
+     0,
+     {}},
+}};
+
+// Multiplicative hash of the three header characters after "VN". The multiplier was searched for so that every entry of
+// measurementDescriptors lands in its own slot; the static_assert below rejects the table if that ever stops being true.
+constexpr uint32_t measurementHashMultiplier = 0x2CBFF;
+constexpr uint8_t measurementHashBits = 5;
+
+constexpr size_t measurementHash(const char c0, const char c1, const char c2) noexcept
+{
+    const uint32_t key = static_cast<uint32_t>(static_cast<uint8_t>(c0)) | (static_cast<uint32_t>(static_cast<uint8_t>(c1)) << 8) |
+                         (static_cast<uint32_t>(static_cast<uint8_t>(c2)) << 16);
+    return static_cast<uint32_t>(key * measurementHashMultiplier) >> (32 - measurementHashBits);
+}
 
-constexpr std::array<std::tuple<HeaderChars, AsciiMeasurementHeader>, 22> headerMapping = {
+constexpr std::array<int8_t, (1 << measurementHashBits)> buildMeasurementSlots() noexcept
+{
+    std::array<int8_t, (1 << measurementHashBits)> slots{};
+    for (auto& slot : slots) { slot = -1; }
+    for (size_t i = 0; i < measurementDescriptors.size(); ++i)
+    {
+        const auto& name = measurementDescriptors[i].name;
+        slots[measurementHash(name[0], name[1], name[2])] = static_cast<int8_t>(i);
+    }
+    return slots;
+}
 
-    std::make_tuple(HeaderChars{"YPR"}, AsciiMeasurementHeader::YPR), std::make_tuple(HeaderChars{"QTN"}, AsciiMeasurementHeader::QTN),
-    std::make_tuple(HeaderChars{"QMR"}, AsciiMeasurementHeader::QMR), std::make_tuple(HeaderChars{"MAG"}, AsciiMeasurementHeader::MAG),
-    std::make_tuple(HeaderChars{"ACC"}, AsciiMeasurementHeader::ACC), std::make_tuple(HeaderChars{"GYR"}, AsciiMeasurementHeader::GYR),
-    std::make_tuple(HeaderChars{"MAR"}, AsciiMeasurementHeader::MAR), std::make_tuple(HeaderChars{"YMR"}, AsciiMeasurementHeader::YMR),
-    std::make_tuple(HeaderChars{"YBA"}, AsciiMeasurementHeader::YBA), std::make_tuple(HeaderChars{"YIA"}, AsciiMeasurementHeader::YIA),
-    std::make_tuple(HeaderChars{"IMU"}, AsciiMeasurementHeader::IMU), std::make_tuple(HeaderChars{"GPS"}, AsciiMeasurementHeader::GPS),
-    std::make_tuple(HeaderChars{"GPE"}, AsciiMeasurementHeader::GPE), std::make_tuple(HeaderChars{"INS"}, AsciiMeasurementHeader::INS),
-    std::make_tuple(HeaderChars{"INE"}, AsciiMeasurementHeader::INE), std::make_tuple(HeaderChars{"ISL"}, AsciiMeasurementHeader::ISL),
-    std::make_tuple(HeaderChars{"ISE"}, AsciiMeasurementHeader::ISE), std::make_tuple(HeaderChars{"DTV"}, AsciiMeasurementHeader::DTV),
-    std::make_tuple(HeaderChars{"G2S"}, AsciiMeasurementHeader::G2S), std::make_tuple(HeaderChars{"G2E"}, AsciiMeasurementHeader::G2E),
-    std::make_tuple(HeaderChars{"HVE"}, AsciiMeasurementHeader::HVE), std::make_tuple(HeaderChars{"RTK"}, AsciiMeasurementHeader::RTK)};
+constexpr std::array<int8_t, (1 << measurementHashBits)> measurementSlots = buildMeasurementSlots();
 
-uint8_t _getNumAsciiParameters(const AsciiMeasurementHeader header)
+constexpr bool measurementTablesAreConsistent() noexcept
 {
-    switch (header)
+    size_t occupied = 0;
+    for (const auto slot : measurementSlots) { occupied += (slot >= 0); }
+    if (occupied != measurementDescriptors.size()) { return false; }
+    for (size_t i = 0; i < measurementDescriptors.size(); ++i)
     {
-        case AsciiMeasurementHeader::QTN:
-        {
-            return 4;
-        }
-        case AsciiMeasurementHeader::QMR:
-        {
-            return 13;
-        }
-        case AsciiMeasurementHeader::YPR:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::MAG:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::ACC:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::HVE:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::GYR:
-        {
-            return 3;
-        }
-        case AsciiMeasurementHeader::YMR:
-        {
-            return 12;
-        }
-        case AsciiMeasurementHeader::MAR:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::YBA:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::YIA:
-        {
-            return 9;
-        }
-        case AsciiMeasurementHeader::IMU:
-        {
-            return 11;
-        }
-        case AsciiMeasurementHeader::GPS:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::GPE:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::G2S:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::G2E:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::INS:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::INE:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::ISL:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::ISE:
-        {
-            return 15;
-        }
-        case AsciiMeasurementHeader::DTV:
-        {
-            return 7;
-        }
-        case AsciiMeasurementHeader::RTK:
-            [[fallthrough]];
-        case AsciiMeasurementHeader::None:
-        {
-            return 0;
-        }
-        default:
-            return 0;
+        if (static_cast<size_t>(measurementDescriptors[i].header) != i + 1) { return false; }
+        if (measurementDescriptors[i].numFields > measurementDescriptors[i].fields.size()) { return false; }
     }
+    return true;
+}
+static_assert(measurementTablesAreConsistent(), "ASCII measurement headers collide in the hash or are out of enum order.");
+
+}  // namespace
+
+const AsciiMeasurementDescriptor* findMeasurementDescriptor(const AsciiHeader& header) noexcept
+{
+    if (header.length() != 5 || header[0] != 'V' || header[1] != 'N') { return nullptr; }
+    const int8_t slot = measurementSlots[measurementHash(header[2], header[3], header[4])];
+    if (slot < 0) { return nullptr; }
+    const AsciiMeasurementDescriptor& descriptor = measurementDescriptors[static_cast<size_t>(slot)];
+    if (std::memcmp(header.data() + 2, descriptor.name.data(), descriptor.name.size()) != 0) { return nullptr; }
+    return &descriptor;
+}
+
+const AsciiMeasurementDescriptor* findMeasurementDescriptor(const AsciiMeasurementHeader header) noexcept
+{
+    const size_t index = static_cast<size_t>(header);
+    if (index == 0 || index > measurementDescriptors.size()) { return nullptr; }
+    return &measurementDescriptors[index - 1];
 }
 
 AsciiMeasurementHeader getMeasHeader(AsciiHeader headerChars)
 {
-    for (const auto& mapEntry : headerMapping)
-    {
-        if (std::memcmp(headerChars.data() + 2, std::get<0>(mapEntry).data(), sizeof(char) * 3) == 0) { return std::get<1>(mapEntry); }
-    }
-    return AsciiMeasurementHeader::None;
+    const AsciiMeasurementDescriptor* descriptor = findMeasurementDescriptor(headerChars);
+    return (descriptor == nullptr) ? AsciiMeasurementHeader::None : descriptor->header;
 }
 
 std::optional<EnabledMeasurements> asciiHeaderToMeasHeader(const AsciiMeasurementHeader header) noexcept
 {
     EnabledMeasurements presentMeasurements = {};
     if (!asciiIsParsable(header)) { return std::nullopt; }
-    auto asciiMeasurementIndices = (*_getAsciiMeasurementIndices(header));
-    for (const auto& currentMeasField : asciiMeasurementIndices)
+    const AsciiMeasurementDescriptor* descriptor = findMeasurementDescriptor(header);
+    for (uint8_t i = 0; i < descriptor->numFields; ++i)
     {
+        const AsciiMeasurementField& currentMeasField = descriptor->fields[i];
         uint8_t ind = static_cast<uint8_t>(currentMeasField.measGroupIndex - 1);  // Subtracting 1 because of Common group offset
         if (ind >= presentMeasurements.size()) { return std::nullopt; }
         presentMeasurements[ind] |= 1 << currentMeasField.measTypeIndex;
@@ -168,11 +358,12 @@ bool allDataIsEnabled(const AsciiMeasurementHeader header, const EnabledMeasurem
     else { return VN::allDataIsEnabled(measHeader.value(), measurementsToCheck); }
 }
 
-bool asciiIsMeasurement(const AsciiMeasurementHeader header) noexcept { return _getAsciiMeasurementIndices(header).has_value(); }
+bool asciiIsMeasurement(const AsciiMeasurementHeader header) noexcept { return findMeasurementDescriptor(header) != nullptr; }
 
 bool asciiIsParsable(const AsciiPacketProtocol::AsciiMeasurementHeader header) noexcept
 {
-    return (_getAsciiMeasurementIndices(header).has_value() && !_getAsciiMeasurementIndices(header).value().empty());
+    const AsciiMeasurementDescriptor* descriptor = findMeasurementDescriptor(header);
+    return (descriptor != nullptr && descriptor->numFields != 0);
 }
 
 bool anyDataIsEnabled(const AsciiMeasurementHeader header, const EnabledMeasurements& measurementsToCheck) noexcept
@@ -189,76 +380,206 @@ FindPacketReturn findPacket(const ByteBuffer& byteBuffer) noexcept
     return findPacket(byteBuffer, syncByteIndex.value());
 }
 
-FindPacketReturn findPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept
+namespace
 {
-    VN_PROFILER_TIME_CURRENT_SCOPE();
-    Metadata details;
-    details.timestamp = now();
+// SWAR helpers: test eight bytes of a field at once, so runs of plain field characters are only XORed into the checksum.
+constexpr uint64_t swarOnes = 0x0101010101010101ULL;
+constexpr uint64_t swarHighBits = 0x8080808080808080ULL;
+
+constexpr uint64_t swarHasZeroByte(const uint64_t word) noexcept { return (word - swarOnes) & ~word & swarHighBits; }
+
+constexpr bool swarHasSpecialByte(const uint64_t word) noexcept
+{
+    const uint64_t below = (word - swarOnes * ' ') & ~word & swarHighBits;  // Any byte < ' '
+    const uint64_t above = ((word + swarOnes * (0x80 - 0x7F)) | word) & swarHighBits;  // Any byte > '~'
+    return (below | above | swarHasZeroByte(word ^ (swarOnes * ',')) | swarHasZeroByte(word ^ (swarOnes * '*')) |
+            swarHasZeroByte(word ^ (swarOnes * '$'))) != 0;
+}
 
-    auto tmpByte = byteBuffer.peek_unchecked(syncByteIndex);
-    if (tmpByte != static_cast<uint8_t>('$')) { return {PacketDispatcher::FindPacketRetVal::Validity::Invalid, Metadata{}}; }  // It was a mistake to come here.
+/// @brief Walks an ASCII packet once, over however many contiguous segments of the ByteBuffer it spans, collecting the header, the ','
+/// and '*' delimiter positions, the 8-bit XOR checksum and the line end.
+class AsciiLineScanner
+{
+public:
+    enum class State
+    {
+        Header,
+        Fields,
+        Trailer,
+        Complete,
+        Invalid
+    };
 
-    // Search for the end of the packet (\n)
-    const auto newlineCharacterIndex = byteBuffer.find('\n', syncByteIndex);
-    if (!newlineCharacterIndex.has_value())
+    explicit AsciiLineScanner(Metadata& details) : _details(details) {}
+
+    /// Consumes a contiguous segment whose first byte is at packet offset `offset`. Returns true once the scan no longer needs bytes.
+    bool scan(const uint8_t* data, const size_t size, const size_t offset) noexcept
     {
-        if (byteBuffer.size() - syncByteIndex > Config::PacketFinders::asciiPacketMaxLength)
+        size_t i = 0;
+        while (i < size)
         {
-            return {PacketDispatcher::FindPacketRetVal::Validity::Invalid, Metadata{}};
+            if (_state == State::Fields)
+            {
+                for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+                {
+                    uint64_t word;
+                    std::memcpy(&word, data + i, sizeof(word));
+                    if (swarHasSpecialByte(word)) { break; }
+                    _checksumWords ^= word;
+                }
+                if (i == size) { break; }
+            }
+            for (; i < size; ++i)
+            {
+                const uint8_t byte = data[i];
+                if (_consume(byte, offset + i)) { return true; }
+                if (byte == ',')
+                {  // Back to word-at-a-time scanning for the next field
+                    ++i;
+                    break;
+                }
+            }
         }
-        else { return {PacketDispatcher::FindPacketRetVal::Validity::Incomplete, Metadata{}}; }
+        return false;
     }
 
-    const bool isMissingCarriageReturn = byteBuffer.peek_unchecked(newlineCharacterIndex.value() - 1) != '\r';
+    State state() const noexcept { return _state; }
+    uint16_t newlineIndex() const noexcept { return _newlineIndex; }
 
-    details.length = newlineCharacterIndex.value() - syncByteIndex + 1;
+    uint8_t checksum() const noexcept
+    {
+        uint64_t folded = _checksumWords;
+        folded ^= folded >> 32;
+        folded ^= folded >> 16;
+        folded ^= folded >> 8;
+        return static_cast<uint8_t>(folded) ^ _checksum;
+    }
 
-    if (details.length > Config::PacketFinders::asciiPacketMaxLength) { return {PacketDispatcher::FindPacketRetVal::Validity::Invalid, Metadata{}}; }
+private:
+    Metadata& _details;
+    State _state = State::Header;
+    uint64_t _checksumWords = 0;
+    uint8_t _checksum = 0;
+    uint16_t _newlineIndex = 0;
 
-    bool processingHeader = true;
-    uint8_t checksum8 = 0;
-    uint16_t crc16 = 0;
-    for (uint16_t fromSyncByteIndex = 1; fromSyncByteIndex < details.length; ++fromSyncByteIndex)
-    {                                                              // Beginning one after the sync byte, but mark it as checked
-        size_t fromTailIndex = syncByteIndex + fromSyncByteIndex;  // Should be zero-based, but is relative to current absolute tail.
-        tmpByte = byteBuffer.peek_unchecked(fromTailIndex);
-        if (tmpByte == ',')
+    bool _consume(const uint8_t byte, const size_t fromSyncByteIndex) noexcept
+    {
+        if (_state == State::Trailer)
         {
-            details.delimiterIndices.push_back(fromSyncByteIndex);
-            processingHeader = false;
+            if (byte == '\n')
+            {
+                _newlineIndex = static_cast<uint16_t>(fromSyncByteIndex);
+                _state = State::Complete;
+                return true;
+            }
+            return false;
         }
-        else if (tmpByte == '*')
+        if (byte == ',')
         {
-            details.delimiterIndices.push_back(fromSyncByteIndex);
-            processingHeader = false;
-            break;
+            _details.delimiterIndices.push_back(static_cast<uint16_t>(fromSyncByteIndex));
+            _state = State::Fields;
+        }
+        else if (byte == '*')
+        {
+            _details.delimiterIndices.push_back(static_cast<uint16_t>(fromSyncByteIndex));
+            _state = State::Trailer;
+            return false;
         }
-        else if (((tmpByte < ' ') || (tmpByte > '~') || (tmpByte == '$')) && (tmpByte != '\r'))
+        else if (((byte < ' ') || (byte > '~') || (byte == '$')) && (byte != '\r'))
         {
             // Contains a non-ascii character
-            return {PacketDispatcher::FindPacketRetVal::Validity::Invalid, Metadata{}};
+            _state = State::Invalid;
+            return true;
         }
-        if (processingHeader)
+        else if (_state == State::Header)
         {
-            if (fromSyncByteIndex > Config::PacketFinders::asciiHeaderMaxLength) { return {PacketDispatcher::FindPacketRetVal::Validity::Invalid, Metadata{}}; }
-            details.header.push_back(tmpByte);
+            if (fromSyncByteIndex > Config::PacketFinders::asciiHeaderMaxLength)
+            {
+                _state = State::Invalid;
+                return true;
+            }
+            _details.header.push_back(static_cast<char>(byte));
+        }
+        _checksum ^= byte;
+        return false;
+    }
+};
+
+uint16_t calculateAsciiCrc(const ByteBuffer& byteBuffer, size_t index, size_t numBytes) noexcept
+{
+    uint16_t crc16 = 0;
+    while (numBytes > 0)
+    {
+        const uint8_t* segment = byteBuffer.peek_ptr_unchecked(index);
+        const size_t segmentSize = std::min(numBytes, byteBuffer.numLinearBytesToPeek(index));
+        for (size_t i = 0; i < segmentSize; ++i) { _calculateCRC(&crc16, segment[i]); }
+        index += segmentSize;
+        numBytes -= segmentSize;
+    }
+    return crc16;
+}
+}  // namespace
+
+bool isPlausiblePacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept
+{
+    if (byteBuffer.size() - syncByteIndex < 2) { return true; }
+    const uint8_t firstHeaderByte = byteBuffer.peek_unchecked(syncByteIndex + 1);
+    return firstHeaderByte >= 'A' && firstHeaderByte <= 'Z';
+}
+
+FindPacketReturn findPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept
+{
+    VN_PROFILER_TIME_CURRENT_SCOPE();
+    Metadata details;
+    details.timestamp = now();
+
+    if (byteBuffer.peek_unchecked(syncByteIndex) != static_cast<uint8_t>('$'))
+    {
+        return {PacketDispatcher::FindPacketRetVal::Validity::Invalid, Metadata{}};  // It was a mistake to come here.
+    }
+
+    // Beginning one after the sync byte. A packet occupies at most two contiguous segments of the ring buffer.
+    const size_t bytesAfterSync = byteBuffer.size() - syncByteIndex;
+    const size_t bytesToScan = std::min<size_t>(bytesAfterSync, Config::PacketFinders::asciiPacketMaxLength);
+    AsciiLineScanner scanner(details);
+    size_t fromSyncByteIndex = 1;
+    while (fromSyncByteIndex < bytesToScan)
+    {
+        const size_t segmentSize = std::min(bytesToScan - fromSyncByteIndex, byteBuffer.numLinearBytesToPeek(syncByteIndex + fromSyncByteIndex));
+        if (scanner.scan(byteBuffer.peek_ptr_unchecked(syncByteIndex + fromSyncByteIndex), segmentSize, fromSyncByteIndex)) { break; }
+        fromSyncByteIndex += segmentSize;
+    }
+
+    switch (scanner.state())
+    {
+        case AsciiLineScanner::State::Complete:
+            break;
+        case AsciiLineScanner::State::Invalid:
+            return {PacketDispatcher::FindPacketRetVal::Validity::Invalid, Metadata{}};
+        default:
+        {  // No newline within the maximum packet length
+            if (bytesAfterSync > Config::PacketFinders::asciiPacketMaxLength) { return {PacketDispatcher::FindPacketRetVal::Validity::Invalid, Metadata{}}; }
+            else { return {PacketDispatcher::FindPacketRetVal::Validity::Incomplete, Metadata{}}; }
         }
-        _calculateChecksum(&checksum8, tmpByte);
-        _calculateCRC(&crc16, tmpByte);
     }
 
+    details.length = scanner.newlineIndex() + 1;
+    details.measurement = findMeasurementDescriptor(details.header);
+    const bool isMissingCarriageReturn = byteBuffer.peek_unchecked(syncByteIndex + details.length - 2) != '\r';
+
     const uint16_t bytesBetweenAstereskAndNewline = details.length - details.delimiterIndices.back();
     uint8_t crcLength;
     uint16_t calculatedChecksum;
     if (bytesBetweenAstereskAndNewline == static_cast<size_t>(2 + 2 + 1 - isMissingCarriageReturn))
     {  // *, CRC1, CRC2, \r (if isMissingCarriageReturn = false) , \n
         crcLength = 2;
-        calculatedChecksum = checksum8;
+        calculatedChecksum = scanner.checksum();
     }
     else if (bytesBetweenAstereskAndNewline == static_cast<size_t>(4 + 2 + 1 - isMissingCarriageReturn))
     {  // *, CRC1, CRC2, CRC3, CRC4, \r (if isMissingCarriageReturn = false), \n
         crcLength = 4;
-        calculatedChecksum = crc16;
+        // The 16-bit CRC is rarely enabled, so it is only computed once the trailer asks for it.
+        calculatedChecksum = calculateAsciiCrc(byteBuffer, syncByteIndex + 1, details.delimiterIndices.back() - 1u);
     }
     else if (bytesBetweenAstereskAndNewline == (0 + 2 + 1))
     {  // *, \r, \n
@@ -301,21 +622,30 @@ FindPacketReturn findPacket(const ByteBuffer& byteBuffer, const size_t syncByteI
 
 std::optional<CompositeData> parsePacket(const ByteBuffer& buffer, const size_t syncByteIndex, const Metadata& metadata,
                                          AsciiPacketProtocol::AsciiMeasurementHeader measEnum) noexcept
+{
+    if (metadata.measurement != nullptr && metadata.measurement->header == measEnum) { return parsePacket(buffer, syncByteIndex, metadata); }
+    Metadata resolvedMetadata = metadata;
+    resolvedMetadata.measurement = findMeasurementDescriptor(measEnum);
+    return parsePacket(buffer, syncByteIndex, resolvedMetadata);
+}
+
+std::optional<CompositeData> parsePacket(const ByteBuffer& buffer, const size_t syncByteIndex, const Metadata& metadata) noexcept
 {
     VN_PROFILER_TIME_CURRENT_SCOPE();
 
-    const uint8_t numExpectedDelimeters = _getNumAsciiParameters(measEnum) + 1;
+    const AsciiMeasurementDescriptor* descriptor = metadata.measurement;
+    if (descriptor == nullptr) { return std::nullopt; }
+
+    const uint8_t numExpectedDelimeters = descriptor->numParameters + 1;
     // delimeters are wrong or there are too many appended messages
     if (!(numExpectedDelimeters <= metadata.delimiterIndices.size() && metadata.delimiterIndices.size() - numExpectedDelimeters < 3)) { return std::nullopt; }
 
     CompositeData compositeData{metadata.header};
     AsciiPacketExtractor extractor(buffer, metadata, syncByteIndex);
 
-    auto asciiParsingData = _getAsciiMeasurementIndices(measEnum);
-    if (!asciiParsingData.has_value()) { return std::nullopt; }
-
-    for (const auto& measIndex : asciiParsingData.value())
+    for (uint8_t i = 0; i < descriptor->numFields; ++i)
     {
+        const AsciiMeasurementField& measIndex = descriptor->fields[i];
         if (compositeData.copyFromBuffer(extractor, measIndex.measGroupIndex, measIndex.measTypeIndex)) { return std::nullopt; }
     }
 
@@ -342,216 +672,6 @@ std::optional<CompositeData> parsePacket(const ByteBuffer& buffer, const size_t
     return std::make_optional(compositeData);
 }
 
-std::optional<Vector<AsciiMeasurementIndices, 9>> _getAsciiMeasurementIndices(AsciiMeasurementHeader asciiHeader)
-{
-    if (asciiHeader == AsciiMeasurementHeader::YPR)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(4, 1),  // Ypr
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::QTN)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(4, 2),  // Quaternion
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::QMR)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(4, 2),   // Quaternion
-            AsciiMeasurementIndices(2, 8),   // Mag
-            AsciiMeasurementIndices(2, 9),   // Accel
-            AsciiMeasurementIndices(2, 10),  // AngularRate
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::MAG)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(2, 8),  // Mag
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::ACC)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-
-            AsciiMeasurementIndices(2, 9),  // Accel
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::GYR)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(2, 10),  // AngularRate
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::MAR)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(2, 8),   // Mag
-            AsciiMeasurementIndices(2, 9),   // Accel
-            AsciiMeasurementIndices(2, 10),  // AngularRate
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::YMR)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(4, 1),   // Ypr
-            AsciiMeasurementIndices(2, 8),   // Mag
-            AsciiMeasurementIndices(2, 9),   // Accel
-            AsciiMeasurementIndices(2, 10),  // AngularRate
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::YBA)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(4, 1),   // Ypr
-            AsciiMeasurementIndices(4, 6),   // LinBodyAcc
-            AsciiMeasurementIndices(2, 10),  // AngularRate
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::YIA)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(4, 1),   // Ypr
-            AsciiMeasurementIndices(4, 7),   // LinAccelNed
-            AsciiMeasurementIndices(2, 10),  // AngularRate
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::IMU)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(2, 1),  // UncompMag
-            AsciiMeasurementIndices(2, 2),  // UncompAccel
-            AsciiMeasurementIndices(2, 3),  // UncompGyro
-            AsciiMeasurementIndices(2, 4),  // Temperature
-            AsciiMeasurementIndices(2, 5),  // Pressure
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::GPS)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(3, 1),   // GpsTow
-            AsciiMeasurementIndices(3, 2),   // GpsWeek
-            AsciiMeasurementIndices(3, 4),   // GnssFix
-            AsciiMeasurementIndices(3, 3),   // NumSats
-            AsciiMeasurementIndices(3, 5),   // GnssPosLla
-            AsciiMeasurementIndices(3, 7),   // GnssVelNed
-            AsciiMeasurementIndices(3, 9),   // GnssPosUncertainty
-            AsciiMeasurementIndices(3, 10),  // GnssVelUncertainty
-            AsciiMeasurementIndices(3, 11),  // GnssTimeUncertainty
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::GPE)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(3, 1),   // GpsTow
-            AsciiMeasurementIndices(3, 2),   // GpsWeek
-            AsciiMeasurementIndices(3, 4),   // GnssFix
-            AsciiMeasurementIndices(3, 3),   // NumSats
-            AsciiMeasurementIndices(3, 6),   // GnssPosEcef
-            AsciiMeasurementIndices(3, 8),   // GnssVelEcef
-            AsciiMeasurementIndices(3, 9),   // GnssPosUncertaintyEcef
-            AsciiMeasurementIndices(3, 10),  // GnssVelUncertainty
-            AsciiMeasurementIndices(3, 11),  // GnssTimeUncertainty
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::INS)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(1, 2),   // GpsTow
-            AsciiMeasurementIndices(1, 3),   // GpsWeek
-            AsciiMeasurementIndices(5, 0),   // InsStatus
-            AsciiMeasurementIndices(4, 1),   // Ypr
-            AsciiMeasurementIndices(5, 1),   // PosLla
-            AsciiMeasurementIndices(5, 4),   // VelNed
-            AsciiMeasurementIndices(4, 13),  // AttU
-            AsciiMeasurementIndices(5, 9),   // PosU
-            AsciiMeasurementIndices(5, 10),  // VelU
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::INE)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(1, 2),   // GpsTow
-            AsciiMeasurementIndices(1, 3),   // GpsWeek
-            AsciiMeasurementIndices(5, 0),   // InsStatus
-            AsciiMeasurementIndices(4, 1),   // Ypr
-            AsciiMeasurementIndices(5, 2),   // PosEcef
-            AsciiMeasurementIndices(5, 5),   // VelEcef
-            AsciiMeasurementIndices(4, 13),  // AttU
-            AsciiMeasurementIndices(5, 9),   // PosU
-            AsciiMeasurementIndices(5, 10),  // VelU
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::ISL)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(4, 1),   // Ypr
-            AsciiMeasurementIndices(5, 1),   // PosLla
-            AsciiMeasurementIndices(5, 4),   // VelNed
-            AsciiMeasurementIndices(2, 9),   // Accel
-            AsciiMeasurementIndices(2, 10),  // AngularRate
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::ISE)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(4, 1),   // Ypr
-            AsciiMeasurementIndices(5, 2),   // PosEcef
-            AsciiMeasurementIndices(5, 5),   // VelEcef
-            AsciiMeasurementIndices(2, 9),   // Accel
-            AsciiMeasurementIndices(2, 10),  // AngularRate
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::DTV)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(2, 6),  // DeltaTheta
-            AsciiMeasurementIndices(2, 7),  // DeltaVel
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::G2S)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(6, 1),   // GpsTow
-            AsciiMeasurementIndices(6, 2),   // GpsWeek
-            AsciiMeasurementIndices(6, 4),   // GnssFix
-            AsciiMeasurementIndices(6, 3),   // NumSats
-            AsciiMeasurementIndices(6, 5),   // GnssPosLla
-            AsciiMeasurementIndices(6, 7),   // GnssVelNed
-            AsciiMeasurementIndices(6, 9),   // GnssPosUncertainty
-            AsciiMeasurementIndices(6, 10),  // GnssVelUncertainty
-            AsciiMeasurementIndices(6, 11),  // GnssTimeUncertainty
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::G2E)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(6, 1),   // GpsTow
-            AsciiMeasurementIndices(6, 2),   // GpsWeek
-            AsciiMeasurementIndices(6, 4),   // GnssFix
-            AsciiMeasurementIndices(6, 3),   // NumSats
-            AsciiMeasurementIndices(6, 6),   // GnssPosEcef
-            AsciiMeasurementIndices(6, 8),   // GnssVelEcef
-            AsciiMeasurementIndices(6, 9),   // GnssPosUncertaintyEcef
-            AsciiMeasurementIndices(6, 10),  // GnssVelUncertainty
-            AsciiMeasurementIndices(6, 11),  // GnssTimeUncertainty
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::HVE)
-    {
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{
-            AsciiMeasurementIndices(4, 12),  // Heave
-        });
-    }
-    else if (asciiHeader == AsciiMeasurementHeader::RTK)
-    {
-        // Deprecated or unused measurements
-        return std::make_optional(Vector<AsciiMeasurementIndices, 9>{});
-    }
-    else { return std::nullopt; }
-};
-
 uint8_t _getNumAppendedFields(const uint8_t numFieldsPresent, const uint8_t numFieldsExpected) { return numFieldsPresent - numFieldsExpected; }
 
 }  // namespace AsciiPacketProtocol
@@ -23,6 +23,9 @@
 
 #include "vectornav/Implementation/FaPacketDispatcher.hpp"
 
+#include <algorithm>
+#include <limits>
+
 namespace VN
 {
 PacketDispatcher::FindPacketRetVal FaPacketDispatcher::findPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept
@@ -35,11 +38,11 @@ PacketDispatcher::FindPacketRetVal FaPacketDispatcher::findPacket(const ByteBuff
 Error FaPacketDispatcher::dispatchPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept
 {
     VN_PROFILER_TIME_CURRENT_SCOPE();
-    Error error = _invokeSubscribers(byteBuffer, syncByteIndex, _latestPacketMetadata);
+    const Route& route = _findRoute(_latestPacketMetadata.header);
+    Error error = _invokeSubscribers(byteBuffer, syncByteIndex, _latestPacketMetadata, route);
     if constexpr (Config::PacketDispatchers::compositeDataQueueCapacity > 0)
     {
-        std::optional<EnabledMeasurements> measFound = _latestPacketMetadata.header.toMeasurementHeader();
-        if (_parseToCD && measFound.has_value() && anyDataIsEnabled(measFound.value(), _enabledMeasurements))
+        if (_parseToCD && route.parseToCD && _measurementReducer.admit(route.measurementHeader.value()))
         {
             Error latestError = _tryPushToCompositeDataQueue(byteBuffer, syncByteIndex, _latestPacketMetadata);
             if (latestError != Error::None) { error = latestError; }
@@ -49,7 +52,8 @@ Error FaPacketDispatcher::dispatchPacket(const ByteBuffer& byteBuffer, const siz
     return error;
 }
 
-Error FaPacketDispatcher::addSubscriber(PacketQueue_Interface* subscriber, EnabledMeasurements headerToUse, SubscriberFilterType filterType) noexcept
+Error FaPacketDispatcher::addSubscriber(PacketQueue_Interface* subscriber, EnabledMeasurements headerToUse, SubscriberFilterType filterType,
+                                        const uint16_t decimation) noexcept
 {
     if (subscriber == nullptr) { return Error::PacketQueueNull; }
     if (headerToUse == EnabledMeasurements{0})
@@ -58,27 +62,101 @@ Error FaPacketDispatcher::addSubscriber(PacketQueue_Interface* subscriber, Enabl
         for (auto& group : headerToUse) { group = std::numeric_limits<uint32_t>::max(); }
         filterType = SubscriberFilterType::AnyMatch;
     }
-    if (_subscribers.push_back(Subscriber{subscriber, headerToUse, filterType})) { return Error::MessageSubscriberCapacityReached; }
-    else { return Error::None; }
+    if (_numSubscribers == _subscriberCapacity)
+    {
+        if (_subscriberCapacity == std::numeric_limits<uint16_t>::max()) { return Error::MessageSubscriberCapacityReached; }
+        _reserveSubscribers(static_cast<uint16_t>(std::min<uint32_t>(2u * _subscriberCapacity + 1, std::numeric_limits<uint16_t>::max())));
+    }
+    _subscribers[_numSubscribers++] = Subscriber{subscriber, headerToUse, filterType, std::max<uint16_t>(decimation, 1), 0};
+    _reserveSharedBuffers(subscriber->capacity());
+    _invalidateRoutes();
+    return Error::None;
 }
 
 void FaPacketDispatcher::removeSubscriber(PacketQueue_Interface* subscriberToRemove) noexcept
 {
-    for (auto itr = _subscribers.begin(); itr != _subscribers.end();)
+    for (uint16_t i = 0; i < _numSubscribers;)
     {
-        auto& subscriber = *itr;
-        if (subscriberToRemove == subscriber.queueToPush) { itr = _subscribers.erase(itr); }
-        else { ++itr; }
+        if (subscriberToRemove == _subscribers[i].queueToPush) { _eraseSubscriber(i); }
+        else { ++i; }
     }
 }
 
 void FaPacketDispatcher::removeSubscriber(PacketQueue_Interface* subscriberToRemove, const EnabledMeasurements& headerToUse) noexcept
 {
-    for (auto itr = _subscribers.begin(); itr != _subscribers.end();)
+    for (uint16_t i = 0; i < _numSubscribers;)
+    {
+        if (subscriberToRemove == _subscribers[i].queueToPush && headerToUse == _subscribers[i].headerFilter) { _eraseSubscriber(i); }
+        else { ++i; }
+    }
+}
+
+void FaPacketDispatcher::_eraseSubscriber(const uint16_t index) noexcept
+{
+    _unreserveSharedBuffers(_subscribers[index].queueToPush->capacity());
+    for (uint16_t i = index + 1; i < _numSubscribers; ++i) { _subscribers[i - 1] = _subscribers[i]; }  // Keeps dispatch order
+    --_numSubscribers;
+    _invalidateRoutes();
+}
+
+void FaPacketDispatcher::_reserveSubscribers(const uint16_t capacity) noexcept
+{
+    std::unique_ptr<Subscriber[]> subscribers(new Subscriber[capacity]);
+    for (uint16_t i = 0; i < _numSubscribers; ++i) { subscribers[i] = _subscribers[i]; }
+    _subscribers = std::move(subscribers);
+    _routeMatches.reset(new uint16_t[static_cast<size_t>(ROUTE_CACHE_CAPACITY) * capacity]);
+    _subscriberCapacity = capacity;
+    _invalidateRoutes();
+}
+
+void FaPacketDispatcher::_invalidateRoutes() noexcept
+{
+    for (auto& route : _routes) { route.valid = false; }
+}
+
+const FaPacketDispatcher::Route& FaPacketDispatcher::_findRoute(const BinaryHeader& header) noexcept
+{
+    // FNV-1a over the group and type words
+    uint32_t hash = 2166136261u;
+    for (const uint8_t group : header.outputGroups) { hash = (hash ^ group) * 16777619u; }
+    for (const uint16_t type : header.outputTypes) { hash = (hash ^ type) * 16777619u; }
+
+    const uint8_t routeIdx = static_cast<uint8_t>(hash & (ROUTE_CACHE_CAPACITY - 1));
+    Route& route = _routes[routeIdx];
+    if (route.valid && route.hash == hash && route.header == header) { return route; }
+
+    // Not cached: evaluate every subscriber's filter once for this header
+    route.header = header;
+    route.hash = hash;
+    route.valid = true;
+    route.measurementHeader = header.toMeasurementHeader();
+    route.parseToCD = route.measurementHeader.has_value() && anyDataIsEnabled(route.measurementHeader.value(), _enabledMeasurements);
+
+    uint16_t* matches = &_routeMatches[static_cast<size_t>(routeIdx) * _subscriberCapacity];
+    route.matches = matches;
+    route.numMatches = 0;
+    if (route.measurementHeader.has_value())
+    {
+        for (uint16_t i = 0; i < _numSubscribers; ++i)
+        {
+            if (_subscriberMatches(_subscribers[i], route.measurementHeader.value())) { matches[route.numMatches++] = i; }
+        }
+    }
+    return route;
+}
+
+bool FaPacketDispatcher::_subscriberMatches(const Subscriber& subscriber, const EnabledMeasurements& packetHeader) noexcept
+{
+    switch (subscriber.filterType)
     {
-        auto& subscriber = *itr;
-        if (subscriberToRemove == subscriber.queueToPush && headerToUse == subscriber.headerFilter) { itr = _subscribers.erase(itr); }
-        else { ++itr; }
+        case (SubscriberFilterType::AnyMatch):
+            return anyDataIsEnabled(subscriber.headerFilter, packetHeader);
+        case (SubscriberFilterType::ExactMatch):
+            return subscriber.headerFilter == packetHeader;
+        case (SubscriberFilterType::NotExactMatch):
+            return subscriber.headerFilter != packetHeader;
+        default:
+            return false;
     }
 }
 
@@ -89,69 +167,57 @@ Error FaPacketDispatcher::_tryPushToCompositeDataQueue(const ByteBuffer& byteBuf
     // TODO: Currently we fail to parse if no data is enabled. This is expected but will be fixed in the future
     auto compositeData = FaPacketProtocol::parsePacket(byteBuffer, syncByteIndex, packetDetails, _enabledMeasurements);
     if (!compositeData.has_value()) { return Error::ParsingFailed; }
+    const CompositeData* reduced = _measurementReducer.add(*compositeData);
+    if (reduced == nullptr) { return Error::None; }  // Averaging window still filling
+
+    if (_measurementReducer.mode() == MeasurementReducer::Mode::LatestOnly)
+    {
+        // Drop the oldest unconsumed measurements so a slow consumer always finds the newest ones
+        while (_compositeDataQueue->size() >= _measurementReducer.factor() && _compositeDataQueue->get()) {}
+    }
 
     // Copy to the output queue
     auto pCompositeData = _compositeDataQueue->put();
     if (!pCompositeData) { return Error::MeasurementQueueFull; }
-    *pCompositeData = compositeData.value();  // Todo 477: INvestigate passing pointer into the parser, rather than returning and copying it. Will that
-                                              // be more efficient than calling "reset" and assigning values?
+    *pCompositeData = *reduced;  // Todo 477: INvestigate passing pointer into the parser, rather than returning and copying it. Will that
+                                 // be more efficient than calling "reset" and assigning values?
     return Error::None;
 }
 
-Error FaPacketDispatcher::_invokeSubscribers(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const FaPacketProtocol::Metadata& packetDetails) noexcept
+Error FaPacketDispatcher::_invokeSubscribers(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const FaPacketProtocol::Metadata& packetDetails,
+                                             const Route& route) noexcept
 {
     Error error{Error::None};
     VN_PROFILER_TIME_CURRENT_SCOPE();
-    const auto packetHeader = packetDetails.header.toMeasurementHeader();
-    if (!packetHeader.has_value()) { return Error::ParsingFailed; }
-    for (auto& subscriber : _subscribers)
+    if (!route.measurementHeader.has_value()) { return Error::ParsingFailed; }
+    SharedPacketPool::Ref shared;
+    for (uint16_t i = 0; i < route.numMatches; ++i)
     {
-        const auto filterHeader = subscriber.headerFilter;
-        bool pushToSub;
-        switch (subscriber.filterType)
-        {
-            case (SubscriberFilterType::AnyMatch):
-            {
-                pushToSub = anyDataIsEnabled(filterHeader, packetHeader.value());
-                break;
-            }
-            case (SubscriberFilterType::ExactMatch):
-            {
-                pushToSub = filterHeader == packetHeader.value();
-                break;
-            }
-            case (SubscriberFilterType::NotExactMatch):
-            {
-                pushToSub = filterHeader != packetHeader.value();
-                break;
-            }
-            default:
-                pushToSub = false;
-        }
-        if (pushToSub)
-        {
-            const Error latestError = _tryPushToSubscriber(byteBuffer, syncByteIndex, packetDetails, subscriber);
-            if (latestError != Error::None) { error = latestError; }
-        }
+        const Error latestError = _tryPushToSubscriber(byteBuffer, syncByteIndex, packetDetails, _subscribers[route.matches[i]], shared);
+        if (latestError != Error::None) { error = latestError; }
     }
     return error;
 }
 
 Error FaPacketDispatcher::_tryPushToSubscriber(const ByteBuffer& byteBuffer, const size_t syncByteIndex, const FaPacketProtocol::Metadata& metadata,
-                                               Subscriber& subscriber) noexcept
+                                               Subscriber& subscriber, SharedPacketPool::Ref& shared) noexcept
 {
+    if (subscriber.decimation > 1)
+    {
+        if (++subscriber.skipped < subscriber.decimation) { return Error::None; }
+        subscriber.skipped = 0;
+    }
     auto putSlot = subscriber.queueToPush->put();
     if (putSlot)
     {
-        if (putSlot->capacity >= metadata.length)
+        if (!putSlot->fill(byteBuffer, syncByteIndex, metadata.length, _sharedPacketPool, shared))
         {
             putSlot->details.syncByte = PacketDetails::SyncByte::FA;
             putSlot->details.faMetadata = metadata;
-            byteBuffer.peek_unchecked(putSlot->buffer, metadata.length, syncByteIndex);
         }
         else
         {
-            putSlot->details = PacketDetails();
+            subscriber.queueToPush->cancelPut(putSlot);
             return Error::PacketQueueOverrun;
         }
     }
@@ -24,6 +24,7 @@
 #include "vectornav/Implementation/FaPacketProtocol.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstdint>
 
@@ -44,9 +45,10 @@ bool _isValidBinaryCrc(const ByteBuffer& buffer, const size_t syncByteIndex, con
 {
     uint16_t calculatedCrc = 0;
     // Crc validation does not include sync byte
-    for (size_t fromHeadIndex = syncByteIndex + 1; fromHeadIndex < (syncByteIndex + packetLength); ++fromHeadIndex)
+    const auto spans = buffer.peekSpans(syncByteIndex + 1, packetLength - 1u);
+    for (const auto& span : {spans.first, spans.second})
     {
-        _calculateCRC(&calculatedCrc, buffer.peek_unchecked(fromHeadIndex));
+        for (size_t i = 0; i < span.size; ++i) { _calculateCRC(&calculatedCrc, span.data[i]); }
     }
     return calculatedCrc == 0;
 }
@@ -195,8 +197,57 @@ PacketDispatcher::FindPacketRetVal::Validity _populateHeader(const ByteBuffer& b
     else { return Validity::Valid; }
 }
 
+constexpr uint16_t _knownTypeBits(const uint8_t binaryGroup) noexcept
+{
+    uint16_t typeBits = 0;
+    for (uint8_t binaryType = 0; binaryType < 15; ++binaryType)
+    {
+        if (getStaticBinaryTypeSize(binaryGroup, binaryType).has_value()) { typeBits |= static_cast<uint16_t>(1u << binaryType); }
+    }
+    if (binaryGroup == 3 || binaryGroup == 6 || binaryGroup == 12) { typeBits |= 1u << 14; }  // Sat Info is sized by its payload
+    return typeBits;
+}
+
+// Type bits of the first type word known for each group of the first group byte, and for Gnss3 in the extension group byte.
+constexpr std::array<uint16_t, 7> _knownFirstTypeBits{_knownTypeBits(0), _knownTypeBits(1), _knownTypeBits(2), _knownTypeBits(3),
+                                                     _knownTypeBits(4), _knownTypeBits(5), _knownTypeBits(6)};
+constexpr uint16_t _knownGnss3FirstTypeBits = _knownTypeBits(12);
+constexpr uint8_t _knownExtensionGroupBits = 1u << (12 - 8);
+
 }  // namespace
 
+bool isPlausiblePacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept
+{
+    const size_t numPacketBytesInBuffer = byteBuffer.size() - syncByteIndex;
+    if (numPacketBytesInBuffer < 2) { return true; }
+    const uint8_t groupByte = byteBuffer.peek_unchecked(syncByteIndex + 1);
+    size_t typeWordIndex = 2;
+    uint16_t knownTypeBits;
+    if (groupByte & 0x7F)
+    {
+        uint8_t firstGroup = 0;
+        while (!(groupByte & (1u << firstGroup))) { ++firstGroup; }
+        knownTypeBits = _knownFirstTypeBits[firstGroup];
+    }
+    else { knownTypeBits = _knownGnss3FirstTypeBits; }
+
+    if (groupByte & 0x80)
+    {
+        if (numPacketBytesInBuffer < 3) { return true; }
+        const uint8_t extensionGroupByte = byteBuffer.peek_unchecked(syncByteIndex + 2);
+        if (extensionGroupByte & ~_knownExtensionGroupBits) { return false; }
+        if (!(groupByte & 0x7F) && !extensionGroupByte) { return false; }
+        ++typeWordIndex;
+    }
+    else if (!groupByte) { return false; }
+
+    if (numPacketBytesInBuffer < typeWordIndex + 2) { return true; }
+    const uint16_t typeWord = static_cast<uint16_t>(byteBuffer.peek_unchecked(syncByteIndex + typeWordIndex) |
+                                                    (byteBuffer.peek_unchecked(syncByteIndex + typeWordIndex + 1) << 8));
+    if (typeWord & ~(knownTypeBits | 0x8000)) { return false; }
+    return typeWord != 0;
+}
+
 FindPacketReturn findPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept
 {
     VN_PROFILER_TIME_CURRENT_SCOPE();
@@ -265,12 +316,11 @@ FindPacketReturn findPacket(const ByteBuffer& byteBuffer, const size_t syncByteI
     return isValidCrc ? FindPacketReturn{Validity::Valid, metadata} : FindPacketReturn{Validity::Invalid, metadata};
 }
 
-std::optional<CompositeData> parsePacket(const ByteBuffer& buffer, const size_t syncByteIndex, const Metadata& metadata,
-                                         [[maybe_unused]] const EnabledMeasurements& measurementsToParse) noexcept
+namespace
+{
+template <class Output>
+Errored _parsePayload(const ByteBuffer& buffer, const size_t syncByteIndex, const Metadata& metadata, Output& output) noexcept
 {
-    VN_PROFILER_TIME_CURRENT_SCOPE();
-    CompositeData compositeData(metadata.header);
-
     FaPacketExtractor extractor(buffer, metadata, syncByteIndex);
     extractor.discard(metadata.header.size() + 1);
 
@@ -280,13 +330,30 @@ std::optional<CompositeData> parsePacket(const ByteBuffer& buffer, const size_t
     {
         uint16_t fieldSize = 0;
         auto validity = _calculateBinaryMeasurementTypeSize(buffer, syncByteIndex + extractor.index(), iter.group(), iter.field(), fieldSize);
-        if (validity != PacketDispatcher::FindPacketRetVal::Validity::Valid) { return std::nullopt; }
-        if (compositeData.copyFromBuffer(extractor, iter.group(), iter.field())) { extractor.discard(fieldSize); }
+        if (validity != PacketDispatcher::FindPacketRetVal::Validity::Valid) { return true; }
+        if (output.copyFromBuffer(extractor, iter.group(), iter.field())) { extractor.discard(fieldSize); }
         else { consumed = true; }
     }
 
-    if (extractor.index() != (metadata.length - 2)) { return std::nullopt; }
-    return (consumed) ? std::make_optional(compositeData) : std::nullopt;
+    if (extractor.index() != (metadata.length - 2)) { return true; }
+    return !consumed;
+}
+}  // namespace
+
+std::optional<CompositeData> parsePacket(const ByteBuffer& buffer, const size_t syncByteIndex, const Metadata& metadata,
+                                         [[maybe_unused]] const EnabledMeasurements& measurementsToParse) noexcept
+{
+    VN_PROFILER_TIME_CURRENT_SCOPE();
+    CompositeData compositeData(metadata.header);
+    if (_parsePayload(buffer, syncByteIndex, metadata, compositeData)) { return std::nullopt; }
+    return compositeData;
+}
+
+Errored parsePacket(const ByteBuffer& buffer, const size_t syncByteIndex, const Metadata& metadata, CompactCompositeData& compactData) noexcept
+{
+    VN_PROFILER_TIME_CURRENT_SCOPE();
+    compactData.reset(metadata.header);
+    return _parsePayload(buffer, syncByteIndex, metadata, compactData) || compactData.truncated();
 }
 
 }  // namespace FaPacketProtocol
@@ -23,6 +23,7 @@
 
 #include "vectornav/Implementation/FbPacketDispatcher.hpp"
 
+#include "vectornav/Debug.hpp"
 #include "vectornav/Implementation/CoreUtils.hpp"
 namespace VN
 {
@@ -35,123 +36,136 @@ PacketDispatcher::FindPacketRetVal FbPacketDispatcher::findPacket(const ByteBuff
 
 Error FbPacketDispatcher::dispatchPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept
 {
+    VN_PROFILER_TIME_CURRENT_SCOPE();
     // We must assume that _latestPacketMetadata is correctly set.
+    Error error{Error::None};
+    PacketDetails details;
+    details.syncByte = PacketDetails::SyncByte::FB;
+    details.fbMetadata = _latestPacketMetadata;
+    SharedPacketPool::Ref shared;
     for (auto& subscriber : _subscribers)
     {
         if (subscriber.queueToPush && subscriber.filter.packet)
         {
-            auto putSlot = subscriber.queueToPush->put();
-            if (putSlot)
-            {
-                if (putSlot->capacity >= _latestPacketMetadata.length)
-                {
-                    putSlot->details.syncByte = PacketDetails::SyncByte::FB;
-                    putSlot->details.fbMetadata = _latestPacketMetadata;
-                    byteBuffer.peek_unchecked(putSlot->buffer, _latestPacketMetadata.length, syncByteIndex);
-                }
-                else
-                {
-                    putSlot->details = PacketDetails();
-                    // TODO: Error::PacketQueueOverrun
-                }
-            }
-            else
-            {
-                // TODO: Error::PacketQueueFull
-            }
+            const Error latestError = _pushToSubscriber(subscriber, byteBuffer, syncByteIndex, _latestPacketMetadata.length, details, shared);
+            if (latestError != Error::None) { error = latestError; }
         }
     }
 
-    Error error{Error::None};
-    const bool packetIsInvalid = (_latestPacketMetadata.header.currentPacketCount == 1)
-                                     ? false
-                                     : (_latestPacketMetadata.header.messageId != _previousPacketMetadata.header.messageId) ||
-                                           ((_latestPacketMetadata.header.messageId == _previousPacketMetadata.header.messageId) &&
-                                            (_latestPacketMetadata.header.currentPacketCount != (_previousPacketMetadata.header.currentPacketCount + 1)));
-    if (packetIsInvalid)
+    const FbPacketProtocol::Header& header = _latestPacketMetadata.header;
+    if (header.currentPacketCount == 1)
     {
-        // Unless this is the first packet of a message, the packet is invalid if it's either:
-        //   1. Isn't the same messageId as the previous
-        //   2. The same message as previous, but not next in order (nor the first of a new)
-        // We should wipe the copied buffer and move on.
-        _fbByteBuffer.reset();
-        return Error::ReceivedUnexpectedMessage;
+        // A message still in progress has lost its remaining packets
+        if (_receivedPacketCount != 0) { error = Error::ReceivedUnexpectedMessage; }
+        _startMessage(header);
     }
-
-    if (_latestPacketMetadata.header.currentPacketCount == 1) { _resetFbBuffer(); }
-
-    error = _moveBytesFromMainBufferToFbBuffer(_latestPacketMetadata.header, byteBuffer, _latestPacketMetadata.header.payloadLength,
-                                               syncByteIndex + 1 + 5);  // Add after FB header
-    if (error != Error::None) { return error; }
-
-    const bool packetIsFinalOfMessage = _latestPacketMetadata.header.currentPacketCount == _latestPacketMetadata.header.totalPacketCount;
-    if (packetIsFinalOfMessage)
+    else if (!_isNextPacketOfMessage(header))
     {
-        _addFaPacketCrc();
-
-        const auto retVal = _faPacketDispatcher->findPacket(_fbByteBuffer, 0);
+        // Either a lost or reordered packet, or one of a message that already was dropped.
+        const bool alreadyDropped = (_receivedPacketCount == 0) && _messageWasDropped && (header.messageId == _droppedMessageId);
+        _dropMessage(header.messageId);
+        return alreadyDropped ? error : Error::ReceivedUnexpectedMessage;
+    }
 
-        if (retVal.validity == PacketDispatcher::FindPacketRetVal::Validity::Valid)
-        {
-            const auto duplicateRetVal = FaPacketProtocol::findPacket(_fbByteBuffer, 0);
-            if (duplicateRetVal.validity == FaPacketProtocol::Validity::Valid)  // should always pass
-            {
-                for (auto& subscriber : _subscribers)
-                {
-                    if (subscriber.queueToPush && subscriber.filter.completedFaMessage)
-                    {
-                        auto putSlot = subscriber.queueToPush->put();
-                        if (putSlot)
-                        {
-                            putSlot->details.syncByte = PacketDetails::SyncByte::FA;
-                            putSlot->details.faMetadata = duplicateRetVal.metadata;
-                            _fbByteBuffer.peek_unchecked(putSlot->buffer, putSlot->details.faMetadata.length);
-                        }
-                        else {}  // Todo**Raise exception of buffer overflow
-                    }
-                }
-                _faPacketDispatcher->dispatchPacket(_fbByteBuffer, 0);
-            }
-        }
-        _fbByteBuffer.reset();
+    if (_appendPayload(byteBuffer, syncByteIndex + 1 + 5, header.payloadLength))  // Add after FB header
+    {
+        _dropMessage(header.messageId);
+        return Error::ReceivedByteBufferFull;
     }
-    _previousPacketMetadata = _latestPacketMetadata;
 
+    _receivedPacketCount = header.currentPacketCount;
+    if (header.currentPacketCount != header.totalPacketCount) { return error; }
+
+    const Error latestError = _dispatchCompletedMessage();
+    if (latestError != Error::None) { error = latestError; }
+    _receivedPacketCount = 0;
     return error;
 }
 
-Error FbPacketDispatcher::_moveBytesFromMainBufferToFbBuffer(FbPacketProtocol::Header splitPacketDetails, const ByteBuffer& byteBuffer,
-                                                             const uint16_t numOfBytesToMove, const size_t startingIndex) noexcept
+void FbPacketDispatcher::_startMessage(const FbPacketProtocol::Header& header) noexcept
 {
-    if (splitPacketDetails.payloadLength > byteBuffer.size()) { return Error::ReceivedByteBufferFull; }
-    for (uint16_t i = 0; i < numOfBytesToMove; i++)
-    {
-        auto tmpByte = byteBuffer.peek_unchecked(startingIndex + i);
-        _fbByteBuffer.put(&tmpByte, 1);
-    }
-    return Error::None;
+    _fbByteBuffer.reset();
+    const uint8_t faSyncByte = 0xFA;
+    _fbByteBuffer.put(&faSyncByte, 1);
+    _messageId = header.messageId;
+    _totalPacketCount = header.totalPacketCount;
+    _faCrc = 0;
+    _messageWasDropped = false;
 }
 
-void FbPacketDispatcher::_resetFbBuffer() noexcept
+void FbPacketDispatcher::_dropMessage(const uint8_t messageId) noexcept
 {
     _fbByteBuffer.reset();
-    const uint8_t faSyncByte = 0xFA;
-    _fbByteBuffer.put(&faSyncByte, 1);
+    _receivedPacketCount = 0;
+    _messageWasDropped = true;
+    _droppedMessageId = messageId;
 }
 
-void FbPacketDispatcher::_addFaPacketCrc() noexcept
+bool FbPacketDispatcher::_isNextPacketOfMessage(const FbPacketProtocol::Header& header) const noexcept
 {
-    uint16_t crc = 0;
+    return (_receivedPacketCount != 0) && (header.messageId == _messageId) && (header.totalPacketCount == _totalPacketCount) &&
+           (header.currentPacketCount == _receivedPacketCount + 1);
+}
 
-    // Calculate a CRC over everything but the sync byte
-    for (size_t i = 1; i < _fbByteBuffer.size(); ++i) { _calculateCRC(&crc, (*_fbByteBuffer.peek(i))); }
+Errored FbPacketDispatcher::_appendPayload(const ByteBuffer& byteBuffer, const size_t payloadIndex, const uint16_t payloadLength) noexcept
+{
+    // Leave room for the FA CRC, which is appended once the message is complete
+    if (_fbByteBuffer.size() + payloadLength + 2 > _fbByteBuffer.capacity()) { return true; }
 
+    // The payload is at most two linear spans of the main buffer; each is copied in one put, accumulating the FA CRC over the same bytes.
+    const auto spans = byteBuffer.peekSpans(payloadIndex, payloadLength);
+    for (const auto& span : {spans.first, spans.second})
+    {
+        for (size_t i = 0; i < span.size; ++i) { _calculateCRC(&_faCrc, span.data[i]); }
+        _fbByteBuffer.put(span.data, span.size);
+    }
+    return false;
+}
+
+Error FbPacketDispatcher::_dispatchCompletedMessage() noexcept
+{
     // Crc is put in big endian
-    uint8_t data = 0;
-    data = static_cast<uint8_t>(crc >> 8);
-    _fbByteBuffer.put(&data, 1);  // CRC
-    data = static_cast<uint8_t>(crc & 0xFF);
-    _fbByteBuffer.put(&data, 1);  // CRC
+    const uint8_t crcBytes[2] = {static_cast<uint8_t>(_faCrc >> 8), static_cast<uint8_t>(_faCrc & 0xFF)};
+    _fbByteBuffer.put(crcBytes, 2);
+
+    const auto retVal = _faPacketDispatcher->findPacket(_fbByteBuffer, 0);
+    if (retVal.validity != PacketDispatcher::FindPacketRetVal::Validity::Valid || retVal.length != _fbByteBuffer.size())
+    {
+        _fbByteBuffer.reset();
+        return Error::ParsingFailed;
+    }
+
+    Error error{Error::None};
+    PacketDetails details;
+    details.syncByte = PacketDetails::SyncByte::FA;
+    details.faMetadata = _faPacketDispatcher->getLatestPacketMetadata();
+    SharedPacketPool::Ref sharedFaMessage;
+    for (auto& subscriber : _subscribers)
+    {
+        if (subscriber.queueToPush && subscriber.filter.completedFaMessage)
+        {
+            const Error latestError = _pushToSubscriber(subscriber, _fbByteBuffer, 0, retVal.length, details, sharedFaMessage);
+            if (latestError != Error::None) { error = latestError; }
+        }
+    }
+    const Error latestError = _faPacketDispatcher->dispatchPacket(_fbByteBuffer, 0);
+    if (latestError != Error::None) { error = latestError; }
+    _fbByteBuffer.reset();
+    return error;
+}
+
+Error FbPacketDispatcher::_pushToSubscriber(Subscriber& subscriber, const ByteBuffer& byteBuffer, const size_t syncByteIndex, const uint16_t length,
+                                            const PacketDetails& details, SharedPacketPool::Ref& shared) noexcept
+{
+    auto putSlot = subscriber.queueToPush->put();
+    if (!putSlot) { return Error::PacketQueueFull; }
+    if (putSlot->fill(byteBuffer, syncByteIndex, length, _sharedPacketPool, shared))
+    {
+        subscriber.queueToPush->cancelPut(putSlot);
+        return Error::PacketQueueOverrun;
+    }
+    putSlot->details = details;
+    return Error::None;
 }
 
 }  // namespace VN
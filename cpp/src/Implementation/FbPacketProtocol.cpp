@@ -32,13 +32,29 @@ bool _isValidBinaryCrc(const ByteBuffer& buffer, const size_t syncByteIndex, con
 {
     uint16_t calculatedCrc = 0;
     // Crc validation does not include sync byte
-    for (size_t fromHeadIndex = syncByteIndex + 1; fromHeadIndex < (syncByteIndex + packetLength); ++fromHeadIndex)
+    const auto spans = buffer.peekSpans(syncByteIndex + 1, packetLength - 1u);
+    for (const auto& span : {spans.first, spans.second})
     {
-        _calculateCRC(&calculatedCrc, buffer.peek_unchecked(fromHeadIndex));
+        for (size_t i = 0; i < span.size; ++i) { _calculateCRC(&calculatedCrc, span.data[i]); }
     }
     return calculatedCrc == 0;
 }
 
+bool isPlausiblePacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept
+{
+    const uint16_t headerSize = 5;
+    const size_t numPacketBytesInBuffer = byteBuffer.size() - syncByteIndex;
+    if (numPacketBytesInBuffer < 4) { return true; }
+    const uint8_t packetCount = byteBuffer.peek_unchecked(syncByteIndex + 3);
+    const uint8_t totalNumPackets = (packetCount & 0xF0) >> 4;
+    const uint8_t currentPacketCount = (packetCount & 0x0F);
+    if (currentPacketCount == 0 || currentPacketCount > totalNumPackets) { return false; }
+
+    if (numPacketBytesInBuffer < 1 + headerSize) { return true; }
+    const uint16_t payloadLength = byteBuffer.peek_unchecked(syncByteIndex + 4) + (byteBuffer.peek_unchecked(syncByteIndex + 5) << 8);
+    return payloadLength != 0 && (1 + headerSize + payloadLength + 2) <= MAX_PACKET_LENGTH;
+}
+
 FbPacketProtocol::FindPacketReturn findPacket(const ByteBuffer& byteBuffer, const size_t syncByteIndex) noexcept
 {
     Metadata metadata;
@@ -0,0 +1,235 @@
+// The MIT License (MIT)
+// 
+// VectorNav SDK (v0.99.0)
+// Copyright (c) 2024 VectorNav Technologies, LLC
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "vectornav/Implementation/MeasurementReducer.hpp"
+
+#include <algorithm>
+
+namespace VN
+{
+
+namespace
+{
+template <typename T>
+void sumInto(std::optional<T>& sum, const std::optional<T>& value) noexcept
+{
+    if (!value.has_value()) { return; }
+    if (sum.has_value()) { *sum = *sum + *value; }
+    else { sum = value; }
+}
+
+void sumInto(std::optional<DeltaTheta>& sum, const std::optional<DeltaTheta>& value) noexcept
+{
+    if (!value.has_value()) { return; }
+    if (sum.has_value())
+    {
+        sum->deltaTime += value->deltaTime;
+        sum->deltaTheta = sum->deltaTheta + value->deltaTheta;
+    }
+    else { sum = value; }
+}
+
+template <typename T>
+void averageInto(std::optional<T>& out, const std::optional<T>& sum, const float count) noexcept
+{
+    if (out.has_value() && sum.has_value()) { *out = *sum / count; }
+}
+
+template <typename T>
+void copyInto(std::optional<T>& out, const std::optional<T>& sum) noexcept
+{
+    if (out.has_value() && sum.has_value()) { out = sum; }
+}
+}  // namespace
+
+void MeasurementReducer::configure(const Mode mode, const uint16_t factor) noexcept
+{
+    _mode = mode;
+    _factor = std::max<uint16_t>(factor, 1);
+    for (auto& window : _windows) { window = Window{}; }
+    _current = nullptr;
+}
+
+bool MeasurementReducer::admit(const EnabledMeasurements& header) noexcept
+{
+    switch (_mode)
+    {
+        case Mode::Decimate:
+        {
+            Window* window = _findWindow(header);
+            if (window == nullptr) { return true; }
+            if (++window->count < _factor) { return false; }
+            window->count = 0;
+            return true;
+        }
+        case Mode::Average:
+            _current = _findWindow(header);
+            return true;
+        default:
+            return true;
+    }
+}
+
+const CompositeData* MeasurementReducer::add(CompositeData& compositeData) noexcept
+{
+    if (_mode != Mode::Average || _current == nullptr) { return &compositeData; }
+    Window& window = *_current;
+    _current = nullptr;
+    _accumulate(window, compositeData);
+    if (++window.count < _factor) { return nullptr; }
+
+    _applyAverages(window, compositeData);
+    const EnabledMeasurements header = window.header;
+    window = Window{};
+    window.header = header;
+    window.used = true;
+    return &compositeData;
+}
+
+MeasurementReducer::Window* MeasurementReducer::_findWindow(const EnabledMeasurements& header) noexcept
+{
+    for (auto& window : _windows)
+    {
+        if (window.used && window.header == header) { return &window; }
+    }
+    auto window = std::find_if(_windows.begin(), _windows.end(), [](const Window& candidate) { return !candidate.used; });
+    // More distinct outputs than windows: the extra ones pass through unreduced. Restarting a claimed window instead would keep every window
+    // from ever reaching the factor once the outputs interleave.
+    if (window == _windows.end()) { return nullptr; }
+    window->header = header;
+    window->used = true;
+    return &*window;
+}
+
+void MeasurementReducer::_accumulate([[maybe_unused]] Window& window, [[maybe_unused]] const CompositeData& compositeData) noexcept
+{
+#if (IMU_GROUP_ENABLE)
+    [[maybe_unused]] const auto& imu = compositeData.imu;
+#endif
+#if (IMU_GROUP_ENABLE & IMU_UNCOMPMAG_BIT)
+    sumInto(window.imu.uncompMag, imu.uncompMag);
+#endif
+#if (IMU_GROUP_ENABLE & IMU_UNCOMPACCEL_BIT)
+    sumInto(window.imu.uncompAccel, imu.uncompAccel);
+#endif
+#if (IMU_GROUP_ENABLE & IMU_UNCOMPGYRO_BIT)
+    sumInto(window.imu.uncompGyro, imu.uncompGyro);
+#endif
+#if (IMU_GROUP_ENABLE & IMU_TEMPERATURE_BIT)
+    sumInto(window.imu.temperature, imu.temperature);
+#endif
+#if (IMU_GROUP_ENABLE & IMU_PRESSURE_BIT)
+    sumInto(window.imu.pressure, imu.pressure);
+#endif
+#if (IMU_GROUP_ENABLE & IMU_DELTATHETA_BIT)
+    sumInto(window.imu.deltaTheta, imu.deltaTheta);
+#endif
+#if (IMU_GROUP_ENABLE & IMU_DELTAVEL_BIT)
+    sumInto(window.imu.deltaVel, imu.deltaVel);
+#endif
+#if (IMU_GROUP_ENABLE & IMU_MAG_BIT)
+    sumInto(window.imu.mag, imu.mag);
+#endif
+#if (IMU_GROUP_ENABLE & IMU_ACCEL_BIT)
+    sumInto(window.imu.accel, imu.accel);
+#endif
+#if (IMU_GROUP_ENABLE & IMU_ANGULARRATE_BIT)
+    sumInto(window.imu.angularRate, imu.angularRate);
+#endif
+#if (IMU_GROUP_ENABLE & IMU_SENSSAT_BIT)
+    if (imu.sensSat.has_value()) { window.imu.sensSat = static_cast<uint16_t>(window.imu.sensSat.value_or(0) | *imu.sensSat); }
+#endif
+#if (ATTITUDE_GROUP_ENABLE)
+    [[maybe_unused]] const auto& attitude = compositeData.attitude;
+#endif
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_MAGNED_BIT)
+    sumInto(window.attitude.magNed, attitude.magNed);
+#endif
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_ACCELNED_BIT)
+    sumInto(window.attitude.accelNed, attitude.accelNed);
+#endif
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_LINBODYACC_BIT)
+    sumInto(window.attitude.linBodyAcc, attitude.linBodyAcc);
+#endif
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_LINACCELNED_BIT)
+    sumInto(window.attitude.linAccelNed, attitude.linAccelNed);
+#endif
+}
+
+void MeasurementReducer::_applyAverages([[maybe_unused]] const Window& window, [[maybe_unused]] CompositeData& compositeData) noexcept
+{
+    [[maybe_unused]] const float count = static_cast<float>(window.count);
+#if (IMU_GROUP_ENABLE)
+    [[maybe_unused]] auto& imu = compositeData.imu;
+#endif
+#if (IMU_GROUP_ENABLE & IMU_UNCOMPMAG_BIT)
+    averageInto(imu.uncompMag, window.imu.uncompMag, count);
+#endif
+#if (IMU_GROUP_ENABLE & IMU_UNCOMPACCEL_BIT)
+    averageInto(imu.uncompAccel, window.imu.uncompAccel, count);
+#endif
+#if (IMU_GROUP_ENABLE & IMU_UNCOMPGYRO_BIT)
+    averageInto(imu.uncompGyro, window.imu.uncompGyro, count);
+#endif
+#if (IMU_GROUP_ENABLE & IMU_TEMPERATURE_BIT)
+    averageInto(imu.temperature, window.imu.temperature, count);
+#endif
+#if (IMU_GROUP_ENABLE & IMU_PRESSURE_BIT)
+    averageInto(imu.pressure, window.imu.pressure, count);
+#endif
+#if (IMU_GROUP_ENABLE & IMU_DELTATHETA_BIT)
+    copyInto(imu.deltaTheta, window.imu.deltaTheta);
+#endif
+#if (IMU_GROUP_ENABLE & IMU_DELTAVEL_BIT)
+    copyInto(imu.deltaVel, window.imu.deltaVel);
+#endif
+#if (IMU_GROUP_ENABLE & IMU_MAG_BIT)
+    averageInto(imu.mag, window.imu.mag, count);
+#endif
+#if (IMU_GROUP_ENABLE & IMU_ACCEL_BIT)
+    averageInto(imu.accel, window.imu.accel, count);
+#endif
+#if (IMU_GROUP_ENABLE & IMU_ANGULARRATE_BIT)
+    averageInto(imu.angularRate, window.imu.angularRate, count);
+#endif
+#if (IMU_GROUP_ENABLE & IMU_SENSSAT_BIT)
+    copyInto(imu.sensSat, window.imu.sensSat);
+#endif
+#if (ATTITUDE_GROUP_ENABLE)
+    [[maybe_unused]] auto& attitude = compositeData.attitude;
+#endif
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_MAGNED_BIT)
+    averageInto(attitude.magNed, window.attitude.magNed, count);
+#endif
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_ACCELNED_BIT)
+    averageInto(attitude.accelNed, window.attitude.accelNed, count);
+#endif
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_LINBODYACC_BIT)
+    averageInto(attitude.linBodyAcc, window.attitude.linBodyAcc, count);
+#endif
+#if (ATTITUDE_GROUP_ENABLE & ATTITUDE_LINACCELNED_BIT)
+    averageInto(attitude.linAccelNed, window.attitude.linAccelNed, count);
+#endif
+}
+
+}  // namespace VN
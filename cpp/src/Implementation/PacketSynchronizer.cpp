@@ -33,7 +33,9 @@ namespace VN
 
 Errored PacketSynchronizer::addDispatcher(PacketDispatcher* packetParser) noexcept
 {
-    return _dispatchers.push_back({packetParser, packetParser->getSyncBytes(), PacketDispatcher::FindPacketRetVal()});
+    if (_dispatchers.push_back({packetParser, packetParser->getSyncBytes(), PacketDispatcher::FindPacketRetVal()})) { return true; }
+    _isFirstSyncByte[_dispatchers.back().syncBytes.front()] = true;
+    return false;
 }
 
 Errored PacketSynchronizer::dispatchNextPacket() noexcept
@@ -48,79 +50,83 @@ Errored PacketSynchronizer::dispatchNextPacket() noexcept
     }
     _prevByteBufferSize = byteBufferSize;
     VN_PROFILER_TIME_CURRENT_SCOPE();
-    for (size_t fromHeadIndex = 0; fromHeadIndex < byteBufferSize; ++fromHeadIndex)
+    for (size_t fromHeadIndex = _findFirstSyncByte(0, byteBufferSize); fromHeadIndex < byteBufferSize;
+         fromHeadIndex = _findFirstSyncByte(fromHeadIndex + 1, byteBufferSize))
     {
         for (const auto& currentDispatcher : this->_dispatchers)
         {
-            // TODO 133: Modify to handle multi-size sync bytes
-            if (currentDispatcher.syncBytes.front() == _primaryByteBuffer.peek_unchecked(fromHeadIndex))
+            if (!_matchesSyncBytes(currentDispatcher.syncBytes, fromHeadIndex, byteBufferSize)) { continue; }
+            if (!currentDispatcher.packetDispatcher->isPlausiblePacket(_primaryByteBuffer, fromHeadIndex))
             {
-                auto retVal = currentDispatcher.packetDispatcher->findPacket(_primaryByteBuffer, fromHeadIndex);
-                switch (retVal.validity)
+                // A stray sync byte, rejected without a full search
+                ++currentDispatcher.numInvalidPackets;
+                continue;
+            }
+            auto retVal = currentDispatcher.packetDispatcher->findPacket(_primaryByteBuffer, fromHeadIndex);
+            switch (retVal.validity)
+            {
+                case (PacketDispatcher::FindPacketRetVal::Validity::Valid):
                 {
-                    case (PacketDispatcher::FindPacketRetVal::Validity::Valid):
-                    {
-                        needMoreData = false;
-                        ++currentDispatcher.numValidPackets;
-                        VN_DEBUG_2("Packet found: " + std::to_string(currentDispatcher.syncBytes.front()) + " length: " + std::to_string(retVal.length));
-                        latestError = currentDispatcher.packetDispatcher->dispatchPacket(_primaryByteBuffer, fromHeadIndex);
-                        if (latestError != Error::None && _asyncErrorQueuePush)
-                        {
-                            _asyncErrorQueuePush(AsyncError{latestError, errorCodeToString(latestError), now()});
-                        }
-
-                        // Require that at least the sync bytes are discarded, to prevent locking due to a bad dispatcher
-                        size_t numPacketBytesToDiscard = std::max(currentDispatcher.syncBytes.size(), retVal.length);
-                        latestError = _copyToSkippedByteQueueIfEnabled(fromHeadIndex);
-                        if (latestError != Error::None && _asyncErrorQueuePush)
-                        {
-                            _asyncErrorQueuePush(AsyncError{latestError, errorCodeToString(latestError), now()});
-                        }
-                        _receivedByteCount += (fromHeadIndex + numPacketBytesToDiscard);
-                        _primaryByteBuffer.discard(fromHeadIndex + numPacketBytesToDiscard);
-
-                        // We are returning so that we can pull data off the serial queue after each packet. This way we don't blow through the whole buffer
-                        // at a time while the serial queue overflows.
-                        _prevValidity = PacketDispatcher::FindPacketRetVal::Validity::Valid;
-                        _prevByteBufferSize -= fromHeadIndex + numPacketBytesToDiscard;
-                        return needMoreData;
-                    }
-                    case (PacketDispatcher::FindPacketRetVal::Validity::Invalid):
+                    needMoreData = false;
+                    ++currentDispatcher.numValidPackets;
+                    VN_DEBUG_2("Packet found: " + std::to_string(currentDispatcher.syncBytes.front()) + " length: " + std::to_string(retVal.length));
+                    latestError = currentDispatcher.packetDispatcher->dispatchPacket(_primaryByteBuffer, fromHeadIndex);
+                    if (latestError != Error::None && _asyncErrorQueuePush)
                     {
-                        // Keep searching, might have just been a random sync byte.
-                        ++currentDispatcher.numInvalidPackets;
-                        continue;
+                        _asyncErrorQueuePush(AsyncError{latestError, errorCodeToString(latestError), now()});
                     }
-                    case (PacketDispatcher::FindPacketRetVal::Validity::Incomplete):
+
+                    // Require that at least the sync bytes are discarded, to prevent locking due to a bad dispatcher
+                    size_t numPacketBytesToDiscard = std::max(currentDispatcher.syncBytes.size(), retVal.length);
+                    latestError = _copyToSkippedByteQueueIfEnabled(fromHeadIndex);
+                    if (latestError != Error::None && _asyncErrorQueuePush)
                     {
-                        // Let's trust that this is probably a packet of this type, so we'll wait for more data and start searching again.
-                        // We might as well discard all of the bytes so far, because clearly no one wanted it.
-                        VN_DEBUG_2("Found possible packet: " + std::to_string(currentDispatcher.syncBytes.front()) +
-                                   " bytes available: " + std::to_string(_primaryByteBuffer.size()));
-
-                        // If dispatcher reports "incomplete" despite number of bytes exceeding global packet max length, then it is being too greedy and we
-                        // should continue and let the other dispatchers search for packets.
-                        if ((byteBufferSize - fromHeadIndex) > _packetMaxLength) { continue; }
-
-                        latestError = _copyToSkippedByteQueueIfEnabled(fromHeadIndex);
-                        if (latestError != Error::None && _asyncErrorQueuePush)
-                        {
-                            _asyncErrorQueuePush(AsyncError{latestError, errorCodeToString(latestError), now()});
-                        }
-                        _receivedByteCount += fromHeadIndex;
-                        _primaryByteBuffer.discard(fromHeadIndex);
-                        _prevByteBufferSize -= fromHeadIndex;
-                        _prevValidity = PacketDispatcher::FindPacketRetVal::Validity::Incomplete;
-                        _prevBytesRequested = retVal.length;
-                        return needMoreData;
+                        _asyncErrorQueuePush(AsyncError{latestError, errorCodeToString(latestError), now()});
                     }
-                    default:
+                    _receivedByteCount += (fromHeadIndex + numPacketBytesToDiscard);
+                    _primaryByteBuffer.discard(fromHeadIndex + numPacketBytesToDiscard);
+
+                    // We are returning so that we can pull data off the serial queue after each packet. This way we don't blow through the whole buffer
+                    // at a time while the serial queue overflows.
+                    _prevValidity = PacketDispatcher::FindPacketRetVal::Validity::Valid;
+                    _prevByteBufferSize -= fromHeadIndex + numPacketBytesToDiscard;
+                    return needMoreData;
+                }
+                case (PacketDispatcher::FindPacketRetVal::Validity::Invalid):
+                {
+                    // Keep searching, might have just been a random sync byte.
+                    ++currentDispatcher.numInvalidPackets;
+                    continue;
+                }
+                case (PacketDispatcher::FindPacketRetVal::Validity::Incomplete):
+                {
+                    // Let's trust that this is probably a packet of this type, so we'll wait for more data and start searching again.
+                    // We might as well discard all of the bytes so far, because clearly no one wanted it.
+                    VN_DEBUG_2("Found possible packet: " + std::to_string(currentDispatcher.syncBytes.front()) +
+                               " bytes available: " + std::to_string(_primaryByteBuffer.size()));
+
+                    // If dispatcher reports "incomplete" despite number of bytes exceeding global packet max length, then it is being too greedy and we
+                    // should continue and let the other dispatchers search for packets.
+                    if ((byteBufferSize - fromHeadIndex) > _packetMaxLength) { continue; }
+
+                    latestError = _copyToSkippedByteQueueIfEnabled(fromHeadIndex);
+                    if (latestError != Error::None && _asyncErrorQueuePush)
                     {
-                        // Should never happen.  Treat it as Invalid if it does.
-                        VN_DEBUG_1("Unknown packet validity.");
-                        ++currentDispatcher.numInvalidPackets;
-                        continue;
+                        _asyncErrorQueuePush(AsyncError{latestError, errorCodeToString(latestError), now()});
                     }
+                    _receivedByteCount += fromHeadIndex;
+                    _primaryByteBuffer.discard(fromHeadIndex);
+                    _prevByteBufferSize -= fromHeadIndex;
+                    _prevValidity = PacketDispatcher::FindPacketRetVal::Validity::Incomplete;
+                    _prevBytesRequested = retVal.length;
+                    return needMoreData;
+                }
+                default:
+                {
+                    // Should never happen.  Treat it as Invalid if it does.
+                    VN_DEBUG_1("Unknown packet validity.");
+                    ++currentDispatcher.numInvalidPackets;
+                    continue;
                 }
             }
         }
@@ -139,7 +145,7 @@ size_t PacketSynchronizer::getValidPacketCount(const SyncBytes& syncBytes) const
 {
     for (auto dispatcher : _dispatchers)
     {
-        if (syncBytes == dispatcher.syncBytes) { return dispatcher.numValidPackets; }
+        if (_startsWith(dispatcher.syncBytes, syncBytes)) { return dispatcher.numValidPackets; }
     }
     return 0;
 }
@@ -148,11 +154,44 @@ size_t PacketSynchronizer::getInvalidPacketCount(const SyncBytes& syncBytes) con
 {
     for (auto dispatcher : _dispatchers)
     {
-        if (syncBytes == dispatcher.syncBytes) { return dispatcher.numInvalidPackets; }
+        if (_startsWith(dispatcher.syncBytes, syncBytes)) { return dispatcher.numInvalidPackets; }
     }
     return 0;
 }
 
+size_t PacketSynchronizer::_findFirstSyncByte(size_t fromHeadIndex, const size_t byteBufferSize) const noexcept
+{
+    // Scans the linear segments of the buffer directly, rather than peeking each byte
+    while (fromHeadIndex < byteBufferSize)
+    {
+        const size_t segmentSize = std::min(byteBufferSize - fromHeadIndex, _primaryByteBuffer.numLinearBytesToPeek(fromHeadIndex));
+        const uint8_t* segment = _primaryByteBuffer.peek_ptr_unchecked(fromHeadIndex);
+        for (size_t i = 0; i < segmentSize; ++i)
+        {
+            if (_isFirstSyncByte[segment[i]]) { return fromHeadIndex + i; }
+        }
+        fromHeadIndex += segmentSize;
+    }
+    return byteBufferSize;
+}
+
+bool PacketSynchronizer::_matchesSyncBytes(const SyncBytes& syncBytes, const size_t fromHeadIndex, const size_t byteBufferSize) const noexcept
+{
+    if (syncBytes.front() != _primaryByteBuffer.peek_unchecked(fromHeadIndex)) { return false; }
+    // Sync bytes not yet received are assumed to match, so that findPacket reports the packet as incomplete.
+    const size_t numSyncBytesReceived = std::min(syncBytes.size(), byteBufferSize - fromHeadIndex);
+    for (size_t i = 1; i < numSyncBytesReceived; ++i)
+    {
+        if (syncBytes[i] != _primaryByteBuffer.peek_unchecked(fromHeadIndex + i)) { return false; }
+    }
+    return true;
+}
+
+bool PacketSynchronizer::_startsWith(const SyncBytes& syncBytes, const SyncBytes& prefix) noexcept
+{
+    return !prefix.empty() && prefix.size() <= syncBytes.size() && std::equal(prefix.begin(), prefix.end(), syncBytes.begin());
+}
+
 Error PacketSynchronizer::_copyToSkippedByteQueueIfEnabled(const size_t numBytesToCopy) const noexcept
 {
     if (numBytesToCopy == 0) { return Error::None; }
@@ -164,6 +203,12 @@ Error PacketSynchronizer::_copyToSkippedByteQueueIfEnabled(const size_t numBytes
         while (bytesRemaining > 0)
         {
             auto putSlot = _pSkippedByteQueue->put();
+            if (putSlot && putSlot->capacity == 0)
+            {
+                // Skipped bytes are always copied, so packets without storage of their own can't hold them
+                _pSkippedByteQueue->cancelPut(putSlot);
+                return Error::PacketQueueOverrun;
+            }
             if (putSlot)
             {
                 putSlot->details.syncByte = PacketDetails::SyncByte::None;
@@ -24,7 +24,13 @@
 
 #include "vectornav/Interface/Registers.hpp"
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <cstdio>
+#include <optional>
+#include <tuple>
+#include <type_traits>
 
 #include "vectornav/TemplateLibrary/String.hpp"
 
@@ -33,364 +39,482 @@ namespace VN
 namespace Registers
 {
 Vector<const char*, Config::PacketFinders::asciiMaxFieldCount> findIndexOfFieldSeparators(const AsciiMessage& input);
-namespace Attitude
+
+namespace
 {
-bool YawPitchRoll::fromString(const AsciiMessage& response)
+// Register payloads are described by constexpr tuples of field descriptors, in payload order. Each register only moves values between
+// its members and a WireValue array; tokenizing, number parsing and formatting happen in the one generic pair of functions below. A
+// plain pointer to an arithmetic member is sent as that type; enum and bitfield members name their wire type with decimal<>() or hex<>().
+
+enum class FieldFormat
 {
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 3 + 1) { return true; }
+    Decimal,
+    Hex
+};
 
-    int index = 0;
-    const char* start;
-    const char* end;
+enum class FieldKind : uint8_t
+{
+    Float,
+    Double,
+    UInt8,
+    UInt16,
+    UInt32,
+    Int32,
+    Hex8,
+    Hex16,
+    Hex32
+};
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto yaw_tmp = StringUtils::fromString<float>(start, end);
-    if (!yaw_tmp.has_value()) { return true; }
-    yaw = yaw_tmp.value();
+union WireValue
+{
+    float f;
+    double d;
+    uint32_t u;
+    int32_t i;
+};
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto pitch_tmp = StringUtils::fromString<float>(start, end);
-    if (!pitch_tmp.has_value()) { return true; }
-    pitch = pitch_tmp.value();
+template <typename Wire, FieldFormat Format, typename Member>
+struct FieldDescriptor
+{
+    using WireType = Wire;
+    Member member;
+};
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto roll_tmp = StringUtils::fromString<float>(start, end);
-    if (!roll_tmp.has_value()) { return true; }
-    roll = roll_tmp.value();
+template <typename Wire, typename Member>
+constexpr FieldDescriptor<Wire, FieldFormat::Decimal, Member> decimal(Member member) noexcept
+{
+    return {member};
+}
 
-    return false;  // no errors occurred
+template <typename Wire, typename Member>
+constexpr FieldDescriptor<Wire, FieldFormat::Hex, Member> hex(Member member) noexcept
+{
+    return {member};
 }
 
-bool Quaternion::fromString(const AsciiMessage& response)
+template <typename T>
+struct FieldValue
 {
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 4 + 1) { return true; }
+    using type = T;
+    static bool hasValue(const T&) noexcept { return true; }
+    static const T& get(const T& value) noexcept { return value; }
+};
 
-    int index = 0;
-    const char* start;
-    const char* end;
+template <typename T>
+struct FieldValue<std::optional<T>>
+{
+    using type = T;
+    static bool hasValue(const std::optional<T>& value) noexcept { return value.has_value(); }
+    static const T& get(const std::optional<T>& value) noexcept { return value.value(); }
+};
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto quatX_tmp = StringUtils::fromString<float>(start, end);
-    if (!quatX_tmp.has_value()) { return true; }
-    quatX = quatX_tmp.value();
+template <typename Reg, typename M>
+constexpr FieldDescriptor<typename FieldValue<M>::type, FieldFormat::Decimal, M Reg::*> toDescriptor(M Reg::*member) noexcept
+{
+    static_assert(std::is_arithmetic_v<typename FieldValue<M>::type>,
+                  "Enum and bitfield register fields must name their wire type with decimal<>() or hex<>().");
+    return {member};
+}
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto quatY_tmp = StringUtils::fromString<float>(start, end);
-    if (!quatY_tmp.has_value()) { return true; }
-    quatY = quatY_tmp.value();
+template <typename Wire, FieldFormat Format, typename Member>
+constexpr FieldDescriptor<Wire, Format, Member> toDescriptor(FieldDescriptor<Wire, Format, Member> descriptor) noexcept
+{
+    return descriptor;
+}
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto quatZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!quatZ_tmp.has_value()) { return true; }
-    quatZ = quatZ_tmp.value();
+template <typename Wire, FieldFormat Format>
+constexpr FieldKind fieldKind() noexcept
+{
+    if constexpr (Format == FieldFormat::Hex)
+    {
+        static_assert(std::is_same_v<Wire, uint8_t> || std::is_same_v<Wire, uint16_t> || std::is_same_v<Wire, uint32_t>);
+        return std::is_same_v<Wire, uint8_t> ? FieldKind::Hex8 : (std::is_same_v<Wire, uint16_t> ? FieldKind::Hex16 : FieldKind::Hex32);
+    }
+    else if constexpr (std::is_same_v<Wire, float>) { return FieldKind::Float; }
+    else if constexpr (std::is_same_v<Wire, double>) { return FieldKind::Double; }
+    else if constexpr (std::is_same_v<Wire, uint8_t>) { return FieldKind::UInt8; }
+    else if constexpr (std::is_same_v<Wire, uint16_t>) { return FieldKind::UInt16; }
+    else if constexpr (std::is_same_v<Wire, uint32_t>) { return FieldKind::UInt32; }
+    else
+    {
+        static_assert(std::is_same_v<Wire, int32_t>, "Unsupported register field wire type.");
+        return FieldKind::Int32;
+    }
+}
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto quatS_tmp = StringUtils::fromString<float>(start, end);
-    if (!quatS_tmp.has_value()) { return true; }
-    quatS = quatS_tmp.value();
+template <typename Wire, FieldFormat Format, typename Member>
+constexpr FieldKind fieldKind(FieldDescriptor<Wire, Format, Member>) noexcept
+{
+    return fieldKind<Wire, Format>();
+}
 
-    return false;  // no errors occurred
+template <typename Wire>
+Wire fromWire(const WireValue& value) noexcept
+{
+    if constexpr (std::is_same_v<Wire, float>) { return value.f; }
+    else if constexpr (std::is_same_v<Wire, double>) { return value.d; }
+    else if constexpr (std::is_signed_v<Wire>) { return static_cast<Wire>(value.i); }
+    else { return static_cast<Wire>(value.u); }
 }
 
-bool QuatMagAccelRate::fromString(const AsciiMessage& response)
+template <typename Wire>
+WireValue toWire(const Wire value) noexcept
 {
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 13 + 1) { return true; }
+    WireValue wire;
+    if constexpr (std::is_same_v<Wire, float>) { wire.f = value; }
+    else if constexpr (std::is_same_v<Wire, double>) { wire.d = value; }
+    else if constexpr (std::is_signed_v<Wire>) { wire.i = static_cast<int32_t>(value); }
+    else { wire.u = static_cast<uint32_t>(value); }
+    return wire;
+}
 
-    int index = 0;
-    const char* start;
-    const char* end;
+template <typename T, bool IsHex>
+Errored parseWireValue(const char* start, const char* end, T& value) noexcept
+{
+    std::optional<T> parsed;
+    if constexpr (IsHex) { parsed = StringUtils::fromStringHex<T>(start, end); }
+    else { parsed = StringUtils::fromString<T>(start, end); }
+    if (!parsed.has_value()) { return true; }
+    value = parsed.value();
+    return false;
+}
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto quatX_tmp = StringUtils::fromString<float>(start, end);
-    if (!quatX_tmp.has_value()) { return true; }
-    quatX = quatX_tmp.value();
+/// @brief Parses the comma separated fields of a register response into values. numParsed counts the fields parsed before the
+/// first failure, so callers can keep the earlier ones as the per-register parsers always have.
+Errored parseFieldValues(const AsciiMessage& response, const FieldKind* kinds, const size_t count, WireValue* values, size_t& numParsed) noexcept
+{
+    numParsed = 0;
+    const auto tokens = findIndexOfFieldSeparators(response);
+    if (tokens.size() != count + 1) { return true; }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto quatY_tmp = StringUtils::fromString<float>(start, end);
-    if (!quatY_tmp.has_value()) { return true; }
-    quatY = quatY_tmp.value();
+    for (; numParsed < count; ++numParsed)
+    {
+        const char* start = tokens[numParsed] + 1;
+        const char* end = tokens[numParsed + 1];
+        WireValue& value = values[numParsed];
+        Errored error = false;
+        switch (kinds[numParsed])
+        {
+            case FieldKind::Float:
+            {
+                error = parseWireValue<float, false>(start, end, value.f);
+                break;
+            }
+            case FieldKind::Double:
+            {
+                error = parseWireValue<double, false>(start, end, value.d);
+                break;
+            }
+            case FieldKind::UInt8:
+            {
+                uint8_t tmp = 0;
+                error = parseWireValue<uint8_t, false>(start, end, tmp);
+                value.u = tmp;
+                break;
+            }
+            case FieldKind::UInt16:
+            {
+                uint16_t tmp = 0;
+                error = parseWireValue<uint16_t, false>(start, end, tmp);
+                value.u = tmp;
+                break;
+            }
+            case FieldKind::UInt32:
+            {
+                error = parseWireValue<uint32_t, false>(start, end, value.u);
+                break;
+            }
+            case FieldKind::Int32:
+            {
+                error = parseWireValue<int32_t, false>(start, end, value.i);
+                break;
+            }
+            case FieldKind::Hex8:
+            {
+                uint8_t tmp = 0;
+                error = parseWireValue<uint8_t, true>(start, end, tmp);
+                value.u = tmp;
+                break;
+            }
+            case FieldKind::Hex16:
+            {
+                uint16_t tmp = 0;
+                error = parseWireValue<uint16_t, true>(start, end, tmp);
+                value.u = tmp;
+                break;
+            }
+            case FieldKind::Hex32:
+            {
+                error = parseWireValue<uint32_t, true>(start, end, value.u);
+                break;
+            }
+        }
+        if (error) { return true; }
+    }
+    return false;  // no errors occurred
+}
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto quatZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!quatZ_tmp.has_value()) { return true; }
-    quatZ = quatZ_tmp.value();
+/// @brief Formats values as the comma separated payload of a write register command.
+AsciiMessage formatFieldValues(const FieldKind* kinds, const size_t count, const WireValue* values) noexcept
+{
+    AsciiMessage result = "";
+    char* out = result.begin();
+    const char* outEnd = result.begin() + result.capacity();
+    for (size_t i = 0; i < count && outEnd - out > 1; ++i)
+    {
+        if (i != 0)
+        {
+            *out++ = ',';
+            *out = '\0';
+        }
+        const size_t remaining = static_cast<size_t>(outEnd - out);
+        int written = 0;
+        switch (kinds[i])
+        {
+            case FieldKind::Float:
+            {
+                written = std::snprintf(out, remaining, "%f", static_cast<double>(values[i].f));
+                break;
+            }
+            case FieldKind::Double:
+            {
+                written = std::snprintf(out, remaining, "%f", values[i].d);
+                break;
+            }
+            case FieldKind::Int32:
+            {
+                written = std::snprintf(out, remaining, "%d", static_cast<int>(values[i].i));
+                break;
+            }
+            case FieldKind::Hex8:
+                [[fallthrough]];
+            case FieldKind::Hex16:
+                [[fallthrough]];
+            case FieldKind::Hex32:
+            {
+                written = std::snprintf(out, remaining, "%X", static_cast<unsigned int>(values[i].u));
+                break;
+            }
+            default:
+            {
+                written = std::snprintf(out, remaining, "%u", static_cast<unsigned int>(values[i].u));
+                break;
+            }
+        }
+        if (written > 0) { out += std::min<ptrdiff_t>(written, outEnd - out - 1); }
+    }
+    return result;
+}
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto quatS_tmp = StringUtils::fromString<float>(start, end);
-    if (!quatS_tmp.has_value()) { return true; }
-    quatS = quatS_tmp.value();
+template <typename... Fields>
+constexpr std::array<FieldKind, sizeof...(Fields)> fieldKinds(const std::tuple<Fields...>& fields) noexcept
+{
+    return std::apply([](const auto&... field) { return std::array<FieldKind, sizeof...(Fields)>{fieldKind(toDescriptor(field))...}; }, fields);
+}
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magX_tmp = StringUtils::fromString<float>(start, end);
-    if (!magX_tmp.has_value()) { return true; }
-    magX = magX_tmp.value();
+template <typename Reg, typename... Fields>
+Errored parseFields(const AsciiMessage& response, Reg& reg, const std::tuple<Fields...>& fields) noexcept
+{
+    const std::array<FieldKind, sizeof...(Fields)> kinds = fieldKinds(fields);
+    std::array<WireValue, sizeof...(Fields)> values;
+    size_t numParsed = 0;
+    const Errored error = parseFieldValues(response, kinds.data(), kinds.size(), values.data(), numParsed);
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magY_tmp = StringUtils::fromString<float>(start, end);
-    if (!magY_tmp.has_value()) { return true; }
-    magY = magY_tmp.value();
+    size_t index = 0;
+    const auto storeNext = [&](const auto& field) noexcept
+    {
+        if (index >= numParsed) { return; }
+        const auto descriptor = toDescriptor(field);
+        using Member = std::decay_t<decltype(reg.*(descriptor.member))>;
+        using Wire = typename decltype(descriptor)::WireType;
+        reg.*(descriptor.member) = static_cast<typename FieldValue<Member>::type>(fromWire<Wire>(values[index++]));
+    };
+    std::apply([&](const auto&... field) { (storeNext(field), ...); }, fields);
+    return error;
+}
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!magZ_tmp.has_value()) { return true; }
-    magZ = magZ_tmp.value();
+template <typename Reg, typename... Fields>
+AsciiMessage formatFields(const Reg& reg, const std::tuple<Fields...>& fields) noexcept
+{
+    // verify that all fields have a value set
+    const auto hasValue = [&](const auto& field) noexcept
+    {
+        const auto descriptor = toDescriptor(field);
+        return FieldValue<std::decay_t<decltype(reg.*(descriptor.member))>>::hasValue(reg.*(descriptor.member));
+    };
+    if (!std::apply([&](const auto&... field) { return (hasValue(field) && ...); }, fields)) { return ""; }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto accelX_tmp = StringUtils::fromString<float>(start, end);
-    if (!accelX_tmp.has_value()) { return true; }
-    accelX = accelX_tmp.value();
+    const auto toWireValue = [&](const auto& field) noexcept
+    {
+        const auto descriptor = toDescriptor(field);
+        using Member = std::decay_t<decltype(reg.*(descriptor.member))>;
+        using Wire = typename decltype(descriptor)::WireType;
+        return toWire(static_cast<Wire>(FieldValue<Member>::get(reg.*(descriptor.member))));
+    };
+    const std::array<FieldKind, sizeof...(Fields)> kinds = fieldKinds(fields);
+    const std::array<WireValue, sizeof...(Fields)> values = std::apply([&](const auto&... field)
+                                                                       { return std::array<WireValue, sizeof...(Fields)>{toWireValue(field)...}; },
+                                                                       fields);
+    return formatFieldValues(kinds.data(), kinds.size(), values.data());
+}
+}  // namespace
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto accelY_tmp = StringUtils::fromString<float>(start, end);
-    if (!accelY_tmp.has_value()) { return true; }
-    accelY = accelY_tmp.value();
+namespace Attitude
+{
+constexpr auto yawPitchRollFields = std::make_tuple(&YawPitchRoll::yaw, &YawPitchRoll::pitch, &YawPitchRoll::roll);
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto accelZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!accelZ_tmp.has_value()) { return true; }
-    accelZ = accelZ_tmp.value();
+bool YawPitchRoll::fromString(const AsciiMessage& response) { return parseFields(response, *this, yawPitchRollFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroX_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroX_tmp.has_value()) { return true; }
-    gyroX = gyroX_tmp.value();
+constexpr auto quaternionFields = std::make_tuple(&Quaternion::quatX, &Quaternion::quatY, &Quaternion::quatZ, &Quaternion::quatS);
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroY_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroY_tmp.has_value()) { return true; }
-    gyroY = gyroY_tmp.value();
+bool Quaternion::fromString(const AsciiMessage& response) { return parseFields(response, *this, quaternionFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroZ_tmp.has_value()) { return true; }
-    gyroZ = gyroZ_tmp.value();
+constexpr auto quatMagAccelRateFields = std::make_tuple(&QuatMagAccelRate::quatX, &QuatMagAccelRate::quatY, &QuatMagAccelRate::quatZ,
+                                                        &QuatMagAccelRate::quatS, &QuatMagAccelRate::magX, &QuatMagAccelRate::magY,
+                                                        &QuatMagAccelRate::magZ, &QuatMagAccelRate::accelX, &QuatMagAccelRate::accelY,
+                                                        &QuatMagAccelRate::accelZ, &QuatMagAccelRate::gyroX, &QuatMagAccelRate::gyroY,
+                                                        &QuatMagAccelRate::gyroZ);
 
-    return false;  // no errors occurred
-}
+bool QuatMagAccelRate::fromString(const AsciiMessage& response) { return parseFields(response, *this, quatMagAccelRateFields); }
 
-bool MagGravRefVec::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 6 + 1) { return true; }
+constexpr auto magGravRefVecFields = std::make_tuple(&MagGravRefVec::magRefN, &MagGravRefVec::magRefE, &MagGravRefVec::magRefD,
+                                                     &MagGravRefVec::gravRefN, &MagGravRefVec::gravRefE, &MagGravRefVec::gravRefD);
 
-    int index = 0;
-    const char* start;
-    const char* end;
+bool MagGravRefVec::fromString(const AsciiMessage& response) { return parseFields(response, *this, magGravRefVecFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magRefN_tmp = StringUtils::fromString<float>(start, end);
-    if (!magRefN_tmp.has_value()) { return true; }
-    magRefN = magRefN_tmp.value();
+AsciiMessage MagGravRefVec::toString() const { return formatFields(*this, magGravRefVecFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magRefE_tmp = StringUtils::fromString<float>(start, end);
-    if (!magRefE_tmp.has_value()) { return true; }
-    magRefE = magRefE_tmp.value();
+constexpr auto yprMagAccelAngularRatesFields = std::make_tuple(&YprMagAccelAngularRates::yaw, &YprMagAccelAngularRates::pitch,
+                                                               &YprMagAccelAngularRates::roll, &YprMagAccelAngularRates::magX,
+                                                               &YprMagAccelAngularRates::magY, &YprMagAccelAngularRates::magZ,
+                                                               &YprMagAccelAngularRates::accelX, &YprMagAccelAngularRates::accelY,
+                                                               &YprMagAccelAngularRates::accelZ, &YprMagAccelAngularRates::gyroX,
+                                                               &YprMagAccelAngularRates::gyroY, &YprMagAccelAngularRates::gyroZ);
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magRefD_tmp = StringUtils::fromString<float>(start, end);
-    if (!magRefD_tmp.has_value()) { return true; }
-    magRefD = magRefD_tmp.value();
+bool YprMagAccelAngularRates::fromString(const AsciiMessage& response) { return parseFields(response, *this, yprMagAccelAngularRatesFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gravRefN_tmp = StringUtils::fromString<float>(start, end);
-    if (!gravRefN_tmp.has_value()) { return true; }
-    gravRefN = gravRefN_tmp.value();
+constexpr auto vpeBasicControlFields = std::make_tuple(&VpeBasicControl::resv, decimal<uint8_t>(&VpeBasicControl::headingMode),
+                                                       decimal<uint8_t>(&VpeBasicControl::filteringMode),
+                                                       decimal<uint8_t>(&VpeBasicControl::tuningMode));
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gravRefE_tmp = StringUtils::fromString<float>(start, end);
-    if (!gravRefE_tmp.has_value()) { return true; }
-    gravRefE = gravRefE_tmp.value();
+bool VpeBasicControl::fromString(const AsciiMessage& response) { return parseFields(response, *this, vpeBasicControlFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gravRefD_tmp = StringUtils::fromString<float>(start, end);
-    if (!gravRefD_tmp.has_value()) { return true; }
-    gravRefD = gravRefD_tmp.value();
+AsciiMessage VpeBasicControl::toString() const { return formatFields(*this, vpeBasicControlFields); }
 
-    return false;  // no errors occurred
-}
+constexpr auto vpeMagBasicTuningFields = std::make_tuple(&VpeMagBasicTuning::baseTuningX, &VpeMagBasicTuning::baseTuningY,
+                                                         &VpeMagBasicTuning::baseTuningZ, &VpeMagBasicTuning::adaptiveTuningX,
+                                                         &VpeMagBasicTuning::adaptiveTuningY, &VpeMagBasicTuning::adaptiveTuningZ,
+                                                         &VpeMagBasicTuning::adaptiveFilteringX, &VpeMagBasicTuning::adaptiveFilteringY,
+                                                         &VpeMagBasicTuning::adaptiveFilteringZ);
 
-AsciiMessage MagGravRefVec::toString() const
-{
-    AsciiMessage result = "";
+bool VpeMagBasicTuning::fromString(const AsciiMessage& response) { return parseFields(response, *this, vpeMagBasicTuningFields); }
 
-    // verify that all fields have a value set
-    if (magRefN.has_value() && magRefE.has_value() && magRefD.has_value() && gravRefN.has_value() && gravRefE.has_value() && gravRefD.has_value())
-    {
-        std::snprintf(result.begin(), result.capacity(), "%f,%f,%f,%f,%f,%f", magRefN.value(), magRefE.value(), magRefD.value(), gravRefN.value(),
-                      gravRefE.value(), gravRefD.value());
-    }
+AsciiMessage VpeMagBasicTuning::toString() const { return formatFields(*this, vpeMagBasicTuningFields); }
 
-    return result;
-}
+constexpr auto vpeAccelBasicTuningFields = std::make_tuple(&VpeAccelBasicTuning::baseTuningX, &VpeAccelBasicTuning::baseTuningY,
+                                                           &VpeAccelBasicTuning::baseTuningZ, &VpeAccelBasicTuning::adaptiveTuningX,
+                                                           &VpeAccelBasicTuning::adaptiveTuningY, &VpeAccelBasicTuning::adaptiveTuningZ,
+                                                           &VpeAccelBasicTuning::adaptiveFilteringX, &VpeAccelBasicTuning::adaptiveFilteringY,
+                                                           &VpeAccelBasicTuning::adaptiveFilteringZ);
 
-bool YprMagAccelAngularRates::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 12 + 1) { return true; }
+bool VpeAccelBasicTuning::fromString(const AsciiMessage& response) { return parseFields(response, *this, vpeAccelBasicTuningFields); }
 
-    int index = 0;
-    const char* start;
-    const char* end;
+AsciiMessage VpeAccelBasicTuning::toString() const { return formatFields(*this, vpeAccelBasicTuningFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto yaw_tmp = StringUtils::fromString<float>(start, end);
-    if (!yaw_tmp.has_value()) { return true; }
-    yaw = yaw_tmp.value();
+constexpr auto yprLinearBodyAccelAngularRatesFields = std::make_tuple(&YprLinearBodyAccelAngularRates::yaw, &YprLinearBodyAccelAngularRates::pitch,
+                                                                      &YprLinearBodyAccelAngularRates::roll,
+                                                                      &YprLinearBodyAccelAngularRates::linAccelX,
+                                                                      &YprLinearBodyAccelAngularRates::linAccelY,
+                                                                      &YprLinearBodyAccelAngularRates::linAccelZ,
+                                                                      &YprLinearBodyAccelAngularRates::gyroX, &YprLinearBodyAccelAngularRates::gyroY,
+                                                                      &YprLinearBodyAccelAngularRates::gyroZ);
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto pitch_tmp = StringUtils::fromString<float>(start, end);
-    if (!pitch_tmp.has_value()) { return true; }
-    pitch = pitch_tmp.value();
+bool YprLinearBodyAccelAngularRates::fromString(const AsciiMessage& response)
+{
+    return parseFields(response, *this, yprLinearBodyAccelAngularRatesFields);
+}
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto roll_tmp = StringUtils::fromString<float>(start, end);
-    if (!roll_tmp.has_value()) { return true; }
-    roll = roll_tmp.value();
+constexpr auto yprLinearInertialAccelAngularRatesFields = std::make_tuple(&YprLinearInertialAccelAngularRates::yaw,
+                                                                          &YprLinearInertialAccelAngularRates::pitch,
+                                                                          &YprLinearInertialAccelAngularRates::roll,
+                                                                          &YprLinearInertialAccelAngularRates::linAccelN,
+                                                                          &YprLinearInertialAccelAngularRates::linAccelE,
+                                                                          &YprLinearInertialAccelAngularRates::linAccelD,
+                                                                          &YprLinearInertialAccelAngularRates::gyroX,
+                                                                          &YprLinearInertialAccelAngularRates::gyroY,
+                                                                          &YprLinearInertialAccelAngularRates::gyroZ);
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magX_tmp = StringUtils::fromString<float>(start, end);
-    if (!magX_tmp.has_value()) { return true; }
-    magX = magX_tmp.value();
+bool YprLinearInertialAccelAngularRates::fromString(const AsciiMessage& response)
+{
+    return parseFields(response, *this, yprLinearInertialAccelAngularRatesFields);
+}
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magY_tmp = StringUtils::fromString<float>(start, end);
-    if (!magY_tmp.has_value()) { return true; }
-    magY = magY_tmp.value();
+}  // namespace Attitude
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!magZ_tmp.has_value()) { return true; }
-    magZ = magZ_tmp.value();
+namespace GNSS
+{
+constexpr auto gnssBasicConfigFields = std::make_tuple(decimal<uint8_t>(&GnssBasicConfig::receiverEnable),
+                                                       decimal<uint8_t>(&GnssBasicConfig::ppsSource), decimal<uint8_t>(&GnssBasicConfig::rate),
+                                                       &GnssBasicConfig::resv4, decimal<uint8_t>(&GnssBasicConfig::antPower));
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto accelX_tmp = StringUtils::fromString<float>(start, end);
-    if (!accelX_tmp.has_value()) { return true; }
-    accelX = accelX_tmp.value();
+bool GnssBasicConfig::fromString(const AsciiMessage& response) { return parseFields(response, *this, gnssBasicConfigFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto accelY_tmp = StringUtils::fromString<float>(start, end);
-    if (!accelY_tmp.has_value()) { return true; }
-    accelY = accelY_tmp.value();
+AsciiMessage GnssBasicConfig::toString() const { return formatFields(*this, gnssBasicConfigFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto accelZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!accelZ_tmp.has_value()) { return true; }
-    accelZ = accelZ_tmp.value();
+constexpr auto gnssAOffsetFields = std::make_tuple(&GnssAOffset::positionX, &GnssAOffset::positionY, &GnssAOffset::positionZ);
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroX_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroX_tmp.has_value()) { return true; }
-    gyroX = gyroX_tmp.value();
+bool GnssAOffset::fromString(const AsciiMessage& response) { return parseFields(response, *this, gnssAOffsetFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroY_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroY_tmp.has_value()) { return true; }
-    gyroY = gyroY_tmp.value();
+AsciiMessage GnssAOffset::toString() const { return formatFields(*this, gnssAOffsetFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroZ_tmp.has_value()) { return true; }
-    gyroZ = gyroZ_tmp.value();
+constexpr auto gnssSolLlaFields = std::make_tuple(&GnssSolLla::gps1Tow, &GnssSolLla::gps1Week, decimal<uint8_t>(&GnssSolLla::gnss1Fix),
+                                                  &GnssSolLla::gnss1NumSats, &GnssSolLla::gnss1Lat, &GnssSolLla::gnss1Lon, &GnssSolLla::gnss1Alt,
+                                                  &GnssSolLla::gnss1VelN, &GnssSolLla::gnss1VelE, &GnssSolLla::gnss1VelD,
+                                                  &GnssSolLla::gnss1PosUncertaintyN, &GnssSolLla::gnss1PosUncertaintyE,
+                                                  &GnssSolLla::gnss1PosUncertaintyD, &GnssSolLla::gnss1VelUncertainty,
+                                                  &GnssSolLla::gnss1TimeUncertainty);
 
-    return false;  // no errors occurred
-}
+bool GnssSolLla::fromString(const AsciiMessage& response) { return parseFields(response, *this, gnssSolLlaFields); }
 
-bool VpeBasicControl::fromString(const AsciiMessage& response)
+AsciiMessage GnssSolLla::toString() const
 {
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 4 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto resv_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!resv_tmp.has_value()) { return true; }
-    resv = resv_tmp.value();
+    AsciiMessage result = "";
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto headingMode_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!headingMode_tmp.has_value()) { return true; }
-    headingMode = static_cast<VpeBasicControl::HeadingMode>(headingMode_tmp.value());
+    std::snprintf(result.begin(), result.capacity(), "%.6f,%u,%u,%u,%.8f,%.8f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%g", gps1Tow, gps1Week,
+                  static_cast<uint8_t>(gnss1Fix), gnss1NumSats, gnss1Lat, gnss1Lon, gnss1Alt, gnss1VelN, gnss1VelE, gnss1VelD, gnss1PosUncertaintyN,
+                  gnss1PosUncertaintyE, gnss1PosUncertaintyD, gnss1VelUncertainty, gnss1TimeUncertainty);
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto filteringMode_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!filteringMode_tmp.has_value()) { return true; }
-    filteringMode = static_cast<VpeBasicControl::FilteringMode>(filteringMode_tmp.value());
+    return result;
+}
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto tuningMode_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!tuningMode_tmp.has_value()) { return true; }
-    tuningMode = static_cast<VpeBasicControl::TuningMode>(tuningMode_tmp.value());
+constexpr auto gnssSolEcefFields = std::make_tuple(&GnssSolEcef::gps1Tow, &GnssSolEcef::gps1Week, decimal<uint8_t>(&GnssSolEcef::gnss1Fix),
+                                                   &GnssSolEcef::gnss1NumSats, &GnssSolEcef::gnss1PosX, &GnssSolEcef::gnss1PosY,
+                                                   &GnssSolEcef::gnss1PosZ, &GnssSolEcef::gnss1VelX, &GnssSolEcef::gnss1VelY, &GnssSolEcef::gnss1VelZ,
+                                                   &GnssSolEcef::gnss1PosUncertaintyX, &GnssSolEcef::gnss1PosUncertaintyY,
+                                                   &GnssSolEcef::gnss1PosUncertaintyZ, &GnssSolEcef::gnss1VelUncertainty,
+                                                   &GnssSolEcef::gnss1TimeUncertainty);
 
-    return false;  // no errors occurred
-}
+bool GnssSolEcef::fromString(const AsciiMessage& response) { return parseFields(response, *this, gnssSolEcefFields); }
 
-AsciiMessage VpeBasicControl::toString() const
+AsciiMessage GnssSolEcef::toString() const
 {
     AsciiMessage result = "";
 
-    // verify that all fields have a value set
-    if (resv.has_value() && headingMode.has_value() && filteringMode.has_value() && tuningMode.has_value())
-    {
-        std::snprintf(result.begin(), result.capacity(), "%u,%u,%u,%u", resv.value(), static_cast<uint8_t>(headingMode.value()),
-                      static_cast<uint8_t>(filteringMode.value()), static_cast<uint8_t>(tuningMode.value()));
-    }
+    std::snprintf(result.begin(), result.capacity(), "%.6f,%u,%u,%u,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%g", gps1Tow, gps1Week,
+                  static_cast<uint8_t>(gnss1Fix), gnss1NumSats, gnss1PosX, gnss1PosY, gnss1PosZ, gnss1VelX, gnss1VelY, gnss1VelZ, gnss1PosUncertaintyX,
+                  gnss1PosUncertaintyY, gnss1PosUncertaintyZ, gnss1VelUncertainty, gnss1TimeUncertainty);
 
     return result;
 }
 
-bool VpeMagBasicTuning::fromString(const AsciiMessage& response)
+bool GnssSystemConfig::fromString(const AsciiMessage& response)
 {
     const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 9 + 1) { return true; }
+    if (tokens.size() != 9 + 1)
+    {
+        // This register may not have an optional field
+        if (tokens.size() != 8 + 1) { return true; }
+    }
 
     int index = 0;
     const char* start;
@@ -398,2972 +522,353 @@ bool VpeMagBasicTuning::fromString(const AsciiMessage& response)
 
     start = tokens[index++] + 1;
     end = tokens[index];
-    const auto baseTuningX_tmp = StringUtils::fromString<float>(start, end);
-    if (!baseTuningX_tmp.has_value()) { return true; }
-    baseTuningX = baseTuningX_tmp.value();
+    const auto systems_tmp = StringUtils::fromStringHex<uint16_t>(start, end);
+    if (!systems_tmp.has_value()) { return true; }
+    systems = systems_tmp.value();
 
     start = tokens[index++] + 1;
     end = tokens[index];
-    const auto baseTuningY_tmp = StringUtils::fromString<float>(start, end);
-    if (!baseTuningY_tmp.has_value()) { return true; }
-    baseTuningY = baseTuningY_tmp.value();
+    const auto minCno_tmp = StringUtils::fromString<uint8_t>(start, end);
+    if (!minCno_tmp.has_value()) { return true; }
+    minCno = minCno_tmp.value();
 
     start = tokens[index++] + 1;
     end = tokens[index];
-    const auto baseTuningZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!baseTuningZ_tmp.has_value()) { return true; }
-    baseTuningZ = baseTuningZ_tmp.value();
+    const auto minElev_tmp = StringUtils::fromString<uint8_t>(start, end);
+    if (!minElev_tmp.has_value()) { return true; }
+    minElev = minElev_tmp.value();
 
     start = tokens[index++] + 1;
     end = tokens[index];
-    const auto adaptiveTuningX_tmp = StringUtils::fromString<float>(start, end);
-    if (!adaptiveTuningX_tmp.has_value()) { return true; }
-    adaptiveTuningX = adaptiveTuningX_tmp.value();
+    const auto maxSats_tmp = StringUtils::fromString<uint8_t>(start, end);
+    if (!maxSats_tmp.has_value()) { return true; }
+    maxSats = maxSats_tmp.value();
 
     start = tokens[index++] + 1;
     end = tokens[index];
-    const auto adaptiveTuningY_tmp = StringUtils::fromString<float>(start, end);
-    if (!adaptiveTuningY_tmp.has_value()) { return true; }
-    adaptiveTuningY = adaptiveTuningY_tmp.value();
+    const auto sbasMode_tmp = StringUtils::fromStringHex<uint8_t>(start, end);
+    if (!sbasMode_tmp.has_value()) { return true; }
+    sbasMode = sbasMode_tmp.value();
 
     start = tokens[index++] + 1;
     end = tokens[index];
-    const auto adaptiveTuningZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!adaptiveTuningZ_tmp.has_value()) { return true; }
-    adaptiveTuningZ = adaptiveTuningZ_tmp.value();
+    const auto sbasSelect1_tmp = StringUtils::fromStringHex<uint16_t>(start, end);
+    if (!sbasSelect1_tmp.has_value()) { return true; }
+    sbasSelect1 = sbasSelect1_tmp.value();
 
     start = tokens[index++] + 1;
     end = tokens[index];
-    const auto adaptiveFilteringX_tmp = StringUtils::fromString<float>(start, end);
-    if (!adaptiveFilteringX_tmp.has_value()) { return true; }
-    adaptiveFilteringX = adaptiveFilteringX_tmp.value();
+    const auto sbasSelect2_tmp = StringUtils::fromStringHex<uint16_t>(start, end);
+    if (!sbasSelect2_tmp.has_value()) { return true; }
+    sbasSelect2 = sbasSelect2_tmp.value();
 
     start = tokens[index++] + 1;
     end = tokens[index];
-    const auto adaptiveFilteringY_tmp = StringUtils::fromString<float>(start, end);
-    if (!adaptiveFilteringY_tmp.has_value()) { return true; }
-    adaptiveFilteringY = adaptiveFilteringY_tmp.value();
+    const auto sbasSelect3_tmp = StringUtils::fromStringHex<uint16_t>(start, end);
+    if (!sbasSelect3_tmp.has_value()) { return true; }
+    sbasSelect3 = sbasSelect3_tmp.value();
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto adaptiveFilteringZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!adaptiveFilteringZ_tmp.has_value()) { return true; }
-    adaptiveFilteringZ = adaptiveFilteringZ_tmp.value();
+    if (tokens.size() == (9 + 1))
+    {
+        // This is an optional parameter.
+        start = tokens[index++] + 1;
+        end = tokens[index];
+        const auto receiverSelect_tmp = StringUtils::fromString<uint8_t>(start, end);
+        if (!receiverSelect_tmp.has_value()) { return true; }
+        receiverSelect = static_cast<GnssSystemConfig::ReceiverSelect>(receiverSelect_tmp.value());
+    }
 
     return false;  // no errors occurred
 }
 
-AsciiMessage VpeMagBasicTuning::toString() const
+GenericCommand GnssSystemConfig::toReadCommand()
 {
-    AsciiMessage result = "";
+    AsciiMessage commandString;
+    if (receiverSelect == GNSS::GnssSystemConfig::ReceiverSelect::GnssAB) { std::snprintf(commandString.begin(), commandString.capacity(), "RRG,%02d", _id); }
+    else { std::snprintf(commandString.begin(), commandString.capacity(), "RRG,%02d,%1d", _id, static_cast<uint8_t>(receiverSelect)); }
+    GenericCommand readCommand(commandString, 6);
+    return readCommand;
+}
 
-    // verify that all fields have a value set
-    if (baseTuningX.has_value() && baseTuningY.has_value() && baseTuningZ.has_value() && adaptiveTuningX.has_value() && adaptiveTuningY.has_value() &&
-        adaptiveTuningZ.has_value() && adaptiveFilteringX.has_value() && adaptiveFilteringY.has_value() && adaptiveFilteringZ.has_value())
-    {
-        std::snprintf(result.begin(), result.capacity(), "%f,%f,%f,%f,%f,%f,%f,%f,%f", baseTuningX.value(), baseTuningY.value(), baseTuningZ.value(),
-                      adaptiveTuningX.value(), adaptiveTuningY.value(), adaptiveTuningZ.value(), adaptiveFilteringX.value(), adaptiveFilteringY.value(),
-                      adaptiveFilteringZ.value());
-    }
-
-    return result;
-}
-
-bool VpeAccelBasicTuning::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 9 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto baseTuningX_tmp = StringUtils::fromString<float>(start, end);
-    if (!baseTuningX_tmp.has_value()) { return true; }
-    baseTuningX = baseTuningX_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto baseTuningY_tmp = StringUtils::fromString<float>(start, end);
-    if (!baseTuningY_tmp.has_value()) { return true; }
-    baseTuningY = baseTuningY_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto baseTuningZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!baseTuningZ_tmp.has_value()) { return true; }
-    baseTuningZ = baseTuningZ_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto adaptiveTuningX_tmp = StringUtils::fromString<float>(start, end);
-    if (!adaptiveTuningX_tmp.has_value()) { return true; }
-    adaptiveTuningX = adaptiveTuningX_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto adaptiveTuningY_tmp = StringUtils::fromString<float>(start, end);
-    if (!adaptiveTuningY_tmp.has_value()) { return true; }
-    adaptiveTuningY = adaptiveTuningY_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto adaptiveTuningZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!adaptiveTuningZ_tmp.has_value()) { return true; }
-    adaptiveTuningZ = adaptiveTuningZ_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto adaptiveFilteringX_tmp = StringUtils::fromString<float>(start, end);
-    if (!adaptiveFilteringX_tmp.has_value()) { return true; }
-    adaptiveFilteringX = adaptiveFilteringX_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto adaptiveFilteringY_tmp = StringUtils::fromString<float>(start, end);
-    if (!adaptiveFilteringY_tmp.has_value()) { return true; }
-    adaptiveFilteringY = adaptiveFilteringY_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto adaptiveFilteringZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!adaptiveFilteringZ_tmp.has_value()) { return true; }
-    adaptiveFilteringZ = adaptiveFilteringZ_tmp.value();
-
-    return false;  // no errors occurred
-}
-
-AsciiMessage VpeAccelBasicTuning::toString() const
-{
-    AsciiMessage result = "";
-
-    // verify that all fields have a value set
-    if (baseTuningX.has_value() && baseTuningY.has_value() && baseTuningZ.has_value() && adaptiveTuningX.has_value() && adaptiveTuningY.has_value() &&
-        adaptiveTuningZ.has_value() && adaptiveFilteringX.has_value() && adaptiveFilteringY.has_value() && adaptiveFilteringZ.has_value())
-    {
-        std::snprintf(result.begin(), result.capacity(), "%f,%f,%f,%f,%f,%f,%f,%f,%f", baseTuningX.value(), baseTuningY.value(), baseTuningZ.value(),
-                      adaptiveTuningX.value(), adaptiveTuningY.value(), adaptiveTuningZ.value(), adaptiveFilteringX.value(), adaptiveFilteringY.value(),
-                      adaptiveFilteringZ.value());
-    }
-
-    return result;
-}
-
-bool YprLinearBodyAccelAngularRates::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 9 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto yaw_tmp = StringUtils::fromString<float>(start, end);
-    if (!yaw_tmp.has_value()) { return true; }
-    yaw = yaw_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto pitch_tmp = StringUtils::fromString<float>(start, end);
-    if (!pitch_tmp.has_value()) { return true; }
-    pitch = pitch_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto roll_tmp = StringUtils::fromString<float>(start, end);
-    if (!roll_tmp.has_value()) { return true; }
-    roll = roll_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto linAccelX_tmp = StringUtils::fromString<float>(start, end);
-    if (!linAccelX_tmp.has_value()) { return true; }
-    linAccelX = linAccelX_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto linAccelY_tmp = StringUtils::fromString<float>(start, end);
-    if (!linAccelY_tmp.has_value()) { return true; }
-    linAccelY = linAccelY_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto linAccelZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!linAccelZ_tmp.has_value()) { return true; }
-    linAccelZ = linAccelZ_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroX_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroX_tmp.has_value()) { return true; }
-    gyroX = gyroX_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroY_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroY_tmp.has_value()) { return true; }
-    gyroY = gyroY_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroZ_tmp.has_value()) { return true; }
-    gyroZ = gyroZ_tmp.value();
-
-    return false;  // no errors occurred
-}
-
-bool YprLinearInertialAccelAngularRates::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 9 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto yaw_tmp = StringUtils::fromString<float>(start, end);
-    if (!yaw_tmp.has_value()) { return true; }
-    yaw = yaw_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto pitch_tmp = StringUtils::fromString<float>(start, end);
-    if (!pitch_tmp.has_value()) { return true; }
-    pitch = pitch_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto roll_tmp = StringUtils::fromString<float>(start, end);
-    if (!roll_tmp.has_value()) { return true; }
-    roll = roll_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto linAccelN_tmp = StringUtils::fromString<float>(start, end);
-    if (!linAccelN_tmp.has_value()) { return true; }
-    linAccelN = linAccelN_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto linAccelE_tmp = StringUtils::fromString<float>(start, end);
-    if (!linAccelE_tmp.has_value()) { return true; }
-    linAccelE = linAccelE_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto linAccelD_tmp = StringUtils::fromString<float>(start, end);
-    if (!linAccelD_tmp.has_value()) { return true; }
-    linAccelD = linAccelD_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroX_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroX_tmp.has_value()) { return true; }
-    gyroX = gyroX_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroY_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroY_tmp.has_value()) { return true; }
-    gyroY = gyroY_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroZ_tmp.has_value()) { return true; }
-    gyroZ = gyroZ_tmp.value();
-
-    return false;  // no errors occurred
-}
-
-}  // namespace Attitude
-
-namespace GNSS
-{
-bool GnssBasicConfig::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 5 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto receiverEnable_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!receiverEnable_tmp.has_value()) { return true; }
-    receiverEnable = static_cast<GnssBasicConfig::ReceiverEnable>(receiverEnable_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto ppsSource_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!ppsSource_tmp.has_value()) { return true; }
-    ppsSource = static_cast<GnssBasicConfig::PpsSource>(ppsSource_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto rate_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!rate_tmp.has_value()) { return true; }
-    rate = static_cast<GnssBasicConfig::Rate>(rate_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto resv4_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!resv4_tmp.has_value()) { return true; }
-    resv4 = resv4_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto antPower_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!antPower_tmp.has_value()) { return true; }
-    antPower = static_cast<GnssBasicConfig::AntPower>(antPower_tmp.value());
-
-    return false;  // no errors occurred
-}
-
-AsciiMessage GnssBasicConfig::toString() const
-{
-    AsciiMessage result = "";
-
-    // verify that all fields have a value set
-    if (receiverEnable.has_value() && ppsSource.has_value() && rate.has_value() && resv4.has_value() && antPower.has_value())
-    {
-        std::snprintf(result.begin(), result.capacity(), "%u,%u,%u,%u,%u", static_cast<uint8_t>(receiverEnable.value()),
-                      static_cast<uint8_t>(ppsSource.value()), static_cast<uint8_t>(rate.value()), resv4.value(), static_cast<uint8_t>(antPower.value()));
-    }
-
-    return result;
-}
-
-bool GnssAOffset::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 3 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto positionX_tmp = StringUtils::fromString<float>(start, end);
-    if (!positionX_tmp.has_value()) { return true; }
-    positionX = positionX_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto positionY_tmp = StringUtils::fromString<float>(start, end);
-    if (!positionY_tmp.has_value()) { return true; }
-    positionY = positionY_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto positionZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!positionZ_tmp.has_value()) { return true; }
-    positionZ = positionZ_tmp.value();
-
-    return false;  // no errors occurred
-}
-
-AsciiMessage GnssAOffset::toString() const
-{
-    AsciiMessage result = "";
-
-    // verify that all fields have a value set
-    if (positionX.has_value() && positionY.has_value() && positionZ.has_value())
-    {
-        std::snprintf(result.begin(), result.capacity(), "%f,%f,%f", positionX.value(), positionY.value(), positionZ.value());
-    }
-
-    return result;
-}
-
-bool GnssSolLla::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 15 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gps1Tow_tmp = StringUtils::fromString<double>(start, end);
-    if (!gps1Tow_tmp.has_value()) { return true; }
-    gps1Tow = gps1Tow_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gps1Week_tmp = StringUtils::fromString<uint16_t>(start, end);
-    if (!gps1Week_tmp.has_value()) { return true; }
-    gps1Week = gps1Week_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss1Fix_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!gnss1Fix_tmp.has_value()) { return true; }
-    gnss1Fix = static_cast<GnssSolLla::Gnss1Fix>(gnss1Fix_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss1NumSats_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!gnss1NumSats_tmp.has_value()) { return true; }
-    gnss1NumSats = gnss1NumSats_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss1Lat_tmp = StringUtils::fromString<double>(start, end);
-    if (!gnss1Lat_tmp.has_value()) { return true; }
-    gnss1Lat = gnss1Lat_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss1Lon_tmp = StringUtils::fromString<double>(start, end);
-    if (!gnss1Lon_tmp.has_value()) { return true; }
-    gnss1Lon = gnss1Lon_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss1Alt_tmp = StringUtils::fromString<double>(start, end);
-    if (!gnss1Alt_tmp.has_value()) { return true; }
-    gnss1Alt = gnss1Alt_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss1VelN_tmp = StringUtils::fromString<float>(start, end);
-    if (!gnss1VelN_tmp.has_value()) { return true; }
-    gnss1VelN = gnss1VelN_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss1VelE_tmp = StringUtils::fromString<float>(start, end);
-    if (!gnss1VelE_tmp.has_value()) { return true; }
-    gnss1VelE = gnss1VelE_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss1VelD_tmp = StringUtils::fromString<float>(start, end);
-    if (!gnss1VelD_tmp.has_value()) { return true; }
-    gnss1VelD = gnss1VelD_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss1PosUncertaintyN_tmp = StringUtils::fromString<float>(start, end);
-    if (!gnss1PosUncertaintyN_tmp.has_value()) { return true; }
-    gnss1PosUncertaintyN = gnss1PosUncertaintyN_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss1PosUncertaintyE_tmp = StringUtils::fromString<float>(start, end);
-    if (!gnss1PosUncertaintyE_tmp.has_value()) { return true; }
-    gnss1PosUncertaintyE = gnss1PosUncertaintyE_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss1PosUncertaintyD_tmp = StringUtils::fromString<float>(start, end);
-    if (!gnss1PosUncertaintyD_tmp.has_value()) { return true; }
-    gnss1PosUncertaintyD = gnss1PosUncertaintyD_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss1VelUncertainty_tmp = StringUtils::fromString<float>(start, end);
-    if (!gnss1VelUncertainty_tmp.has_value()) { return true; }
-    gnss1VelUncertainty = gnss1VelUncertainty_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss1TimeUncertainty_tmp = StringUtils::fromString<float>(start, end);
-    if (!gnss1TimeUncertainty_tmp.has_value()) { return true; }
-    gnss1TimeUncertainty = gnss1TimeUncertainty_tmp.value();
-
-    return false;  // no errors occurred
-}
-
-AsciiMessage GnssSolLla::toString() const
-{
-    AsciiMessage result = "";
-
-    std::snprintf(result.begin(), result.capacity(), "%.6f,%u,%u,%u,%.8f,%.8f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%g", gps1Tow, gps1Week,
-                  static_cast<uint8_t>(gnss1Fix), gnss1NumSats, gnss1Lat, gnss1Lon, gnss1Alt, gnss1VelN, gnss1VelE, gnss1VelD, gnss1PosUncertaintyN,
-                  gnss1PosUncertaintyE, gnss1PosUncertaintyD, gnss1VelUncertainty, gnss1TimeUncertainty);
-
-    return result;
-}
-
-bool GnssSolEcef::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 15 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gps1Tow_tmp = StringUtils::fromString<double>(start, end);
-    if (!gps1Tow_tmp.has_value()) { return true; }
-    gps1Tow = gps1Tow_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gps1Week_tmp = StringUtils::fromString<uint16_t>(start, end);
-    if (!gps1Week_tmp.has_value()) { return true; }
-    gps1Week = gps1Week_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss1Fix_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!gnss1Fix_tmp.has_value()) { return true; }
-    gnss1Fix = static_cast<GnssSolEcef::Gnss1Fix>(gnss1Fix_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss1NumSats_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!gnss1NumSats_tmp.has_value()) { return true; }
-    gnss1NumSats = gnss1NumSats_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss1PosX_tmp = StringUtils::fromString<double>(start, end);
-    if (!gnss1PosX_tmp.has_value()) { return true; }
-    gnss1PosX = gnss1PosX_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss1PosY_tmp = StringUtils::fromString<double>(start, end);
-    if (!gnss1PosY_tmp.has_value()) { return true; }
-    gnss1PosY = gnss1PosY_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss1PosZ_tmp = StringUtils::fromString<double>(start, end);
-    if (!gnss1PosZ_tmp.has_value()) { return true; }
-    gnss1PosZ = gnss1PosZ_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss1VelX_tmp = StringUtils::fromString<float>(start, end);
-    if (!gnss1VelX_tmp.has_value()) { return true; }
-    gnss1VelX = gnss1VelX_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss1VelY_tmp = StringUtils::fromString<float>(start, end);
-    if (!gnss1VelY_tmp.has_value()) { return true; }
-    gnss1VelY = gnss1VelY_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss1VelZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!gnss1VelZ_tmp.has_value()) { return true; }
-    gnss1VelZ = gnss1VelZ_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss1PosUncertaintyX_tmp = StringUtils::fromString<float>(start, end);
-    if (!gnss1PosUncertaintyX_tmp.has_value()) { return true; }
-    gnss1PosUncertaintyX = gnss1PosUncertaintyX_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss1PosUncertaintyY_tmp = StringUtils::fromString<float>(start, end);
-    if (!gnss1PosUncertaintyY_tmp.has_value()) { return true; }
-    gnss1PosUncertaintyY = gnss1PosUncertaintyY_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss1PosUncertaintyZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!gnss1PosUncertaintyZ_tmp.has_value()) { return true; }
-    gnss1PosUncertaintyZ = gnss1PosUncertaintyZ_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss1VelUncertainty_tmp = StringUtils::fromString<float>(start, end);
-    if (!gnss1VelUncertainty_tmp.has_value()) { return true; }
-    gnss1VelUncertainty = gnss1VelUncertainty_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss1TimeUncertainty_tmp = StringUtils::fromString<float>(start, end);
-    if (!gnss1TimeUncertainty_tmp.has_value()) { return true; }
-    gnss1TimeUncertainty = gnss1TimeUncertainty_tmp.value();
-
-    return false;  // no errors occurred
-}
-
-AsciiMessage GnssSolEcef::toString() const
-{
-    AsciiMessage result = "";
-
-    std::snprintf(result.begin(), result.capacity(), "%.6f,%u,%u,%u,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%g", gps1Tow, gps1Week,
-                  static_cast<uint8_t>(gnss1Fix), gnss1NumSats, gnss1PosX, gnss1PosY, gnss1PosZ, gnss1VelX, gnss1VelY, gnss1VelZ, gnss1PosUncertaintyX,
-                  gnss1PosUncertaintyY, gnss1PosUncertaintyZ, gnss1VelUncertainty, gnss1TimeUncertainty);
-
-    return result;
-}
-
-bool GnssSystemConfig::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 9 + 1)
-    {
-        // This register may not have an optional field
-        if (tokens.size() != 8 + 1) { return true; }
-    }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto systems_tmp = StringUtils::fromStringHex<uint16_t>(start, end);
-    if (!systems_tmp.has_value()) { return true; }
-    systems = systems_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto minCno_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!minCno_tmp.has_value()) { return true; }
-    minCno = minCno_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto minElev_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!minElev_tmp.has_value()) { return true; }
-    minElev = minElev_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto maxSats_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!maxSats_tmp.has_value()) { return true; }
-    maxSats = maxSats_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto sbasMode_tmp = StringUtils::fromStringHex<uint8_t>(start, end);
-    if (!sbasMode_tmp.has_value()) { return true; }
-    sbasMode = sbasMode_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto sbasSelect1_tmp = StringUtils::fromStringHex<uint16_t>(start, end);
-    if (!sbasSelect1_tmp.has_value()) { return true; }
-    sbasSelect1 = sbasSelect1_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto sbasSelect2_tmp = StringUtils::fromStringHex<uint16_t>(start, end);
-    if (!sbasSelect2_tmp.has_value()) { return true; }
-    sbasSelect2 = sbasSelect2_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto sbasSelect3_tmp = StringUtils::fromStringHex<uint16_t>(start, end);
-    if (!sbasSelect3_tmp.has_value()) { return true; }
-    sbasSelect3 = sbasSelect3_tmp.value();
-
-    if (tokens.size() == (9 + 1))
-    {
-        // This is an optional parameter.
-        start = tokens[index++] + 1;
-        end = tokens[index];
-        const auto receiverSelect_tmp = StringUtils::fromString<uint8_t>(start, end);
-        if (!receiverSelect_tmp.has_value()) { return true; }
-        receiverSelect = static_cast<GnssSystemConfig::ReceiverSelect>(receiverSelect_tmp.value());
-    }
-
-    return false;  // no errors occurred
-}
-
-GenericCommand GnssSystemConfig::toReadCommand()
-{
-    AsciiMessage commandString;
-    if (receiverSelect == GNSS::GnssSystemConfig::ReceiverSelect::GnssAB) { std::snprintf(commandString.begin(), commandString.capacity(), "RRG,%02d", _id); }
-    else { std::snprintf(commandString.begin(), commandString.capacity(), "RRG,%02d,%1d", _id, static_cast<uint8_t>(receiverSelect)); }
-    GenericCommand readCommand(commandString, 6);
-    return readCommand;
-}
-
-AsciiMessage GnssSystemConfig::toString() const
-{
-    AsciiMessage result = "";
-
-    // verify that all fields have a value set
-    if (systems.has_value() && minCno.has_value() && minElev.has_value() && maxSats.has_value() && sbasMode.has_value() && sbasSelect1.has_value() &&
-        sbasSelect2.has_value() && sbasSelect3.has_value())
-    {
-        if (receiverSelect == GNSS::GnssSystemConfig::ReceiverSelect::GnssAB)
-        {
-            std::snprintf(result.begin(), result.capacity(), "%04X,%d,%d,%d,%02X,%04X,%04X,%04X", uint16_t(systems.value()), minCno.value(), minElev.value(),
-                          maxSats.value(), uint8_t(sbasMode.value()), uint16_t(sbasSelect1.value()), uint16_t(sbasSelect2.value()),
-                          uint16_t(sbasSelect3.value()));
-        }
-        else
-        {
-            std::snprintf(result.begin(), result.capacity(), "%04X,%d,%d,%d,%02X,%04X,%04X,%04X,%d", uint16_t(systems.value()), minCno.value(), minElev.value(),
-                          maxSats.value(), uint8_t(sbasMode.value()), uint16_t(sbasSelect1.value()), uint16_t(sbasSelect2.value()),
-                          uint16_t(sbasSelect3.value()), static_cast<uint8_t>(receiverSelect));
-        }
-    }
-    return result;
-}
-
-bool GnssSyncConfig::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 7 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnssSyncEnable_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!gnssSyncEnable_tmp.has_value()) { return true; }
-    gnssSyncEnable = static_cast<GnssSyncConfig::GnssSyncEnable>(gnssSyncEnable_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto polarity_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!polarity_tmp.has_value()) { return true; }
-    polarity = static_cast<GnssSyncConfig::Polarity>(polarity_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto specType_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!specType_tmp.has_value()) { return true; }
-    specType = static_cast<GnssSyncConfig::SpecType>(specType_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto resv_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!resv_tmp.has_value()) { return true; }
-    resv = resv_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto period_tmp = StringUtils::fromString<uint32_t>(start, end);
-    if (!period_tmp.has_value()) { return true; }
-    period = period_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto pulseWidth_tmp = StringUtils::fromString<uint32_t>(start, end);
-    if (!pulseWidth_tmp.has_value()) { return true; }
-    pulseWidth = pulseWidth_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto offset_tmp = StringUtils::fromString<int32_t>(start, end);
-    if (!offset_tmp.has_value()) { return true; }
-    offset = offset_tmp.value();
-
-    return false;  // no errors occurred
-}
-
-AsciiMessage GnssSyncConfig::toString() const
-{
-    AsciiMessage result = "";
-
-    // verify that all fields have a value set
-    if (gnssSyncEnable.has_value() && polarity.has_value() && specType.has_value() && resv.has_value() && period.has_value() && pulseWidth.has_value() &&
-        offset.has_value())
-    {
-        std::snprintf(result.begin(), result.capacity(), "%u,%u,%u,%u,%u,%u,%d", static_cast<uint8_t>(gnssSyncEnable.value()),
-                      static_cast<uint8_t>(polarity.value()), static_cast<uint8_t>(specType.value()), resv.value(), period.value(), pulseWidth.value(),
-                      offset.value());
-    }
-
-    return result;
-}
-
-bool Gnss2SolLla::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 15 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gps2Tow_tmp = StringUtils::fromString<double>(start, end);
-    if (!gps2Tow_tmp.has_value()) { return true; }
-    gps2Tow = gps2Tow_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gps2Week_tmp = StringUtils::fromString<uint16_t>(start, end);
-    if (!gps2Week_tmp.has_value()) { return true; }
-    gps2Week = gps2Week_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss2Fix_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!gnss2Fix_tmp.has_value()) { return true; }
-    gnss2Fix = static_cast<Gnss2SolLla::Gnss2Fix>(gnss2Fix_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss2NumSats_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!gnss2NumSats_tmp.has_value()) { return true; }
-    gnss2NumSats = gnss2NumSats_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss2Lat_tmp = StringUtils::fromString<double>(start, end);
-    if (!gnss2Lat_tmp.has_value()) { return true; }
-    gnss2Lat = gnss2Lat_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss2Lon_tmp = StringUtils::fromString<double>(start, end);
-    if (!gnss2Lon_tmp.has_value()) { return true; }
-    gnss2Lon = gnss2Lon_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss2Alt_tmp = StringUtils::fromString<double>(start, end);
-    if (!gnss2Alt_tmp.has_value()) { return true; }
-    gnss2Alt = gnss2Alt_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss2VelN_tmp = StringUtils::fromString<float>(start, end);
-    if (!gnss2VelN_tmp.has_value()) { return true; }
-    gnss2VelN = gnss2VelN_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss2VelE_tmp = StringUtils::fromString<float>(start, end);
-    if (!gnss2VelE_tmp.has_value()) { return true; }
-    gnss2VelE = gnss2VelE_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss2VelD_tmp = StringUtils::fromString<float>(start, end);
-    if (!gnss2VelD_tmp.has_value()) { return true; }
-    gnss2VelD = gnss2VelD_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss2PosUncertaintyN_tmp = StringUtils::fromString<float>(start, end);
-    if (!gnss2PosUncertaintyN_tmp.has_value()) { return true; }
-    gnss2PosUncertaintyN = gnss2PosUncertaintyN_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss2PosUncertaintyE_tmp = StringUtils::fromString<float>(start, end);
-    if (!gnss2PosUncertaintyE_tmp.has_value()) { return true; }
-    gnss2PosUncertaintyE = gnss2PosUncertaintyE_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss2PosUncertaintyD_tmp = StringUtils::fromString<float>(start, end);
-    if (!gnss2PosUncertaintyD_tmp.has_value()) { return true; }
-    gnss2PosUncertaintyD = gnss2PosUncertaintyD_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss2VelUncertainty_tmp = StringUtils::fromString<float>(start, end);
-    if (!gnss2VelUncertainty_tmp.has_value()) { return true; }
-    gnss2VelUncertainty = gnss2VelUncertainty_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss2TimeUncertainty_tmp = StringUtils::fromString<float>(start, end);
-    if (!gnss2TimeUncertainty_tmp.has_value()) { return true; }
-    gnss2TimeUncertainty = gnss2TimeUncertainty_tmp.value();
-
-    return false;  // no errors occurred
-}
-
-bool Gnss2SolEcef::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 15 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gps2Tow_tmp = StringUtils::fromString<double>(start, end);
-    if (!gps2Tow_tmp.has_value()) { return true; }
-    gps2Tow = gps2Tow_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gps2Week_tmp = StringUtils::fromString<uint16_t>(start, end);
-    if (!gps2Week_tmp.has_value()) { return true; }
-    gps2Week = gps2Week_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss2Fix_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!gnss2Fix_tmp.has_value()) { return true; }
-    gnss2Fix = static_cast<Gnss2SolEcef::Gnss2Fix>(gnss2Fix_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss2NumSats_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!gnss2NumSats_tmp.has_value()) { return true; }
-    gnss2NumSats = gnss2NumSats_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss2PosX_tmp = StringUtils::fromString<double>(start, end);
-    if (!gnss2PosX_tmp.has_value()) { return true; }
-    gnss2PosX = gnss2PosX_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss2PosY_tmp = StringUtils::fromString<double>(start, end);
-    if (!gnss2PosY_tmp.has_value()) { return true; }
-    gnss2PosY = gnss2PosY_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss2PosZ_tmp = StringUtils::fromString<double>(start, end);
-    if (!gnss2PosZ_tmp.has_value()) { return true; }
-    gnss2PosZ = gnss2PosZ_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss2VelX_tmp = StringUtils::fromString<float>(start, end);
-    if (!gnss2VelX_tmp.has_value()) { return true; }
-    gnss2VelX = gnss2VelX_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss2VelY_tmp = StringUtils::fromString<float>(start, end);
-    if (!gnss2VelY_tmp.has_value()) { return true; }
-    gnss2VelY = gnss2VelY_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss2VelZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!gnss2VelZ_tmp.has_value()) { return true; }
-    gnss2VelZ = gnss2VelZ_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss2PosUncertaintyX_tmp = StringUtils::fromString<float>(start, end);
-    if (!gnss2PosUncertaintyX_tmp.has_value()) { return true; }
-    gnss2PosUncertaintyX = gnss2PosUncertaintyX_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss2PosUncertaintyY_tmp = StringUtils::fromString<float>(start, end);
-    if (!gnss2PosUncertaintyY_tmp.has_value()) { return true; }
-    gnss2PosUncertaintyY = gnss2PosUncertaintyY_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss2PosUncertaintyZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!gnss2PosUncertaintyZ_tmp.has_value()) { return true; }
-    gnss2PosUncertaintyZ = gnss2PosUncertaintyZ_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss2VelUncertainty_tmp = StringUtils::fromString<float>(start, end);
-    if (!gnss2VelUncertainty_tmp.has_value()) { return true; }
-    gnss2VelUncertainty = gnss2VelUncertainty_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnss2TimeUncertainty_tmp = StringUtils::fromString<float>(start, end);
-    if (!gnss2TimeUncertainty_tmp.has_value()) { return true; }
-    gnss2TimeUncertainty = gnss2TimeUncertainty_tmp.value();
-
-    return false;  // no errors occurred
-}
-
-bool ExtGnssOffset::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 3 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto positionX_tmp = StringUtils::fromString<float>(start, end);
-    if (!positionX_tmp.has_value()) { return true; }
-    positionX = positionX_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto positionY_tmp = StringUtils::fromString<float>(start, end);
-    if (!positionY_tmp.has_value()) { return true; }
-    positionY = positionY_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto positionZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!positionZ_tmp.has_value()) { return true; }
-    positionZ = positionZ_tmp.value();
-
-    return false;  // no errors occurred
-}
-
-AsciiMessage ExtGnssOffset::toString() const
-{
-    AsciiMessage result = "";
-
-    // verify that all fields have a value set
-    if (positionX.has_value() && positionY.has_value() && positionZ.has_value())
-    {
-        std::snprintf(result.begin(), result.capacity(), "%f,%f,%f", positionX.value(), positionY.value(), positionZ.value());
-    }
-
-    return result;
-}
-
-}  // namespace GNSS
-
-namespace GNSSCompass
-{
-bool GnssCompassSignalHealthStatus::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 8 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto numSatsPvtA_tmp = StringUtils::fromString<float>(start, end);
-    if (!numSatsPvtA_tmp.has_value()) { return true; }
-    numSatsPvtA = numSatsPvtA_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto numSatsRtkA_tmp = StringUtils::fromString<float>(start, end);
-    if (!numSatsRtkA_tmp.has_value()) { return true; }
-    numSatsRtkA = numSatsRtkA_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto highestCn0A_tmp = StringUtils::fromString<float>(start, end);
-    if (!highestCn0A_tmp.has_value()) { return true; }
-    highestCn0A = highestCn0A_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto numSatsPvtB_tmp = StringUtils::fromString<float>(start, end);
-    if (!numSatsPvtB_tmp.has_value()) { return true; }
-    numSatsPvtB = numSatsPvtB_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto numSatsRtkB_tmp = StringUtils::fromString<float>(start, end);
-    if (!numSatsRtkB_tmp.has_value()) { return true; }
-    numSatsRtkB = numSatsRtkB_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto highestCn0B_tmp = StringUtils::fromString<float>(start, end);
-    if (!highestCn0B_tmp.has_value()) { return true; }
-    highestCn0B = highestCn0B_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto numComSatsPvt_tmp = StringUtils::fromString<float>(start, end);
-    if (!numComSatsPvt_tmp.has_value()) { return true; }
-    numComSatsPvt = numComSatsPvt_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto numComSatsRtk_tmp = StringUtils::fromString<float>(start, end);
-    if (!numComSatsRtk_tmp.has_value()) { return true; }
-    numComSatsRtk = numComSatsRtk_tmp.value();
-
-    return false;  // no errors occurred
-}
-
-bool GnssCompassBaseline::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 6 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto positionX_tmp = StringUtils::fromString<float>(start, end);
-    if (!positionX_tmp.has_value()) { return true; }
-    positionX = positionX_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto positionY_tmp = StringUtils::fromString<float>(start, end);
-    if (!positionY_tmp.has_value()) { return true; }
-    positionY = positionY_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto positionZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!positionZ_tmp.has_value()) { return true; }
-    positionZ = positionZ_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto uncertaintyX_tmp = StringUtils::fromString<float>(start, end);
-    if (!uncertaintyX_tmp.has_value()) { return true; }
-    uncertaintyX = uncertaintyX_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto uncertaintyY_tmp = StringUtils::fromString<float>(start, end);
-    if (!uncertaintyY_tmp.has_value()) { return true; }
-    uncertaintyY = uncertaintyY_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto uncertaintyZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!uncertaintyZ_tmp.has_value()) { return true; }
-    uncertaintyZ = uncertaintyZ_tmp.value();
-
-    return false;  // no errors occurred
-}
-
-AsciiMessage GnssCompassBaseline::toString() const
-{
-    AsciiMessage result = "";
-
-    // verify that all fields have a value set
-    if (positionX.has_value() && positionY.has_value() && positionZ.has_value() && uncertaintyX.has_value() && uncertaintyY.has_value() &&
-        uncertaintyZ.has_value())
-    {
-        std::snprintf(result.begin(), result.capacity(), "%f,%f,%f,%f,%f,%f", positionX.value(), positionY.value(), positionZ.value(), uncertaintyX.value(),
-                      uncertaintyY.value(), uncertaintyZ.value());
-    }
-
-    return result;
-}
-
-bool GnssCompassEstBaseline::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 9 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto estBaselineComplete_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!estBaselineComplete_tmp.has_value()) { return true; }
-    estBaselineComplete = estBaselineComplete_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto resv_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!resv_tmp.has_value()) { return true; }
-    resv = resv_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto numMeas_tmp = StringUtils::fromString<uint16_t>(start, end);
-    if (!numMeas_tmp.has_value()) { return true; }
-    numMeas = numMeas_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto positionX_tmp = StringUtils::fromString<float>(start, end);
-    if (!positionX_tmp.has_value()) { return true; }
-    positionX = positionX_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto positionY_tmp = StringUtils::fromString<float>(start, end);
-    if (!positionY_tmp.has_value()) { return true; }
-    positionY = positionY_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto positionZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!positionZ_tmp.has_value()) { return true; }
-    positionZ = positionZ_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto uncertaintyX_tmp = StringUtils::fromString<float>(start, end);
-    if (!uncertaintyX_tmp.has_value()) { return true; }
-    uncertaintyX = uncertaintyX_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto uncertaintyY_tmp = StringUtils::fromString<float>(start, end);
-    if (!uncertaintyY_tmp.has_value()) { return true; }
-    uncertaintyY = uncertaintyY_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto uncertaintyZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!uncertaintyZ_tmp.has_value()) { return true; }
-    uncertaintyZ = uncertaintyZ_tmp.value();
-
-    return false;  // no errors occurred
-}
-
-bool GnssCompassStartupStatus::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 2 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto percentComplete_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!percentComplete_tmp.has_value()) { return true; }
-    percentComplete = percentComplete_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto currentHeading_tmp = StringUtils::fromString<float>(start, end);
-    if (!currentHeading_tmp.has_value()) { return true; }
-    currentHeading = currentHeading_tmp.value();
-
-    return false;  // no errors occurred
-}
-
-}  // namespace GNSSCompass
-
-namespace HardSoftIronEstimator
-{
-bool RealTimeHsiControl::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 3 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto mode_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!mode_tmp.has_value()) { return true; }
-    mode = static_cast<RealTimeHsiControl::Mode>(mode_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto applyCompensation_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!applyCompensation_tmp.has_value()) { return true; }
-    applyCompensation = static_cast<RealTimeHsiControl::ApplyCompensation>(applyCompensation_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto convergeRate_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!convergeRate_tmp.has_value()) { return true; }
-    convergeRate = convergeRate_tmp.value();
-
-    return false;  // no errors occurred
-}
-
-AsciiMessage RealTimeHsiControl::toString() const
-{
-    AsciiMessage result = "";
-
-    // verify that all fields have a value set
-    if (mode.has_value() && applyCompensation.has_value() && convergeRate.has_value())
-    {
-        std::snprintf(result.begin(), result.capacity(), "%u,%u,%u", static_cast<uint8_t>(mode.value()), static_cast<uint8_t>(applyCompensation.value()),
-                      convergeRate.value());
-    }
-
-    return result;
-}
-
-bool EstMagCal::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 12 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magGain00_tmp = StringUtils::fromString<float>(start, end);
-    if (!magGain00_tmp.has_value()) { return true; }
-    magGain00 = magGain00_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magGain01_tmp = StringUtils::fromString<float>(start, end);
-    if (!magGain01_tmp.has_value()) { return true; }
-    magGain01 = magGain01_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magGain02_tmp = StringUtils::fromString<float>(start, end);
-    if (!magGain02_tmp.has_value()) { return true; }
-    magGain02 = magGain02_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magGain10_tmp = StringUtils::fromString<float>(start, end);
-    if (!magGain10_tmp.has_value()) { return true; }
-    magGain10 = magGain10_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magGain11_tmp = StringUtils::fromString<float>(start, end);
-    if (!magGain11_tmp.has_value()) { return true; }
-    magGain11 = magGain11_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magGain12_tmp = StringUtils::fromString<float>(start, end);
-    if (!magGain12_tmp.has_value()) { return true; }
-    magGain12 = magGain12_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magGain20_tmp = StringUtils::fromString<float>(start, end);
-    if (!magGain20_tmp.has_value()) { return true; }
-    magGain20 = magGain20_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magGain21_tmp = StringUtils::fromString<float>(start, end);
-    if (!magGain21_tmp.has_value()) { return true; }
-    magGain21 = magGain21_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magGain22_tmp = StringUtils::fromString<float>(start, end);
-    if (!magGain22_tmp.has_value()) { return true; }
-    magGain22 = magGain22_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magBiasX_tmp = StringUtils::fromString<float>(start, end);
-    if (!magBiasX_tmp.has_value()) { return true; }
-    magBiasX = magBiasX_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magBiasY_tmp = StringUtils::fromString<float>(start, end);
-    if (!magBiasY_tmp.has_value()) { return true; }
-    magBiasY = magBiasY_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magBiasZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!magBiasZ_tmp.has_value()) { return true; }
-    magBiasZ = magBiasZ_tmp.value();
-
-    return false;  // no errors occurred
-}
-
-}  // namespace HardSoftIronEstimator
-
-namespace Heave
-{
-bool HeaveOutputs::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 3 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto heave_tmp = StringUtils::fromString<float>(start, end);
-    if (!heave_tmp.has_value()) { return true; }
-    heave = heave_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto heaveRate_tmp = StringUtils::fromString<float>(start, end);
-    if (!heaveRate_tmp.has_value()) { return true; }
-    heaveRate = heaveRate_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto delayedHeave_tmp = StringUtils::fromString<float>(start, end);
-    if (!delayedHeave_tmp.has_value()) { return true; }
-    delayedHeave = delayedHeave_tmp.value();
-
-    return false;  // no errors occurred
-}
-
-bool HeaveBasicConfig::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 7 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto initialWavePeriod_tmp = StringUtils::fromString<float>(start, end);
-    if (!initialWavePeriod_tmp.has_value()) { return true; }
-    initialWavePeriod = initialWavePeriod_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto initialWaveAmplitude_tmp = StringUtils::fromString<float>(start, end);
-    if (!initialWaveAmplitude_tmp.has_value()) { return true; }
-    initialWaveAmplitude = initialWaveAmplitude_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto maxWavePeriod_tmp = StringUtils::fromString<float>(start, end);
-    if (!maxWavePeriod_tmp.has_value()) { return true; }
-    maxWavePeriod = maxWavePeriod_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto minWaveAmplitude_tmp = StringUtils::fromString<float>(start, end);
-    if (!minWaveAmplitude_tmp.has_value()) { return true; }
-    minWaveAmplitude = minWaveAmplitude_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto delayedHeaveCutoffFreq_tmp = StringUtils::fromString<float>(start, end);
-    if (!delayedHeaveCutoffFreq_tmp.has_value()) { return true; }
-    delayedHeaveCutoffFreq = delayedHeaveCutoffFreq_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto heaveCutoffFreq_tmp = StringUtils::fromString<float>(start, end);
-    if (!heaveCutoffFreq_tmp.has_value()) { return true; }
-    heaveCutoffFreq = heaveCutoffFreq_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto heaveRateCutoffFreq_tmp = StringUtils::fromString<float>(start, end);
-    if (!heaveRateCutoffFreq_tmp.has_value()) { return true; }
-    heaveRateCutoffFreq = heaveRateCutoffFreq_tmp.value();
-
-    return false;  // no errors occurred
-}
-
-AsciiMessage HeaveBasicConfig::toString() const
-{
-    AsciiMessage result = "";
-
-    // verify that all fields have a value set
-    if (initialWavePeriod.has_value() && initialWaveAmplitude.has_value() && maxWavePeriod.has_value() && minWaveAmplitude.has_value() &&
-        delayedHeaveCutoffFreq.has_value() && heaveCutoffFreq.has_value() && heaveRateCutoffFreq.has_value())
-    {
-        std::snprintf(result.begin(), result.capacity(), "%f,%f,%f,%f,%f,%f,%f", initialWavePeriod.value(), initialWaveAmplitude.value(), maxWavePeriod.value(),
-                      minWaveAmplitude.value(), delayedHeaveCutoffFreq.value(), heaveCutoffFreq.value(), heaveRateCutoffFreq.value());
-    }
-
-    return result;
-}
-
-}  // namespace Heave
-
-namespace IMU
-{
-bool Mag::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 3 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magX_tmp = StringUtils::fromString<float>(start, end);
-    if (!magX_tmp.has_value()) { return true; }
-    magX = magX_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magY_tmp = StringUtils::fromString<float>(start, end);
-    if (!magY_tmp.has_value()) { return true; }
-    magY = magY_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!magZ_tmp.has_value()) { return true; }
-    magZ = magZ_tmp.value();
-
-    return false;  // no errors occurred
-}
-
-bool Accel::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 3 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto accelX_tmp = StringUtils::fromString<float>(start, end);
-    if (!accelX_tmp.has_value()) { return true; }
-    accelX = accelX_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto accelY_tmp = StringUtils::fromString<float>(start, end);
-    if (!accelY_tmp.has_value()) { return true; }
-    accelY = accelY_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto accelZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!accelZ_tmp.has_value()) { return true; }
-    accelZ = accelZ_tmp.value();
-
-    return false;  // no errors occurred
-}
-
-bool Gyro::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 3 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroX_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroX_tmp.has_value()) { return true; }
-    gyroX = gyroX_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroY_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroY_tmp.has_value()) { return true; }
-    gyroY = gyroY_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroZ_tmp.has_value()) { return true; }
-    gyroZ = gyroZ_tmp.value();
-
-    return false;  // no errors occurred
-}
-
-bool MagAccelGyro::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 9 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magX_tmp = StringUtils::fromString<float>(start, end);
-    if (!magX_tmp.has_value()) { return true; }
-    magX = magX_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magY_tmp = StringUtils::fromString<float>(start, end);
-    if (!magY_tmp.has_value()) { return true; }
-    magY = magY_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!magZ_tmp.has_value()) { return true; }
-    magZ = magZ_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto accelX_tmp = StringUtils::fromString<float>(start, end);
-    if (!accelX_tmp.has_value()) { return true; }
-    accelX = accelX_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto accelY_tmp = StringUtils::fromString<float>(start, end);
-    if (!accelY_tmp.has_value()) { return true; }
-    accelY = accelY_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto accelZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!accelZ_tmp.has_value()) { return true; }
-    accelZ = accelZ_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroX_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroX_tmp.has_value()) { return true; }
-    gyroX = gyroX_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroY_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroY_tmp.has_value()) { return true; }
-    gyroY = gyroY_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroZ_tmp.has_value()) { return true; }
-    gyroZ = gyroZ_tmp.value();
-
-    return false;  // no errors occurred
-}
-
-bool MagCal::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 12 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magGain00_tmp = StringUtils::fromString<float>(start, end);
-    if (!magGain00_tmp.has_value()) { return true; }
-    magGain00 = magGain00_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magGain01_tmp = StringUtils::fromString<float>(start, end);
-    if (!magGain01_tmp.has_value()) { return true; }
-    magGain01 = magGain01_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magGain02_tmp = StringUtils::fromString<float>(start, end);
-    if (!magGain02_tmp.has_value()) { return true; }
-    magGain02 = magGain02_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magGain10_tmp = StringUtils::fromString<float>(start, end);
-    if (!magGain10_tmp.has_value()) { return true; }
-    magGain10 = magGain10_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magGain11_tmp = StringUtils::fromString<float>(start, end);
-    if (!magGain11_tmp.has_value()) { return true; }
-    magGain11 = magGain11_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magGain12_tmp = StringUtils::fromString<float>(start, end);
-    if (!magGain12_tmp.has_value()) { return true; }
-    magGain12 = magGain12_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magGain20_tmp = StringUtils::fromString<float>(start, end);
-    if (!magGain20_tmp.has_value()) { return true; }
-    magGain20 = magGain20_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magGain21_tmp = StringUtils::fromString<float>(start, end);
-    if (!magGain21_tmp.has_value()) { return true; }
-    magGain21 = magGain21_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magGain22_tmp = StringUtils::fromString<float>(start, end);
-    if (!magGain22_tmp.has_value()) { return true; }
-    magGain22 = magGain22_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magBiasX_tmp = StringUtils::fromString<float>(start, end);
-    if (!magBiasX_tmp.has_value()) { return true; }
-    magBiasX = magBiasX_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magBiasY_tmp = StringUtils::fromString<float>(start, end);
-    if (!magBiasY_tmp.has_value()) { return true; }
-    magBiasY = magBiasY_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magBiasZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!magBiasZ_tmp.has_value()) { return true; }
-    magBiasZ = magBiasZ_tmp.value();
-
-    return false;  // no errors occurred
-}
-
-AsciiMessage MagCal::toString() const
-{
-    AsciiMessage result = "";
-
-    // verify that all fields have a value set
-    if (magGain00.has_value() && magGain01.has_value() && magGain02.has_value() && magGain10.has_value() && magGain11.has_value() && magGain12.has_value() &&
-        magGain20.has_value() && magGain21.has_value() && magGain22.has_value() && magBiasX.has_value() && magBiasY.has_value() && magBiasZ.has_value())
-    {
-        std::snprintf(result.begin(), result.capacity(), "%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f", magGain00.value(), magGain01.value(), magGain02.value(),
-                      magGain10.value(), magGain11.value(), magGain12.value(), magGain20.value(), magGain21.value(), magGain22.value(), magBiasX.value(),
-                      magBiasY.value(), magBiasZ.value());
-    }
-
-    return result;
-}
-
-bool AccelCal::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 12 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto accelGain00_tmp = StringUtils::fromString<float>(start, end);
-    if (!accelGain00_tmp.has_value()) { return true; }
-    accelGain00 = accelGain00_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto accelGain01_tmp = StringUtils::fromString<float>(start, end);
-    if (!accelGain01_tmp.has_value()) { return true; }
-    accelGain01 = accelGain01_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto accelGain02_tmp = StringUtils::fromString<float>(start, end);
-    if (!accelGain02_tmp.has_value()) { return true; }
-    accelGain02 = accelGain02_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto accelGain10_tmp = StringUtils::fromString<float>(start, end);
-    if (!accelGain10_tmp.has_value()) { return true; }
-    accelGain10 = accelGain10_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto accelGain11_tmp = StringUtils::fromString<float>(start, end);
-    if (!accelGain11_tmp.has_value()) { return true; }
-    accelGain11 = accelGain11_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto accelGain12_tmp = StringUtils::fromString<float>(start, end);
-    if (!accelGain12_tmp.has_value()) { return true; }
-    accelGain12 = accelGain12_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto accelGain20_tmp = StringUtils::fromString<float>(start, end);
-    if (!accelGain20_tmp.has_value()) { return true; }
-    accelGain20 = accelGain20_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto accelGain21_tmp = StringUtils::fromString<float>(start, end);
-    if (!accelGain21_tmp.has_value()) { return true; }
-    accelGain21 = accelGain21_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto accelGain22_tmp = StringUtils::fromString<float>(start, end);
-    if (!accelGain22_tmp.has_value()) { return true; }
-    accelGain22 = accelGain22_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto accelBiasX_tmp = StringUtils::fromString<float>(start, end);
-    if (!accelBiasX_tmp.has_value()) { return true; }
-    accelBiasX = accelBiasX_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto accelBiasY_tmp = StringUtils::fromString<float>(start, end);
-    if (!accelBiasY_tmp.has_value()) { return true; }
-    accelBiasY = accelBiasY_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto accelBiasZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!accelBiasZ_tmp.has_value()) { return true; }
-    accelBiasZ = accelBiasZ_tmp.value();
-
-    return false;  // no errors occurred
-}
-
-AsciiMessage AccelCal::toString() const
-{
-    AsciiMessage result = "";
-
-    // verify that all fields have a value set
-    if (accelGain00.has_value() && accelGain01.has_value() && accelGain02.has_value() && accelGain10.has_value() && accelGain11.has_value() &&
-        accelGain12.has_value() && accelGain20.has_value() && accelGain21.has_value() && accelGain22.has_value() && accelBiasX.has_value() &&
-        accelBiasY.has_value() && accelBiasZ.has_value())
-    {
-        std::snprintf(result.begin(), result.capacity(), "%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f", accelGain00.value(), accelGain01.value(), accelGain02.value(),
-                      accelGain10.value(), accelGain11.value(), accelGain12.value(), accelGain20.value(), accelGain21.value(), accelGain22.value(),
-                      accelBiasX.value(), accelBiasY.value(), accelBiasZ.value());
-    }
-
-    return result;
-}
-
-bool RefFrameRot::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 9 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto rfr00_tmp = StringUtils::fromString<float>(start, end);
-    if (!rfr00_tmp.has_value()) { return true; }
-    rfr00 = rfr00_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto rfr01_tmp = StringUtils::fromString<float>(start, end);
-    if (!rfr01_tmp.has_value()) { return true; }
-    rfr01 = rfr01_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto rfr02_tmp = StringUtils::fromString<float>(start, end);
-    if (!rfr02_tmp.has_value()) { return true; }
-    rfr02 = rfr02_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto rfr10_tmp = StringUtils::fromString<float>(start, end);
-    if (!rfr10_tmp.has_value()) { return true; }
-    rfr10 = rfr10_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto rfr11_tmp = StringUtils::fromString<float>(start, end);
-    if (!rfr11_tmp.has_value()) { return true; }
-    rfr11 = rfr11_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto rfr12_tmp = StringUtils::fromString<float>(start, end);
-    if (!rfr12_tmp.has_value()) { return true; }
-    rfr12 = rfr12_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto rfr20_tmp = StringUtils::fromString<float>(start, end);
-    if (!rfr20_tmp.has_value()) { return true; }
-    rfr20 = rfr20_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto rfr21_tmp = StringUtils::fromString<float>(start, end);
-    if (!rfr21_tmp.has_value()) { return true; }
-    rfr21 = rfr21_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto rfr22_tmp = StringUtils::fromString<float>(start, end);
-    if (!rfr22_tmp.has_value()) { return true; }
-    rfr22 = rfr22_tmp.value();
-
-    return false;  // no errors occurred
-}
-
-AsciiMessage RefFrameRot::toString() const
-{
-    AsciiMessage result = "";
-
-    // verify that all fields have a value set
-    if (rfr00.has_value() && rfr01.has_value() && rfr02.has_value() && rfr10.has_value() && rfr11.has_value() && rfr12.has_value() && rfr20.has_value() &&
-        rfr21.has_value() && rfr22.has_value())
-    {
-        std::snprintf(result.begin(), result.capacity(), "%f,%f,%f,%f,%f,%f,%f,%f,%f", rfr00.value(), rfr01.value(), rfr02.value(), rfr10.value(),
-                      rfr11.value(), rfr12.value(), rfr20.value(), rfr21.value(), rfr22.value());
-    }
-
-    return result;
-}
-
-bool ImuMeas::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 11 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto uncompMagX_tmp = StringUtils::fromString<float>(start, end);
-    if (!uncompMagX_tmp.has_value()) { return true; }
-    uncompMagX = uncompMagX_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto uncompMagY_tmp = StringUtils::fromString<float>(start, end);
-    if (!uncompMagY_tmp.has_value()) { return true; }
-    uncompMagY = uncompMagY_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto uncompMagZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!uncompMagZ_tmp.has_value()) { return true; }
-    uncompMagZ = uncompMagZ_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto uncompAccX_tmp = StringUtils::fromString<float>(start, end);
-    if (!uncompAccX_tmp.has_value()) { return true; }
-    uncompAccX = uncompAccX_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto uncompAccY_tmp = StringUtils::fromString<float>(start, end);
-    if (!uncompAccY_tmp.has_value()) { return true; }
-    uncompAccY = uncompAccY_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto uncompAccZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!uncompAccZ_tmp.has_value()) { return true; }
-    uncompAccZ = uncompAccZ_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto uncompGyroX_tmp = StringUtils::fromString<float>(start, end);
-    if (!uncompGyroX_tmp.has_value()) { return true; }
-    uncompGyroX = uncompGyroX_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto uncompGyroY_tmp = StringUtils::fromString<float>(start, end);
-    if (!uncompGyroY_tmp.has_value()) { return true; }
-    uncompGyroY = uncompGyroY_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto uncompGyroZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!uncompGyroZ_tmp.has_value()) { return true; }
-    uncompGyroZ = uncompGyroZ_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto temperature_tmp = StringUtils::fromString<float>(start, end);
-    if (!temperature_tmp.has_value()) { return true; }
-    temperature = temperature_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto pressure_tmp = StringUtils::fromString<float>(start, end);
-    if (!pressure_tmp.has_value()) { return true; }
-    pressure = pressure_tmp.value();
-
-    return false;  // no errors occurred
-}
-
-bool DeltaThetaVelocity::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 7 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto deltaTime_tmp = StringUtils::fromString<float>(start, end);
-    if (!deltaTime_tmp.has_value()) { return true; }
-    deltaTime = deltaTime_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto deltaThetaX_tmp = StringUtils::fromString<float>(start, end);
-    if (!deltaThetaX_tmp.has_value()) { return true; }
-    deltaThetaX = deltaThetaX_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto deltaThetaY_tmp = StringUtils::fromString<float>(start, end);
-    if (!deltaThetaY_tmp.has_value()) { return true; }
-    deltaThetaY = deltaThetaY_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto deltaThetaZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!deltaThetaZ_tmp.has_value()) { return true; }
-    deltaThetaZ = deltaThetaZ_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto deltaVelX_tmp = StringUtils::fromString<float>(start, end);
-    if (!deltaVelX_tmp.has_value()) { return true; }
-    deltaVelX = deltaVelX_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto deltaVelY_tmp = StringUtils::fromString<float>(start, end);
-    if (!deltaVelY_tmp.has_value()) { return true; }
-    deltaVelY = deltaVelY_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto deltaVelZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!deltaVelZ_tmp.has_value()) { return true; }
-    deltaVelZ = deltaVelZ_tmp.value();
-
-    return false;  // no errors occurred
-}
-
-bool DeltaThetaVelConfig::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 5 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto integrationFrame_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!integrationFrame_tmp.has_value()) { return true; }
-    integrationFrame = static_cast<DeltaThetaVelConfig::IntegrationFrame>(integrationFrame_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroCompensation_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!gyroCompensation_tmp.has_value()) { return true; }
-    gyroCompensation = static_cast<DeltaThetaVelConfig::GyroCompensation>(gyroCompensation_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto accelCompensation_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!accelCompensation_tmp.has_value()) { return true; }
-    accelCompensation = static_cast<DeltaThetaVelConfig::AccelCompensation>(accelCompensation_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto earthRateCompensation_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!earthRateCompensation_tmp.has_value()) { return true; }
-    earthRateCompensation = static_cast<DeltaThetaVelConfig::EarthRateCompensation>(earthRateCompensation_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto resv_tmp = StringUtils::fromString<uint16_t>(start, end);
-    if (!resv_tmp.has_value()) { return true; }
-    resv = resv_tmp.value();
-
-    return false;  // no errors occurred
-}
-
-AsciiMessage DeltaThetaVelConfig::toString() const
-{
-    AsciiMessage result = "";
-
-    // verify that all fields have a value set
-    if (integrationFrame.has_value() && gyroCompensation.has_value() && accelCompensation.has_value() && earthRateCompensation.has_value() && resv.has_value())
-    {
-        std::snprintf(result.begin(), result.capacity(), "%u,%u,%u,%u,%u", static_cast<uint8_t>(integrationFrame.value()),
-                      static_cast<uint8_t>(gyroCompensation.value()), static_cast<uint8_t>(accelCompensation.value()),
-                      static_cast<uint8_t>(earthRateCompensation.value()), resv.value());
-    }
-
-    return result;
-}
-
-bool GyroCal::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 12 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroGain00_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroGain00_tmp.has_value()) { return true; }
-    gyroGain00 = gyroGain00_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroGain01_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroGain01_tmp.has_value()) { return true; }
-    gyroGain01 = gyroGain01_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroGain02_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroGain02_tmp.has_value()) { return true; }
-    gyroGain02 = gyroGain02_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroGain10_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroGain10_tmp.has_value()) { return true; }
-    gyroGain10 = gyroGain10_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroGain11_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroGain11_tmp.has_value()) { return true; }
-    gyroGain11 = gyroGain11_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroGain12_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroGain12_tmp.has_value()) { return true; }
-    gyroGain12 = gyroGain12_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroGain20_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroGain20_tmp.has_value()) { return true; }
-    gyroGain20 = gyroGain20_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroGain21_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroGain21_tmp.has_value()) { return true; }
-    gyroGain21 = gyroGain21_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroGain22_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroGain22_tmp.has_value()) { return true; }
-    gyroGain22 = gyroGain22_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroBiasX_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroBiasX_tmp.has_value()) { return true; }
-    gyroBiasX = gyroBiasX_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroBiasY_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroBiasY_tmp.has_value()) { return true; }
-    gyroBiasY = gyroBiasY_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroBiasZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroBiasZ_tmp.has_value()) { return true; }
-    gyroBiasZ = gyroBiasZ_tmp.value();
-
-    return false;  // no errors occurred
-}
-
-AsciiMessage GyroCal::toString() const
-{
-    AsciiMessage result = "";
-
-    // verify that all fields have a value set
-    if (gyroGain00.has_value() && gyroGain01.has_value() && gyroGain02.has_value() && gyroGain10.has_value() && gyroGain11.has_value() &&
-        gyroGain12.has_value() && gyroGain20.has_value() && gyroGain21.has_value() && gyroGain22.has_value() && gyroBiasX.has_value() &&
-        gyroBiasY.has_value() && gyroBiasZ.has_value())
-    {
-        std::snprintf(result.begin(), result.capacity(), "%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f", gyroGain00.value(), gyroGain01.value(), gyroGain02.value(),
-                      gyroGain10.value(), gyroGain11.value(), gyroGain12.value(), gyroGain20.value(), gyroGain21.value(), gyroGain22.value(), gyroBiasX.value(),
-                      gyroBiasY.value(), gyroBiasZ.value());
-    }
-
-    return result;
-}
-
-bool ImuFilterControl::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 10 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magWindowSize_tmp = StringUtils::fromString<uint16_t>(start, end);
-    if (!magWindowSize_tmp.has_value()) { return true; }
-    magWindowSize = magWindowSize_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto accelWindowSize_tmp = StringUtils::fromString<uint16_t>(start, end);
-    if (!accelWindowSize_tmp.has_value()) { return true; }
-    accelWindowSize = accelWindowSize_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroWindowSize_tmp = StringUtils::fromString<uint16_t>(start, end);
-    if (!gyroWindowSize_tmp.has_value()) { return true; }
-    gyroWindowSize = gyroWindowSize_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto tempWindowSize_tmp = StringUtils::fromString<uint16_t>(start, end);
-    if (!tempWindowSize_tmp.has_value()) { return true; }
-    tempWindowSize = tempWindowSize_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto presWindowSize_tmp = StringUtils::fromString<uint16_t>(start, end);
-    if (!presWindowSize_tmp.has_value()) { return true; }
-    presWindowSize = presWindowSize_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto magFilterMode_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!magFilterMode_tmp.has_value()) { return true; }
-    magFilterMode = magFilterMode_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto accelFilterMode_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!accelFilterMode_tmp.has_value()) { return true; }
-    accelFilterMode = accelFilterMode_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroFilterMode_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!gyroFilterMode_tmp.has_value()) { return true; }
-    gyroFilterMode = gyroFilterMode_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto tempFilterMode_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!tempFilterMode_tmp.has_value()) { return true; }
-    tempFilterMode = tempFilterMode_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto presFilterMode_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!presFilterMode_tmp.has_value()) { return true; }
-    presFilterMode = presFilterMode_tmp.value();
-
-    return false;  // no errors occurred
-}
-
-AsciiMessage ImuFilterControl::toString() const
+AsciiMessage GnssSystemConfig::toString() const
 {
     AsciiMessage result = "";
 
     // verify that all fields have a value set
-    if (magWindowSize.has_value() && accelWindowSize.has_value() && gyroWindowSize.has_value() && tempWindowSize.has_value() && presWindowSize.has_value() &&
-        magFilterMode.has_value() && accelFilterMode.has_value() && gyroFilterMode.has_value() && tempFilterMode.has_value() && presFilterMode.has_value())
+    if (systems.has_value() && minCno.has_value() && minElev.has_value() && maxSats.has_value() && sbasMode.has_value() && sbasSelect1.has_value() &&
+        sbasSelect2.has_value() && sbasSelect3.has_value())
     {
-        std::snprintf(result.begin(), result.capacity(), "%u,%u,%u,%u,%u,%u,%u,%u,%u,%u", magWindowSize.value(), accelWindowSize.value(),
-                      gyroWindowSize.value(), tempWindowSize.value(), presWindowSize.value(), uint8_t(magFilterMode.value()), uint8_t(accelFilterMode.value()),
-                      uint8_t(gyroFilterMode.value()), uint8_t(tempFilterMode.value()), uint8_t(presFilterMode.value()));
+        if (receiverSelect == GNSS::GnssSystemConfig::ReceiverSelect::GnssAB)
+        {
+            std::snprintf(result.begin(), result.capacity(), "%04X,%d,%d,%d,%02X,%04X,%04X,%04X", uint16_t(systems.value()), minCno.value(), minElev.value(),
+                          maxSats.value(), uint8_t(sbasMode.value()), uint16_t(sbasSelect1.value()), uint16_t(sbasSelect2.value()),
+                          uint16_t(sbasSelect3.value()));
+        }
+        else
+        {
+            std::snprintf(result.begin(), result.capacity(), "%04X,%d,%d,%d,%02X,%04X,%04X,%04X,%d", uint16_t(systems.value()), minCno.value(), minElev.value(),
+                          maxSats.value(), uint8_t(sbasMode.value()), uint16_t(sbasSelect1.value()), uint16_t(sbasSelect2.value()),
+                          uint16_t(sbasSelect3.value()), static_cast<uint8_t>(receiverSelect));
+        }
     }
-
     return result;
 }
 
-}  // namespace IMU
-
-namespace INS
-{
-bool InsSolLla::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 15 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto timeGpsTow_tmp = StringUtils::fromString<double>(start, end);
-    if (!timeGpsTow_tmp.has_value()) { return true; }
-    timeGpsTow = timeGpsTow_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto timeGpsWeek_tmp = StringUtils::fromString<uint16_t>(start, end);
-    if (!timeGpsWeek_tmp.has_value()) { return true; }
-    timeGpsWeek = timeGpsWeek_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto insStatus_tmp = StringUtils::fromStringHex<uint16_t>(start, end);
-    if (!insStatus_tmp.has_value()) { return true; }
-    insStatus = insStatus_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto yaw_tmp = StringUtils::fromString<float>(start, end);
-    if (!yaw_tmp.has_value()) { return true; }
-    yaw = yaw_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto pitch_tmp = StringUtils::fromString<float>(start, end);
-    if (!pitch_tmp.has_value()) { return true; }
-    pitch = pitch_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto roll_tmp = StringUtils::fromString<float>(start, end);
-    if (!roll_tmp.has_value()) { return true; }
-    roll = roll_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto posLat_tmp = StringUtils::fromString<double>(start, end);
-    if (!posLat_tmp.has_value()) { return true; }
-    posLat = posLat_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto posLon_tmp = StringUtils::fromString<double>(start, end);
-    if (!posLon_tmp.has_value()) { return true; }
-    posLon = posLon_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto posAlt_tmp = StringUtils::fromString<double>(start, end);
-    if (!posAlt_tmp.has_value()) { return true; }
-    posAlt = posAlt_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto velN_tmp = StringUtils::fromString<float>(start, end);
-    if (!velN_tmp.has_value()) { return true; }
-    velN = velN_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto velE_tmp = StringUtils::fromString<float>(start, end);
-    if (!velE_tmp.has_value()) { return true; }
-    velE = velE_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto velD_tmp = StringUtils::fromString<float>(start, end);
-    if (!velD_tmp.has_value()) { return true; }
-    velD = velD_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto attUncertainty_tmp = StringUtils::fromString<float>(start, end);
-    if (!attUncertainty_tmp.has_value()) { return true; }
-    attUncertainty = attUncertainty_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto posUncertainty_tmp = StringUtils::fromString<float>(start, end);
-    if (!posUncertainty_tmp.has_value()) { return true; }
-    posUncertainty = posUncertainty_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto velUncertainty_tmp = StringUtils::fromString<float>(start, end);
-    if (!velUncertainty_tmp.has_value()) { return true; }
-    velUncertainty = velUncertainty_tmp.value();
-
-    return false;  // no errors occurred
-}
-
-bool InsSolEcef::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 15 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto timeGpsTow_tmp = StringUtils::fromString<double>(start, end);
-    if (!timeGpsTow_tmp.has_value()) { return true; }
-    timeGpsTow = timeGpsTow_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto timeGpsWeek_tmp = StringUtils::fromString<uint16_t>(start, end);
-    if (!timeGpsWeek_tmp.has_value()) { return true; }
-    timeGpsWeek = timeGpsWeek_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto insStatus_tmp = StringUtils::fromStringHex<uint16_t>(start, end);
-    if (!insStatus_tmp.has_value()) { return true; }
-    insStatus = insStatus_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto yaw_tmp = StringUtils::fromString<float>(start, end);
-    if (!yaw_tmp.has_value()) { return true; }
-    yaw = yaw_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto pitch_tmp = StringUtils::fromString<float>(start, end);
-    if (!pitch_tmp.has_value()) { return true; }
-    pitch = pitch_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto roll_tmp = StringUtils::fromString<float>(start, end);
-    if (!roll_tmp.has_value()) { return true; }
-    roll = roll_tmp.value();
+constexpr auto gnssSyncConfigFields = std::make_tuple(decimal<uint8_t>(&GnssSyncConfig::gnssSyncEnable), decimal<uint8_t>(&GnssSyncConfig::polarity),
+                                                      decimal<uint8_t>(&GnssSyncConfig::specType), &GnssSyncConfig::resv, &GnssSyncConfig::period,
+                                                      &GnssSyncConfig::pulseWidth, &GnssSyncConfig::offset);
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto posEx_tmp = StringUtils::fromString<double>(start, end);
-    if (!posEx_tmp.has_value()) { return true; }
-    posEx = posEx_tmp.value();
+bool GnssSyncConfig::fromString(const AsciiMessage& response) { return parseFields(response, *this, gnssSyncConfigFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto posEy_tmp = StringUtils::fromString<double>(start, end);
-    if (!posEy_tmp.has_value()) { return true; }
-    posEy = posEy_tmp.value();
+AsciiMessage GnssSyncConfig::toString() const { return formatFields(*this, gnssSyncConfigFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto posEz_tmp = StringUtils::fromString<double>(start, end);
-    if (!posEz_tmp.has_value()) { return true; }
-    posEz = posEz_tmp.value();
+constexpr auto gnss2SolLlaFields = std::make_tuple(&Gnss2SolLla::gps2Tow, &Gnss2SolLla::gps2Week, decimal<uint8_t>(&Gnss2SolLla::gnss2Fix),
+                                                   &Gnss2SolLla::gnss2NumSats, &Gnss2SolLla::gnss2Lat, &Gnss2SolLla::gnss2Lon, &Gnss2SolLla::gnss2Alt,
+                                                   &Gnss2SolLla::gnss2VelN, &Gnss2SolLla::gnss2VelE, &Gnss2SolLla::gnss2VelD,
+                                                   &Gnss2SolLla::gnss2PosUncertaintyN, &Gnss2SolLla::gnss2PosUncertaintyE,
+                                                   &Gnss2SolLla::gnss2PosUncertaintyD, &Gnss2SolLla::gnss2VelUncertainty,
+                                                   &Gnss2SolLla::gnss2TimeUncertainty);
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto velEx_tmp = StringUtils::fromString<float>(start, end);
-    if (!velEx_tmp.has_value()) { return true; }
-    velEx = velEx_tmp.value();
+bool Gnss2SolLla::fromString(const AsciiMessage& response) { return parseFields(response, *this, gnss2SolLlaFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto velEy_tmp = StringUtils::fromString<float>(start, end);
-    if (!velEy_tmp.has_value()) { return true; }
-    velEy = velEy_tmp.value();
+constexpr auto gnss2SolEcefFields = std::make_tuple(&Gnss2SolEcef::gps2Tow, &Gnss2SolEcef::gps2Week, decimal<uint8_t>(&Gnss2SolEcef::gnss2Fix),
+                                                    &Gnss2SolEcef::gnss2NumSats, &Gnss2SolEcef::gnss2PosX, &Gnss2SolEcef::gnss2PosY,
+                                                    &Gnss2SolEcef::gnss2PosZ, &Gnss2SolEcef::gnss2VelX, &Gnss2SolEcef::gnss2VelY,
+                                                    &Gnss2SolEcef::gnss2VelZ, &Gnss2SolEcef::gnss2PosUncertaintyX,
+                                                    &Gnss2SolEcef::gnss2PosUncertaintyY, &Gnss2SolEcef::gnss2PosUncertaintyZ,
+                                                    &Gnss2SolEcef::gnss2VelUncertainty, &Gnss2SolEcef::gnss2TimeUncertainty);
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto velEz_tmp = StringUtils::fromString<float>(start, end);
-    if (!velEz_tmp.has_value()) { return true; }
-    velEz = velEz_tmp.value();
+bool Gnss2SolEcef::fromString(const AsciiMessage& response) { return parseFields(response, *this, gnss2SolEcefFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto attUncertainty_tmp = StringUtils::fromString<float>(start, end);
-    if (!attUncertainty_tmp.has_value()) { return true; }
-    attUncertainty = attUncertainty_tmp.value();
+constexpr auto extGnssOffsetFields = std::make_tuple(&ExtGnssOffset::positionX, &ExtGnssOffset::positionY, &ExtGnssOffset::positionZ);
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto posUncertainty_tmp = StringUtils::fromString<float>(start, end);
-    if (!posUncertainty_tmp.has_value()) { return true; }
-    posUncertainty = posUncertainty_tmp.value();
+bool ExtGnssOffset::fromString(const AsciiMessage& response) { return parseFields(response, *this, extGnssOffsetFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto velUncertainty_tmp = StringUtils::fromString<float>(start, end);
-    if (!velUncertainty_tmp.has_value()) { return true; }
-    velUncertainty = velUncertainty_tmp.value();
+AsciiMessage ExtGnssOffset::toString() const { return formatFields(*this, extGnssOffsetFields); }
 
-    return false;  // no errors occurred
-}
+}  // namespace GNSS
 
-bool InsBasicConfig::fromString(const AsciiMessage& response)
+namespace GNSSCompass
 {
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 4 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto scenario_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!scenario_tmp.has_value()) { return true; }
-    scenario = static_cast<InsBasicConfig::Scenario>(scenario_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto ahrsAiding_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!ahrsAiding_tmp.has_value()) { return true; }
-    ahrsAiding = static_cast<InsBasicConfig::AhrsAiding>(ahrsAiding_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto estBaseline_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!estBaseline_tmp.has_value()) { return true; }
-    estBaseline = static_cast<InsBasicConfig::EstBaseline>(estBaseline_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto resv_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!resv_tmp.has_value()) { return true; }
-    resv = resv_tmp.value();
-
-    return false;  // no errors occurred
-}
+constexpr auto gnssCompassSignalHealthStatusFields = std::make_tuple(&GnssCompassSignalHealthStatus::numSatsPvtA,
+                                                                     &GnssCompassSignalHealthStatus::numSatsRtkA,
+                                                                     &GnssCompassSignalHealthStatus::highestCn0A,
+                                                                     &GnssCompassSignalHealthStatus::numSatsPvtB,
+                                                                     &GnssCompassSignalHealthStatus::numSatsRtkB,
+                                                                     &GnssCompassSignalHealthStatus::highestCn0B,
+                                                                     &GnssCompassSignalHealthStatus::numComSatsPvt,
+                                                                     &GnssCompassSignalHealthStatus::numComSatsRtk);
 
-AsciiMessage InsBasicConfig::toString() const
+bool GnssCompassSignalHealthStatus::fromString(const AsciiMessage& response)
 {
-    AsciiMessage result = "";
-
-    // verify that all fields have a value set
-    if (scenario.has_value() && ahrsAiding.has_value() && estBaseline.has_value() && resv.has_value())
-    {
-        std::snprintf(result.begin(), result.capacity(), "%u,%u,%u,%u", static_cast<uint8_t>(scenario.value()), static_cast<uint8_t>(ahrsAiding.value()),
-                      static_cast<uint8_t>(estBaseline.value()), resv.value());
-    }
-
-    return result;
+    return parseFields(response, *this, gnssCompassSignalHealthStatusFields);
 }
 
-bool InsStateLla::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 15 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto yaw_tmp = StringUtils::fromString<float>(start, end);
-    if (!yaw_tmp.has_value()) { return true; }
-    yaw = yaw_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto pitch_tmp = StringUtils::fromString<float>(start, end);
-    if (!pitch_tmp.has_value()) { return true; }
-    pitch = pitch_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto roll_tmp = StringUtils::fromString<float>(start, end);
-    if (!roll_tmp.has_value()) { return true; }
-    roll = roll_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto posLat_tmp = StringUtils::fromString<double>(start, end);
-    if (!posLat_tmp.has_value()) { return true; }
-    posLat = posLat_tmp.value();
+constexpr auto gnssCompassBaselineFields = std::make_tuple(&GnssCompassBaseline::positionX, &GnssCompassBaseline::positionY,
+                                                           &GnssCompassBaseline::positionZ, &GnssCompassBaseline::uncertaintyX,
+                                                           &GnssCompassBaseline::uncertaintyY, &GnssCompassBaseline::uncertaintyZ);
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto posLon_tmp = StringUtils::fromString<double>(start, end);
-    if (!posLon_tmp.has_value()) { return true; }
-    posLon = posLon_tmp.value();
+bool GnssCompassBaseline::fromString(const AsciiMessage& response) { return parseFields(response, *this, gnssCompassBaselineFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto posAlt_tmp = StringUtils::fromString<double>(start, end);
-    if (!posAlt_tmp.has_value()) { return true; }
-    posAlt = posAlt_tmp.value();
+AsciiMessage GnssCompassBaseline::toString() const { return formatFields(*this, gnssCompassBaselineFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto velN_tmp = StringUtils::fromString<float>(start, end);
-    if (!velN_tmp.has_value()) { return true; }
-    velN = velN_tmp.value();
+constexpr auto gnssCompassEstBaselineFields = std::make_tuple(&GnssCompassEstBaseline::estBaselineComplete, &GnssCompassEstBaseline::resv,
+                                                              &GnssCompassEstBaseline::numMeas, &GnssCompassEstBaseline::positionX,
+                                                              &GnssCompassEstBaseline::positionY, &GnssCompassEstBaseline::positionZ,
+                                                              &GnssCompassEstBaseline::uncertaintyX, &GnssCompassEstBaseline::uncertaintyY,
+                                                              &GnssCompassEstBaseline::uncertaintyZ);
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto velE_tmp = StringUtils::fromString<float>(start, end);
-    if (!velE_tmp.has_value()) { return true; }
-    velE = velE_tmp.value();
+bool GnssCompassEstBaseline::fromString(const AsciiMessage& response) { return parseFields(response, *this, gnssCompassEstBaselineFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto velD_tmp = StringUtils::fromString<float>(start, end);
-    if (!velD_tmp.has_value()) { return true; }
-    velD = velD_tmp.value();
+constexpr auto gnssCompassStartupStatusFields = std::make_tuple(&GnssCompassStartupStatus::percentComplete,
+                                                                &GnssCompassStartupStatus::currentHeading);
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto accelX_tmp = StringUtils::fromString<float>(start, end);
-    if (!accelX_tmp.has_value()) { return true; }
-    accelX = accelX_tmp.value();
+bool GnssCompassStartupStatus::fromString(const AsciiMessage& response) { return parseFields(response, *this, gnssCompassStartupStatusFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto accelY_tmp = StringUtils::fromString<float>(start, end);
-    if (!accelY_tmp.has_value()) { return true; }
-    accelY = accelY_tmp.value();
+}  // namespace GNSSCompass
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto accelZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!accelZ_tmp.has_value()) { return true; }
-    accelZ = accelZ_tmp.value();
+namespace HardSoftIronEstimator
+{
+constexpr auto realTimeHsiControlFields = std::make_tuple(decimal<uint8_t>(&RealTimeHsiControl::mode),
+                                                          decimal<uint8_t>(&RealTimeHsiControl::applyCompensation),
+                                                          &RealTimeHsiControl::convergeRate);
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroX_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroX_tmp.has_value()) { return true; }
-    gyroX = gyroX_tmp.value();
+bool RealTimeHsiControl::fromString(const AsciiMessage& response) { return parseFields(response, *this, realTimeHsiControlFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroY_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroY_tmp.has_value()) { return true; }
-    gyroY = gyroY_tmp.value();
+AsciiMessage RealTimeHsiControl::toString() const { return formatFields(*this, realTimeHsiControlFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroZ_tmp.has_value()) { return true; }
-    gyroZ = gyroZ_tmp.value();
+constexpr auto estMagCalFields = std::make_tuple(&EstMagCal::magGain00, &EstMagCal::magGain01, &EstMagCal::magGain02, &EstMagCal::magGain10,
+                                                 &EstMagCal::magGain11, &EstMagCal::magGain12, &EstMagCal::magGain20, &EstMagCal::magGain21,
+                                                 &EstMagCal::magGain22, &EstMagCal::magBiasX, &EstMagCal::magBiasY, &EstMagCal::magBiasZ);
 
-    return false;  // no errors occurred
-}
+bool EstMagCal::fromString(const AsciiMessage& response) { return parseFields(response, *this, estMagCalFields); }
+
+}  // namespace HardSoftIronEstimator
 
-bool InsStateEcef::fromString(const AsciiMessage& response)
+namespace Heave
 {
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 15 + 1) { return true; }
+constexpr auto heaveOutputsFields = std::make_tuple(&HeaveOutputs::heave, &HeaveOutputs::heaveRate, &HeaveOutputs::delayedHeave);
 
-    int index = 0;
-    const char* start;
-    const char* end;
+bool HeaveOutputs::fromString(const AsciiMessage& response) { return parseFields(response, *this, heaveOutputsFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto yaw_tmp = StringUtils::fromString<float>(start, end);
-    if (!yaw_tmp.has_value()) { return true; }
-    yaw = yaw_tmp.value();
+constexpr auto heaveBasicConfigFields = std::make_tuple(&HeaveBasicConfig::initialWavePeriod, &HeaveBasicConfig::initialWaveAmplitude,
+                                                        &HeaveBasicConfig::maxWavePeriod, &HeaveBasicConfig::minWaveAmplitude,
+                                                        &HeaveBasicConfig::delayedHeaveCutoffFreq, &HeaveBasicConfig::heaveCutoffFreq,
+                                                        &HeaveBasicConfig::heaveRateCutoffFreq);
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto pitch_tmp = StringUtils::fromString<float>(start, end);
-    if (!pitch_tmp.has_value()) { return true; }
-    pitch = pitch_tmp.value();
+bool HeaveBasicConfig::fromString(const AsciiMessage& response) { return parseFields(response, *this, heaveBasicConfigFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto roll_tmp = StringUtils::fromString<float>(start, end);
-    if (!roll_tmp.has_value()) { return true; }
-    roll = roll_tmp.value();
+AsciiMessage HeaveBasicConfig::toString() const { return formatFields(*this, heaveBasicConfigFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto posEx_tmp = StringUtils::fromString<double>(start, end);
-    if (!posEx_tmp.has_value()) { return true; }
-    posEx = posEx_tmp.value();
+}  // namespace Heave
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto posEy_tmp = StringUtils::fromString<double>(start, end);
-    if (!posEy_tmp.has_value()) { return true; }
-    posEy = posEy_tmp.value();
+namespace IMU
+{
+constexpr auto magFields = std::make_tuple(&Mag::magX, &Mag::magY, &Mag::magZ);
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto posEz_tmp = StringUtils::fromString<double>(start, end);
-    if (!posEz_tmp.has_value()) { return true; }
-    posEz = posEz_tmp.value();
+bool Mag::fromString(const AsciiMessage& response) { return parseFields(response, *this, magFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto velEx_tmp = StringUtils::fromString<float>(start, end);
-    if (!velEx_tmp.has_value()) { return true; }
-    velEx = velEx_tmp.value();
+constexpr auto accelFields = std::make_tuple(&Accel::accelX, &Accel::accelY, &Accel::accelZ);
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto velEy_tmp = StringUtils::fromString<float>(start, end);
-    if (!velEy_tmp.has_value()) { return true; }
-    velEy = velEy_tmp.value();
+bool Accel::fromString(const AsciiMessage& response) { return parseFields(response, *this, accelFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto velEz_tmp = StringUtils::fromString<float>(start, end);
-    if (!velEz_tmp.has_value()) { return true; }
-    velEz = velEz_tmp.value();
+constexpr auto gyroFields = std::make_tuple(&Gyro::gyroX, &Gyro::gyroY, &Gyro::gyroZ);
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto accelX_tmp = StringUtils::fromString<float>(start, end);
-    if (!accelX_tmp.has_value()) { return true; }
-    accelX = accelX_tmp.value();
+bool Gyro::fromString(const AsciiMessage& response) { return parseFields(response, *this, gyroFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto accelY_tmp = StringUtils::fromString<float>(start, end);
-    if (!accelY_tmp.has_value()) { return true; }
-    accelY = accelY_tmp.value();
+constexpr auto magAccelGyroFields = std::make_tuple(&MagAccelGyro::magX, &MagAccelGyro::magY, &MagAccelGyro::magZ, &MagAccelGyro::accelX,
+                                                    &MagAccelGyro::accelY, &MagAccelGyro::accelZ, &MagAccelGyro::gyroX, &MagAccelGyro::gyroY,
+                                                    &MagAccelGyro::gyroZ);
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto accelZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!accelZ_tmp.has_value()) { return true; }
-    accelZ = accelZ_tmp.value();
+bool MagAccelGyro::fromString(const AsciiMessage& response) { return parseFields(response, *this, magAccelGyroFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroX_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroX_tmp.has_value()) { return true; }
-    gyroX = gyroX_tmp.value();
+constexpr auto magCalFields = std::make_tuple(&MagCal::magGain00, &MagCal::magGain01, &MagCal::magGain02, &MagCal::magGain10, &MagCal::magGain11,
+                                              &MagCal::magGain12, &MagCal::magGain20, &MagCal::magGain21, &MagCal::magGain22, &MagCal::magBiasX,
+                                              &MagCal::magBiasY, &MagCal::magBiasZ);
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroY_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroY_tmp.has_value()) { return true; }
-    gyroY = gyroY_tmp.value();
+bool MagCal::fromString(const AsciiMessage& response) { return parseFields(response, *this, magCalFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroZ_tmp.has_value()) { return true; }
-    gyroZ = gyroZ_tmp.value();
+AsciiMessage MagCal::toString() const { return formatFields(*this, magCalFields); }
 
-    return false;  // no errors occurred
-}
+constexpr auto accelCalFields = std::make_tuple(&AccelCal::accelGain00, &AccelCal::accelGain01, &AccelCal::accelGain02, &AccelCal::accelGain10,
+                                                &AccelCal::accelGain11, &AccelCal::accelGain12, &AccelCal::accelGain20, &AccelCal::accelGain21,
+                                                &AccelCal::accelGain22, &AccelCal::accelBiasX, &AccelCal::accelBiasY, &AccelCal::accelBiasZ);
 
-bool FilterStartupBias::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 7 + 1) { return true; }
+bool AccelCal::fromString(const AsciiMessage& response) { return parseFields(response, *this, accelCalFields); }
 
-    int index = 0;
-    const char* start;
-    const char* end;
+AsciiMessage AccelCal::toString() const { return formatFields(*this, accelCalFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroBiasX_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroBiasX_tmp.has_value()) { return true; }
-    gyroBiasX = gyroBiasX_tmp.value();
+constexpr auto refFrameRotFields = std::make_tuple(&RefFrameRot::rfr00, &RefFrameRot::rfr01, &RefFrameRot::rfr02, &RefFrameRot::rfr10,
+                                                   &RefFrameRot::rfr11, &RefFrameRot::rfr12, &RefFrameRot::rfr20, &RefFrameRot::rfr21,
+                                                   &RefFrameRot::rfr22);
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroBiasY_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroBiasY_tmp.has_value()) { return true; }
-    gyroBiasY = gyroBiasY_tmp.value();
+bool RefFrameRot::fromString(const AsciiMessage& response) { return parseFields(response, *this, refFrameRotFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gyroBiasZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!gyroBiasZ_tmp.has_value()) { return true; }
-    gyroBiasZ = gyroBiasZ_tmp.value();
+AsciiMessage RefFrameRot::toString() const { return formatFields(*this, refFrameRotFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto accelBiasX_tmp = StringUtils::fromString<float>(start, end);
-    if (!accelBiasX_tmp.has_value()) { return true; }
-    accelBiasX = accelBiasX_tmp.value();
+constexpr auto imuMeasFields = std::make_tuple(&ImuMeas::uncompMagX, &ImuMeas::uncompMagY, &ImuMeas::uncompMagZ, &ImuMeas::uncompAccX,
+                                               &ImuMeas::uncompAccY, &ImuMeas::uncompAccZ, &ImuMeas::uncompGyroX, &ImuMeas::uncompGyroY,
+                                               &ImuMeas::uncompGyroZ, &ImuMeas::temperature, &ImuMeas::pressure);
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto accelBiasY_tmp = StringUtils::fromString<float>(start, end);
-    if (!accelBiasY_tmp.has_value()) { return true; }
-    accelBiasY = accelBiasY_tmp.value();
+bool ImuMeas::fromString(const AsciiMessage& response) { return parseFields(response, *this, imuMeasFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto accelBiasZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!accelBiasZ_tmp.has_value()) { return true; }
-    accelBiasZ = accelBiasZ_tmp.value();
+constexpr auto deltaThetaVelocityFields = std::make_tuple(&DeltaThetaVelocity::deltaTime, &DeltaThetaVelocity::deltaThetaX,
+                                                          &DeltaThetaVelocity::deltaThetaY, &DeltaThetaVelocity::deltaThetaZ,
+                                                          &DeltaThetaVelocity::deltaVelX, &DeltaThetaVelocity::deltaVelY,
+                                                          &DeltaThetaVelocity::deltaVelZ);
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto presBias_tmp = StringUtils::fromString<float>(start, end);
-    if (!presBias_tmp.has_value()) { return true; }
-    presBias = presBias_tmp.value();
+bool DeltaThetaVelocity::fromString(const AsciiMessage& response) { return parseFields(response, *this, deltaThetaVelocityFields); }
 
-    return false;  // no errors occurred
-}
+constexpr auto deltaThetaVelConfigFields = std::make_tuple(decimal<uint8_t>(&DeltaThetaVelConfig::integrationFrame),
+                                                           decimal<uint8_t>(&DeltaThetaVelConfig::gyroCompensation),
+                                                           decimal<uint8_t>(&DeltaThetaVelConfig::accelCompensation),
+                                                           decimal<uint8_t>(&DeltaThetaVelConfig::earthRateCompensation), &DeltaThetaVelConfig::resv);
 
-AsciiMessage FilterStartupBias::toString() const
-{
-    AsciiMessage result = "";
+bool DeltaThetaVelConfig::fromString(const AsciiMessage& response) { return parseFields(response, *this, deltaThetaVelConfigFields); }
 
-    // verify that all fields have a value set
-    if (gyroBiasX.has_value() && gyroBiasY.has_value() && gyroBiasZ.has_value() && accelBiasX.has_value() && accelBiasY.has_value() && accelBiasZ.has_value() &&
-        presBias.has_value())
-    {
-        std::snprintf(result.begin(), result.capacity(), "%f,%f,%f,%f,%f,%f,%f", gyroBiasX.value(), gyroBiasY.value(), gyroBiasZ.value(), accelBiasX.value(),
-                      accelBiasY.value(), accelBiasZ.value(), presBias.value());
-    }
+AsciiMessage DeltaThetaVelConfig::toString() const { return formatFields(*this, deltaThetaVelConfigFields); }
 
-    return result;
-}
+constexpr auto gyroCalFields = std::make_tuple(&GyroCal::gyroGain00, &GyroCal::gyroGain01, &GyroCal::gyroGain02, &GyroCal::gyroGain10,
+                                               &GyroCal::gyroGain11, &GyroCal::gyroGain12, &GyroCal::gyroGain20, &GyroCal::gyroGain21,
+                                               &GyroCal::gyroGain22, &GyroCal::gyroBiasX, &GyroCal::gyroBiasY, &GyroCal::gyroBiasZ);
 
-bool InsRefOffset::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 6 + 1) { return true; }
+bool GyroCal::fromString(const AsciiMessage& response) { return parseFields(response, *this, gyroCalFields); }
 
-    int index = 0;
-    const char* start;
-    const char* end;
+AsciiMessage GyroCal::toString() const { return formatFields(*this, gyroCalFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto refOffsetX_tmp = StringUtils::fromString<float>(start, end);
-    if (!refOffsetX_tmp.has_value()) { return true; }
-    refOffsetX = refOffsetX_tmp.value();
+constexpr auto imuFilterControlFields = std::make_tuple(&ImuFilterControl::magWindowSize, &ImuFilterControl::accelWindowSize,
+                                                        &ImuFilterControl::gyroWindowSize, &ImuFilterControl::tempWindowSize,
+                                                        &ImuFilterControl::presWindowSize, decimal<uint8_t>(&ImuFilterControl::magFilterMode),
+                                                        decimal<uint8_t>(&ImuFilterControl::accelFilterMode),
+                                                        decimal<uint8_t>(&ImuFilterControl::gyroFilterMode),
+                                                        decimal<uint8_t>(&ImuFilterControl::tempFilterMode),
+                                                        decimal<uint8_t>(&ImuFilterControl::presFilterMode));
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto refOffsetY_tmp = StringUtils::fromString<float>(start, end);
-    if (!refOffsetY_tmp.has_value()) { return true; }
-    refOffsetY = refOffsetY_tmp.value();
+bool ImuFilterControl::fromString(const AsciiMessage& response) { return parseFields(response, *this, imuFilterControlFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto refOffsetZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!refOffsetZ_tmp.has_value()) { return true; }
-    refOffsetZ = refOffsetZ_tmp.value();
+AsciiMessage ImuFilterControl::toString() const { return formatFields(*this, imuFilterControlFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto refUncertX_tmp = StringUtils::fromString<float>(start, end);
-    if (!refUncertX_tmp.has_value()) { return true; }
-    refUncertX = refUncertX_tmp.value();
+}  // namespace IMU
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto refUncertY_tmp = StringUtils::fromString<float>(start, end);
-    if (!refUncertY_tmp.has_value()) { return true; }
-    refUncertY = refUncertY_tmp.value();
+namespace INS
+{
+constexpr auto insSolLlaFields = std::make_tuple(&InsSolLla::timeGpsTow, &InsSolLla::timeGpsWeek, hex<uint16_t>(&InsSolLla::insStatus),
+                                                 &InsSolLla::yaw, &InsSolLla::pitch, &InsSolLla::roll, &InsSolLla::posLat, &InsSolLla::posLon,
+                                                 &InsSolLla::posAlt, &InsSolLla::velN, &InsSolLla::velE, &InsSolLla::velD, &InsSolLla::attUncertainty,
+                                                 &InsSolLla::posUncertainty, &InsSolLla::velUncertainty);
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto refUncertZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!refUncertZ_tmp.has_value()) { return true; }
-    refUncertZ = refUncertZ_tmp.value();
+bool InsSolLla::fromString(const AsciiMessage& response) { return parseFields(response, *this, insSolLlaFields); }
 
-    return false;  // no errors occurred
-}
+constexpr auto insSolEcefFields = std::make_tuple(&InsSolEcef::timeGpsTow, &InsSolEcef::timeGpsWeek, hex<uint16_t>(&InsSolEcef::insStatus),
+                                                  &InsSolEcef::yaw, &InsSolEcef::pitch, &InsSolEcef::roll, &InsSolEcef::posEx, &InsSolEcef::posEy,
+                                                  &InsSolEcef::posEz, &InsSolEcef::velEx, &InsSolEcef::velEy, &InsSolEcef::velEz,
+                                                  &InsSolEcef::attUncertainty, &InsSolEcef::posUncertainty, &InsSolEcef::velUncertainty);
 
-AsciiMessage InsRefOffset::toString() const
-{
-    AsciiMessage result = "";
+bool InsSolEcef::fromString(const AsciiMessage& response) { return parseFields(response, *this, insSolEcefFields); }
 
-    // verify that all fields have a value set
-    if (refOffsetX.has_value() && refOffsetY.has_value() && refOffsetZ.has_value() && refUncertX.has_value() && refUncertY.has_value() &&
-        refUncertZ.has_value())
-    {
-        std::snprintf(result.begin(), result.capacity(), "%f,%f,%f,%f,%f,%f", refOffsetX.value(), refOffsetY.value(), refOffsetZ.value(), refUncertX.value(),
-                      refUncertY.value(), refUncertZ.value());
-    }
+constexpr auto insBasicConfigFields = std::make_tuple(decimal<uint8_t>(&InsBasicConfig::scenario), decimal<uint8_t>(&InsBasicConfig::ahrsAiding),
+                                                      decimal<uint8_t>(&InsBasicConfig::estBaseline), &InsBasicConfig::resv);
 
-    return result;
-}
+bool InsBasicConfig::fromString(const AsciiMessage& response) { return parseFields(response, *this, insBasicConfigFields); }
 
-bool InsGnssSelect::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 6 + 1) { return true; }
+AsciiMessage InsBasicConfig::toString() const { return formatFields(*this, insBasicConfigFields); }
 
-    int index = 0;
-    const char* start;
-    const char* end;
+constexpr auto insStateLlaFields = std::make_tuple(&InsStateLla::yaw, &InsStateLla::pitch, &InsStateLla::roll, &InsStateLla::posLat,
+                                                   &InsStateLla::posLon, &InsStateLla::posAlt, &InsStateLla::velN, &InsStateLla::velE,
+                                                   &InsStateLla::velD, &InsStateLla::accelX, &InsStateLla::accelY, &InsStateLla::accelZ,
+                                                   &InsStateLla::gyroX, &InsStateLla::gyroY, &InsStateLla::gyroZ);
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto activeReceiverSelect_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!activeReceiverSelect_tmp.has_value()) { return true; }
-    activeReceiverSelect = static_cast<InsGnssSelect::ActiveReceiverSelect>(activeReceiverSelect_tmp.value());
+bool InsStateLla::fromString(const AsciiMessage& response) { return parseFields(response, *this, insStateLlaFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto usedForNavTime_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!usedForNavTime_tmp.has_value()) { return true; }
-    usedForNavTime = usedForNavTime_tmp.value();
+constexpr auto insStateEcefFields = std::make_tuple(&InsStateEcef::yaw, &InsStateEcef::pitch, &InsStateEcef::roll, &InsStateEcef::posEx,
+                                                    &InsStateEcef::posEy, &InsStateEcef::posEz, &InsStateEcef::velEx, &InsStateEcef::velEy,
+                                                    &InsStateEcef::velEz, &InsStateEcef::accelX, &InsStateEcef::accelY, &InsStateEcef::accelZ,
+                                                    &InsStateEcef::gyroX, &InsStateEcef::gyroY, &InsStateEcef::gyroZ);
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto hysteresisTime_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!hysteresisTime_tmp.has_value()) { return true; }
-    hysteresisTime = hysteresisTime_tmp.value();
+bool InsStateEcef::fromString(const AsciiMessage& response) { return parseFields(response, *this, insStateEcefFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto useGnssCompass_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!useGnssCompass_tmp.has_value()) { return true; }
-    useGnssCompass = static_cast<InsGnssSelect::UseGnssCompass>(useGnssCompass_tmp.value());
+constexpr auto filterStartupBiasFields = std::make_tuple(&FilterStartupBias::gyroBiasX, &FilterStartupBias::gyroBiasY, &FilterStartupBias::gyroBiasZ,
+                                                         &FilterStartupBias::accelBiasX, &FilterStartupBias::accelBiasY,
+                                                         &FilterStartupBias::accelBiasZ, &FilterStartupBias::presBias);
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto resv1_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!resv1_tmp.has_value()) { return true; }
-    resv1 = resv1_tmp.value();
+bool FilterStartupBias::fromString(const AsciiMessage& response) { return parseFields(response, *this, filterStartupBiasFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto resv2_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!resv2_tmp.has_value()) { return true; }
-    resv2 = resv2_tmp.value();
+AsciiMessage FilterStartupBias::toString() const { return formatFields(*this, filterStartupBiasFields); }
 
-    return false;  // no errors occurred
-}
+constexpr auto insRefOffsetFields = std::make_tuple(&InsRefOffset::refOffsetX, &InsRefOffset::refOffsetY, &InsRefOffset::refOffsetZ,
+                                                    &InsRefOffset::refUncertX, &InsRefOffset::refUncertY, &InsRefOffset::refUncertZ);
 
-AsciiMessage InsGnssSelect::toString() const
-{
-    AsciiMessage result = "";
+bool InsRefOffset::fromString(const AsciiMessage& response) { return parseFields(response, *this, insRefOffsetFields); }
 
-    // verify that all fields have a value set
-    if (activeReceiverSelect.has_value() && usedForNavTime.has_value() && hysteresisTime.has_value() && useGnssCompass.has_value() && resv1.has_value() &&
-        resv2.has_value())
-    {
-        std::snprintf(result.begin(), result.capacity(), "%u,%u,%u,%u,%u,%u", static_cast<uint8_t>(activeReceiverSelect.value()), usedForNavTime.value(),
-                      hysteresisTime.value(), static_cast<uint8_t>(useGnssCompass.value()), resv1.value(), resv2.value());
-    }
+AsciiMessage InsRefOffset::toString() const { return formatFields(*this, insRefOffsetFields); }
 
-    return result;
-}
+constexpr auto insGnssSelectFields = std::make_tuple(decimal<uint8_t>(&InsGnssSelect::activeReceiverSelect), &InsGnssSelect::usedForNavTime,
+                                                     &InsGnssSelect::hysteresisTime, decimal<uint8_t>(&InsGnssSelect::useGnssCompass),
+                                                     &InsGnssSelect::resv1, &InsGnssSelect::resv2);
+
+bool InsGnssSelect::fromString(const AsciiMessage& response) { return parseFields(response, *this, insGnssSelectFields); }
+
+AsciiMessage InsGnssSelect::toString() const { return formatFields(*this, insGnssSelectFields); }
 
 }  // namespace INS
 
@@ -3442,23 +947,9 @@ bool HwVer::fromString(const AsciiMessage& response)
     return false;  // no errors occurred
 }
 
-bool Serial::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 1 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto serialNum_tmp = StringUtils::fromString<uint32_t>(start, end);
-    if (!serialNum_tmp.has_value()) { return true; }
-    serialNum = serialNum_tmp.value();
+constexpr auto serialFields = std::make_tuple(&Serial::serialNum);
 
-    return false;  // no errors occurred
-}
+bool Serial::fromString(const AsciiMessage& response) { return parseFields(response, *this, serialFields); }
 
 bool FwVer::fromString(const AsciiMessage& response)
 {
@@ -3593,132 +1084,9 @@ bool AsyncOutputFreq::fromString(const AsciiMessage& response)
     const auto tokens = findIndexOfFieldSeparators(response);
     if (tokens.size() != 2 + 1)
     {
-        // This register may not have an optional field
-        if (tokens.size() != 1 + 1) { return true; }
-    }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto adof_tmp = StringUtils::fromString<uint32_t>(start, end);
-    if (!adof_tmp.has_value()) { return true; }
-    adof = static_cast<AsyncOutputFreq::Adof>(adof_tmp.value());
-
-    if (tokens.size() == (2 + 1))
-    {
-        // This is an optional parameter.
-        start = tokens[index++] + 1;
-        end = tokens[index];
-        const auto serialPort_tmp = StringUtils::fromString<uint8_t>(start, end);
-        if (!serialPort_tmp.has_value()) { return true; }
-        serialPort = static_cast<AsyncOutputFreq::SerialPort>(serialPort_tmp.value());
-    }
-
-    return false;  // no errors occurred
-}
-
-AsciiMessage AsyncOutputFreq::toString() const
-{
-    AsciiMessage result = "";
-
-    // verify that all fields have a value set
-    if (adof.has_value())
-    {
-        if (serialPort == SerialPort::Poll) { std::snprintf(result.begin(), result.capacity(), "%u,?", static_cast<uint32_t>(adof.value())); }
-        else if (serialPort == SerialPort::ActiveSerial) { std::snprintf(result.begin(), result.capacity(), "%u", static_cast<uint32_t>(adof.value())); }
-        else { std::snprintf(result.begin(), result.capacity(), "%u,%u", static_cast<uint32_t>(adof.value()), static_cast<uint8_t>(serialPort)); }
-    }
-    return result;
-}
-
-GenericCommand AsyncOutputFreq::toReadCommand()
-{
-    AsciiMessage commandString;
-    if (serialPort == SerialPort::Poll) { std::snprintf(commandString.begin(), commandString.capacity(), "RRG,%02d,?", _id); }
-    else { std::snprintf(commandString.begin(), commandString.capacity(), "RRG,%02d,%1d", _id, static_cast<uint8_t>(serialPort)); }
-
-    GenericCommand readCommand(commandString, 6);
-    return readCommand;
-}
-
-bool ProtocolControl::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 7 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto asciiAppendCount_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!asciiAppendCount_tmp.has_value()) { return true; }
-    asciiAppendCount = static_cast<ProtocolControl::AsciiAppendCount>(asciiAppendCount_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto asciiAppendStatus_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!asciiAppendStatus_tmp.has_value()) { return true; }
-    asciiAppendStatus = static_cast<ProtocolControl::AsciiAppendStatus>(asciiAppendStatus_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto spiAppendCount_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!spiAppendCount_tmp.has_value()) { return true; }
-    spiAppendCount = static_cast<ProtocolControl::SpiAppendCount>(spiAppendCount_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto spiAppendStatus_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!spiAppendStatus_tmp.has_value()) { return true; }
-    spiAppendStatus = static_cast<ProtocolControl::SpiAppendStatus>(spiAppendStatus_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto asciiChecksum_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!asciiChecksum_tmp.has_value()) { return true; }
-    asciiChecksum = static_cast<ProtocolControl::AsciiChecksum>(asciiChecksum_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto spiChecksum_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!spiChecksum_tmp.has_value()) { return true; }
-    spiChecksum = static_cast<ProtocolControl::SpiChecksum>(spiChecksum_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto errorMode_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!errorMode_tmp.has_value()) { return true; }
-    errorMode = static_cast<ProtocolControl::ErrorMode>(errorMode_tmp.value());
-
-    return false;  // no errors occurred
-}
-
-AsciiMessage ProtocolControl::toString() const
-{
-    AsciiMessage result = "";
-
-    // verify that all fields have a value set
-    if (asciiAppendCount.has_value() && asciiAppendStatus.has_value() && spiAppendCount.has_value() && spiAppendStatus.has_value() &&
-        asciiChecksum.has_value() && spiChecksum.has_value() && errorMode.has_value())
-    {
-        std::snprintf(result.begin(), result.capacity(), "%u,%u,%u,%u,%u,%u,%u", static_cast<uint8_t>(asciiAppendCount.value()),
-                      static_cast<uint8_t>(asciiAppendStatus.value()), static_cast<uint8_t>(spiAppendCount.value()),
-                      static_cast<uint8_t>(spiAppendStatus.value()), static_cast<uint8_t>(asciiChecksum.value()), static_cast<uint8_t>(spiChecksum.value()),
-                      static_cast<uint8_t>(errorMode.value()));
-    }
-
-    return result;
-}
-
-bool SyncControl::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 9 + 1) { return true; }
+        // This register may not have an optional field
+        if (tokens.size() != 1 + 1) { return true; }
+    }
 
     int index = 0;
     const char* start;
@@ -3726,106 +1094,71 @@ bool SyncControl::fromString(const AsciiMessage& response)
 
     start = tokens[index++] + 1;
     end = tokens[index];
-    const auto syncInMode_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!syncInMode_tmp.has_value()) { return true; }
-    syncInMode = static_cast<SyncControl::SyncInMode>(syncInMode_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto syncInEdge_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!syncInEdge_tmp.has_value()) { return true; }
-    syncInEdge = static_cast<SyncControl::SyncInEdge>(syncInEdge_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto syncInSkipFactor_tmp = StringUtils::fromString<uint16_t>(start, end);
-    if (!syncInSkipFactor_tmp.has_value()) { return true; }
-    syncInSkipFactor = syncInSkipFactor_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto resv1_tmp = StringUtils::fromString<uint32_t>(start, end);
-    if (!resv1_tmp.has_value()) { return true; }
-    resv1 = resv1_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto syncOutMode_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!syncOutMode_tmp.has_value()) { return true; }
-    syncOutMode = static_cast<SyncControl::SyncOutMode>(syncOutMode_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto syncOutPolarity_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!syncOutPolarity_tmp.has_value()) { return true; }
-    syncOutPolarity = static_cast<SyncControl::SyncOutPolarity>(syncOutPolarity_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto syncOutSkipFactor_tmp = StringUtils::fromString<uint16_t>(start, end);
-    if (!syncOutSkipFactor_tmp.has_value()) { return true; }
-    syncOutSkipFactor = syncOutSkipFactor_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto syncOutPulseWidth_tmp = StringUtils::fromString<uint32_t>(start, end);
-    if (!syncOutPulseWidth_tmp.has_value()) { return true; }
-    syncOutPulseWidth = syncOutPulseWidth_tmp.value();
+    const auto adof_tmp = StringUtils::fromString<uint32_t>(start, end);
+    if (!adof_tmp.has_value()) { return true; }
+    adof = static_cast<AsyncOutputFreq::Adof>(adof_tmp.value());
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto resv2_tmp = StringUtils::fromString<uint32_t>(start, end);
-    if (!resv2_tmp.has_value()) { return true; }
-    resv2 = resv2_tmp.value();
+    if (tokens.size() == (2 + 1))
+    {
+        // This is an optional parameter.
+        start = tokens[index++] + 1;
+        end = tokens[index];
+        const auto serialPort_tmp = StringUtils::fromString<uint8_t>(start, end);
+        if (!serialPort_tmp.has_value()) { return true; }
+        serialPort = static_cast<AsyncOutputFreq::SerialPort>(serialPort_tmp.value());
+    }
 
     return false;  // no errors occurred
 }
 
-AsciiMessage SyncControl::toString() const
+AsciiMessage AsyncOutputFreq::toString() const
 {
     AsciiMessage result = "";
 
     // verify that all fields have a value set
-    if (syncInMode.has_value() && syncInEdge.has_value() && syncInSkipFactor.has_value() && resv1.has_value() && syncOutMode.has_value() &&
-        syncOutPolarity.has_value() && syncOutSkipFactor.has_value() && syncOutPulseWidth.has_value() && resv2.has_value())
+    if (adof.has_value())
     {
-        std::snprintf(result.begin(), result.capacity(), "%u,%u,%u,%u,%u,%u,%u,%u,%u", static_cast<uint8_t>(syncInMode.value()),
-                      static_cast<uint8_t>(syncInEdge.value()), syncInSkipFactor.value(), resv1.value(), static_cast<uint8_t>(syncOutMode.value()),
-                      static_cast<uint8_t>(syncOutPolarity.value()), syncOutSkipFactor.value(), syncOutPulseWidth.value(), resv2.value());
+        if (serialPort == SerialPort::Poll) { std::snprintf(result.begin(), result.capacity(), "%u,?", static_cast<uint32_t>(adof.value())); }
+        else if (serialPort == SerialPort::ActiveSerial) { std::snprintf(result.begin(), result.capacity(), "%u", static_cast<uint32_t>(adof.value())); }
+        else { std::snprintf(result.begin(), result.capacity(), "%u,%u", static_cast<uint32_t>(adof.value()), static_cast<uint8_t>(serialPort)); }
     }
-
     return result;
 }
 
-bool SyncStatus::fromString(const AsciiMessage& response)
+GenericCommand AsyncOutputFreq::toReadCommand()
 {
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 3 + 1) { return true; }
+    AsciiMessage commandString;
+    if (serialPort == SerialPort::Poll) { std::snprintf(commandString.begin(), commandString.capacity(), "RRG,%02d,?", _id); }
+    else { std::snprintf(commandString.begin(), commandString.capacity(), "RRG,%02d,%1d", _id, static_cast<uint8_t>(serialPort)); }
 
-    int index = 0;
-    const char* start;
-    const char* end;
+    GenericCommand readCommand(commandString, 6);
+    return readCommand;
+}
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto syncInCount_tmp = StringUtils::fromString<uint32_t>(start, end);
-    if (!syncInCount_tmp.has_value()) { return true; }
-    syncInCount = syncInCount_tmp.value();
+constexpr auto protocolControlFields = std::make_tuple(decimal<uint8_t>(&ProtocolControl::asciiAppendCount),
+                                                       decimal<uint8_t>(&ProtocolControl::asciiAppendStatus),
+                                                       decimal<uint8_t>(&ProtocolControl::spiAppendCount),
+                                                       decimal<uint8_t>(&ProtocolControl::spiAppendStatus),
+                                                       decimal<uint8_t>(&ProtocolControl::asciiChecksum),
+                                                       decimal<uint8_t>(&ProtocolControl::spiChecksum),
+                                                       decimal<uint8_t>(&ProtocolControl::errorMode));
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto syncInTime_tmp = StringUtils::fromString<uint32_t>(start, end);
-    if (!syncInTime_tmp.has_value()) { return true; }
-    syncInTime = syncInTime_tmp.value();
+bool ProtocolControl::fromString(const AsciiMessage& response) { return parseFields(response, *this, protocolControlFields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto syncOutCount_tmp = StringUtils::fromString<uint32_t>(start, end);
-    if (!syncOutCount_tmp.has_value()) { return true; }
-    syncOutCount = syncOutCount_tmp.value();
+AsciiMessage ProtocolControl::toString() const { return formatFields(*this, protocolControlFields); }
 
-    return false;  // no errors occurred
-}
+constexpr auto syncControlFields = std::make_tuple(decimal<uint8_t>(&SyncControl::syncInMode), decimal<uint8_t>(&SyncControl::syncInEdge),
+                                                   &SyncControl::syncInSkipFactor, &SyncControl::resv1, decimal<uint8_t>(&SyncControl::syncOutMode),
+                                                   decimal<uint8_t>(&SyncControl::syncOutPolarity), &SyncControl::syncOutSkipFactor,
+                                                   &SyncControl::syncOutPulseWidth, &SyncControl::resv2);
+
+bool SyncControl::fromString(const AsciiMessage& response) { return parseFields(response, *this, syncControlFields); }
+
+AsciiMessage SyncControl::toString() const { return formatFields(*this, syncControlFields); }
+
+constexpr auto syncStatusFields = std::make_tuple(&SyncStatus::syncInCount, &SyncStatus::syncInTime, &SyncStatus::syncOutCount);
+
+bool SyncStatus::fromString(const AsciiMessage& response) { return parseFields(response, *this, syncStatusFields); }
 
 bool BinaryOutput::fromString(const AsciiMessage& response)
 {
@@ -4131,343 +1464,60 @@ BinaryHeader BinaryOutputMeasurements::toBinaryHeader() const noexcept
 
 Vector<uint8_t, binaryHeaderMaxLength> BinaryOutputMeasurements::toHeaderBytes() const noexcept { return this->toBinaryHeader().toHeaderBytes(); }
 
-bool NmeaOutput1::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 5 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto port_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!port_tmp.has_value()) { return true; }
-    port = static_cast<NmeaOutput1::Port>(port_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto rate_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!rate_tmp.has_value()) { return true; }
-    rate = static_cast<NmeaOutput1::Rate>(rate_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto mode_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!mode_tmp.has_value()) { return true; }
-    mode = static_cast<NmeaOutput1::Mode>(mode_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnssSelect_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!gnssSelect_tmp.has_value()) { return true; }
-    gnssSelect = static_cast<NmeaOutput1::GnssSelect>(gnssSelect_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto msgSelection_tmp = StringUtils::fromStringHex<uint32_t>(start, end);
-    if (!msgSelection_tmp.has_value()) { return true; }
-    msgSelection = msgSelection_tmp.value();
-
-    return false;  // no errors occurred
-}
-
-AsciiMessage NmeaOutput1::toString() const
-{
-    AsciiMessage result = "";
-
-    // verify that all fields have a value set
-    if (port.has_value() && rate.has_value() && mode.has_value() && gnssSelect.has_value() && msgSelection.has_value())
-    {
-        std::snprintf(result.begin(), result.capacity(), "%u,%u,%u,%u,%X", static_cast<uint8_t>(port.value()), static_cast<uint8_t>(rate.value()),
-                      static_cast<uint8_t>(mode.value()), static_cast<uint8_t>(gnssSelect.value()), uint32_t(msgSelection.value()));
-    }
-
-    return result;
-}
-
-bool NmeaOutput2::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 5 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto port_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!port_tmp.has_value()) { return true; }
-    port = static_cast<NmeaOutput2::Port>(port_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto rate_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!rate_tmp.has_value()) { return true; }
-    rate = static_cast<NmeaOutput2::Rate>(rate_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto mode_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!mode_tmp.has_value()) { return true; }
-    mode = static_cast<NmeaOutput2::Mode>(mode_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnssSelect_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!gnssSelect_tmp.has_value()) { return true; }
-    gnssSelect = static_cast<NmeaOutput2::GnssSelect>(gnssSelect_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto msgSelection_tmp = StringUtils::fromStringHex<uint32_t>(start, end);
-    if (!msgSelection_tmp.has_value()) { return true; }
-    msgSelection = msgSelection_tmp.value();
-
-    return false;  // no errors occurred
-}
-
-AsciiMessage NmeaOutput2::toString() const
-{
-    AsciiMessage result = "";
-
-    // verify that all fields have a value set
-    if (port.has_value() && rate.has_value() && mode.has_value() && gnssSelect.has_value() && msgSelection.has_value())
-    {
-        std::snprintf(result.begin(), result.capacity(), "%u,%u,%u,%u,%X", static_cast<uint8_t>(port.value()), static_cast<uint8_t>(rate.value()),
-                      static_cast<uint8_t>(mode.value()), static_cast<uint8_t>(gnssSelect.value()), uint32_t(msgSelection.value()));
-    }
-
-    return result;
-}
-
-bool LegacyCompatibilitySettings::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 4 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
+constexpr auto nmeaOutput1Fields = std::make_tuple(decimal<uint8_t>(&NmeaOutput1::port), decimal<uint8_t>(&NmeaOutput1::rate),
+                                                   decimal<uint8_t>(&NmeaOutput1::mode), decimal<uint8_t>(&NmeaOutput1::gnssSelect),
+                                                   hex<uint32_t>(&NmeaOutput1::msgSelection));
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto insLegacy_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!insLegacy_tmp.has_value()) { return true; }
-    insLegacy = static_cast<LegacyCompatibilitySettings::InsLegacy>(insLegacy_tmp.value());
+bool NmeaOutput1::fromString(const AsciiMessage& response) { return parseFields(response, *this, nmeaOutput1Fields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto gnssLegacy_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!gnssLegacy_tmp.has_value()) { return true; }
-    gnssLegacy = gnssLegacy_tmp.value();
+AsciiMessage NmeaOutput1::toString() const { return formatFields(*this, nmeaOutput1Fields); }
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto imuLegacy_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!imuLegacy_tmp.has_value()) { return true; }
-    imuLegacy = static_cast<LegacyCompatibilitySettings::ImuLegacy>(imuLegacy_tmp.value());
+constexpr auto nmeaOutput2Fields = std::make_tuple(decimal<uint8_t>(&NmeaOutput2::port), decimal<uint8_t>(&NmeaOutput2::rate),
+                                                   decimal<uint8_t>(&NmeaOutput2::mode), decimal<uint8_t>(&NmeaOutput2::gnssSelect),
+                                                   hex<uint32_t>(&NmeaOutput2::msgSelection));
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto hwLegacy_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!hwLegacy_tmp.has_value()) { return true; }
-    hwLegacy = static_cast<LegacyCompatibilitySettings::HwLegacy>(hwLegacy_tmp.value());
+bool NmeaOutput2::fromString(const AsciiMessage& response) { return parseFields(response, *this, nmeaOutput2Fields); }
 
-    return false;  // no errors occurred
-}
+AsciiMessage NmeaOutput2::toString() const { return formatFields(*this, nmeaOutput2Fields); }
 
-AsciiMessage LegacyCompatibilitySettings::toString() const
-{
-    AsciiMessage result = "";
+constexpr auto legacyCompatibilitySettingsFields = std::make_tuple(decimal<uint8_t>(&LegacyCompatibilitySettings::insLegacy),
+                                                                   decimal<uint8_t>(&LegacyCompatibilitySettings::gnssLegacy),
+                                                                   decimal<uint8_t>(&LegacyCompatibilitySettings::imuLegacy),
+                                                                   decimal<uint8_t>(&LegacyCompatibilitySettings::hwLegacy));
 
-    // verify that all fields have a value set
-    if (insLegacy.has_value() && gnssLegacy.has_value() && imuLegacy.has_value() && hwLegacy.has_value())
-    {
-        std::snprintf(result.begin(), result.capacity(), "%u,%u,%u,%u", static_cast<uint8_t>(insLegacy.value()), uint8_t(gnssLegacy.value()),
-                      static_cast<uint8_t>(imuLegacy.value()), static_cast<uint8_t>(hwLegacy.value()));
-    }
+bool LegacyCompatibilitySettings::fromString(const AsciiMessage& response) { return parseFields(response, *this, legacyCompatibilitySettingsFields); }
 
-    return result;
-}
+AsciiMessage LegacyCompatibilitySettings::toString() const { return formatFields(*this, legacyCompatibilitySettingsFields); }
 
 }  // namespace System
 
 namespace VelocityAiding
 {
-bool VelAidingMeas::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 3 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto velocityX_tmp = StringUtils::fromString<float>(start, end);
-    if (!velocityX_tmp.has_value()) { return true; }
-    velocityX = velocityX_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto velocityY_tmp = StringUtils::fromString<float>(start, end);
-    if (!velocityY_tmp.has_value()) { return true; }
-    velocityY = velocityY_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto velocityZ_tmp = StringUtils::fromString<float>(start, end);
-    if (!velocityZ_tmp.has_value()) { return true; }
-    velocityZ = velocityZ_tmp.value();
-
-    return false;  // no errors occurred
-}
-
-AsciiMessage VelAidingMeas::toString() const
-{
-    AsciiMessage result = "";
-
-    // verify that all fields have a value set
-    if (velocityX.has_value() && velocityY.has_value() && velocityZ.has_value())
-    {
-        std::snprintf(result.begin(), result.capacity(), "%f,%f,%f", velocityX.value(), velocityY.value(), velocityZ.value());
-    }
-
-    return result;
-}
-
-bool VelAidingControl::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 3 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto velAidEnable_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!velAidEnable_tmp.has_value()) { return true; }
-    velAidEnable = static_cast<VelAidingControl::VelAidEnable>(velAidEnable_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto velUncertTuning_tmp = StringUtils::fromString<float>(start, end);
-    if (!velUncertTuning_tmp.has_value()) { return true; }
-    velUncertTuning = velUncertTuning_tmp.value();
+constexpr auto velAidingMeasFields = std::make_tuple(&VelAidingMeas::velocityX, &VelAidingMeas::velocityY, &VelAidingMeas::velocityZ);
 
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto resv_tmp = StringUtils::fromString<float>(start, end);
-    if (!resv_tmp.has_value()) { return true; }
-    resv = resv_tmp.value();
+bool VelAidingMeas::fromString(const AsciiMessage& response) { return parseFields(response, *this, velAidingMeasFields); }
 
-    return false;  // no errors occurred
-}
+AsciiMessage VelAidingMeas::toString() const { return formatFields(*this, velAidingMeasFields); }
 
-AsciiMessage VelAidingControl::toString() const
-{
-    AsciiMessage result = "";
+constexpr auto velAidingControlFields = std::make_tuple(decimal<uint8_t>(&VelAidingControl::velAidEnable), &VelAidingControl::velUncertTuning,
+                                                        &VelAidingControl::resv);
 
-    // verify that all fields have a value set
-    if (velAidEnable.has_value() && velUncertTuning.has_value() && resv.has_value())
-    {
-        std::snprintf(result.begin(), result.capacity(), "%u,%f,%f", static_cast<uint8_t>(velAidEnable.value()), velUncertTuning.value(), resv.value());
-    }
+bool VelAidingControl::fromString(const AsciiMessage& response) { return parseFields(response, *this, velAidingControlFields); }
 
-    return result;
-}
+AsciiMessage VelAidingControl::toString() const { return formatFields(*this, velAidingControlFields); }
 
 }  // namespace VelocityAiding
 
 namespace WorldMagGravityModel
 {
-bool RefModelConfig::fromString(const AsciiMessage& response)
-{
-    const auto tokens = findIndexOfFieldSeparators(response);
-    if (tokens.size() != 9 + 1) { return true; }
-
-    int index = 0;
-    const char* start;
-    const char* end;
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto enableMagModel_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!enableMagModel_tmp.has_value()) { return true; }
-    enableMagModel = static_cast<RefModelConfig::EnableMagModel>(enableMagModel_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto enableGravityModel_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!enableGravityModel_tmp.has_value()) { return true; }
-    enableGravityModel = static_cast<RefModelConfig::EnableGravityModel>(enableGravityModel_tmp.value());
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto resv1_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!resv1_tmp.has_value()) { return true; }
-    resv1 = resv1_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto resv2_tmp = StringUtils::fromString<uint8_t>(start, end);
-    if (!resv2_tmp.has_value()) { return true; }
-    resv2 = resv2_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto recalcThreshold_tmp = StringUtils::fromString<uint32_t>(start, end);
-    if (!recalcThreshold_tmp.has_value()) { return true; }
-    recalcThreshold = recalcThreshold_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto year_tmp = StringUtils::fromString<float>(start, end);
-    if (!year_tmp.has_value()) { return true; }
-    year = year_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto latitude_tmp = StringUtils::fromString<double>(start, end);
-    if (!latitude_tmp.has_value()) { return true; }
-    latitude = latitude_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto longitude_tmp = StringUtils::fromString<double>(start, end);
-    if (!longitude_tmp.has_value()) { return true; }
-    longitude = longitude_tmp.value();
-
-    start = tokens[index++] + 1;
-    end = tokens[index];
-    const auto altitude_tmp = StringUtils::fromString<double>(start, end);
-    if (!altitude_tmp.has_value()) { return true; }
-    altitude = altitude_tmp.value();
-
-    return false;  // no errors occurred
-}
-
-AsciiMessage RefModelConfig::toString() const
-{
-    AsciiMessage result = "";
+constexpr auto refModelConfigFields = std::make_tuple(decimal<uint8_t>(&RefModelConfig::enableMagModel),
+                                                      decimal<uint8_t>(&RefModelConfig::enableGravityModel), &RefModelConfig::resv1,
+                                                      &RefModelConfig::resv2, &RefModelConfig::recalcThreshold, &RefModelConfig::year,
+                                                      &RefModelConfig::latitude, &RefModelConfig::longitude, &RefModelConfig::altitude);
 
-    // verify that all fields have a value set
-    if (enableMagModel.has_value() && enableGravityModel.has_value() && resv1.has_value() && resv2.has_value() && recalcThreshold.has_value() &&
-        year.has_value() && latitude.has_value() && longitude.has_value() && altitude.has_value())
-    {
-        std::snprintf(result.begin(), result.capacity(), "%u,%u,%u,%u,%u,%f,%f,%f,%f", static_cast<uint8_t>(enableMagModel.value()),
-                      static_cast<uint8_t>(enableGravityModel.value()), resv1.value(), resv2.value(), recalcThreshold.value(), year.value(), latitude.value(),
-                      longitude.value(), altitude.value());
-    }
+bool RefModelConfig::fromString(const AsciiMessage& response) { return parseFields(response, *this, refModelConfigFields); }
 
-    return result;
-}
+AsciiMessage RefModelConfig::toString() const { return formatFields(*this, refModelConfigFields); }
 
 }  // namespace WorldMagGravityModel
 
@@ -4481,7 +1531,8 @@ Vector<const char*, Config::PacketFinders::asciiMaxFieldCount> findIndexOfFieldS
         offset = 0;
     }
 
-    for (size_t i = input.find(',', offset); i < input.length(); i++)
+    const size_t length = input.length();
+    for (size_t i = input.find(',', offset); i < length; i++)
     {
         if (input[i] == ',' || input[i] == '*') { indexes.push_back(&input[i]); }
     }
@@ -41,6 +41,9 @@ Sensor::Sensor(MeasQueueMode mode) : _measQueueMode{mode}, _parseToCD{mode != Me
     _packetSynchronizer.addDispatcher(&_faPacketDispatcher);
     _packetSynchronizer.addDispatcher(&_asciiPacketDispatcher);
     _packetSynchronizer.addDispatcher(&_fbPacketDispatcher);
+    _faPacketDispatcher.setSharedPacketPool(&_sharedPacketPool);
+    _asciiPacketDispatcher.setSharedPacketPool(&_sharedPacketPool);
+    _fbPacketDispatcher.setSharedPacketPool(&_sharedPacketPool);
     if (_parseToCD) { _measurementQueue.setPutMode(static_cast<MeasurementQueue::PutMode>(_measQueueMode)); }
 }
 
@@ -193,6 +196,14 @@ Sensor::CompositeDataQueueReturn Sensor::getMostRecentMeasurement(const bool blo
     return queueReturn;
 }
 
+void Sensor::setMeasurementReduction(const MeasurementReduction mode, const uint16_t factor) noexcept
+{
+#if THREADING_ENABLE
+    LockGuard lock(_sensorMutex);
+#endif
+    _faPacketDispatcher.setMeasurementReduction(mode, factor);
+}
+
 Sensor::CompositeDataQueueReturn Sensor::_blockOnMeasurement(Timer& timer, [[maybe_unused]] const Microseconds sleepLength) noexcept
 {
     bool hasTimedOut = false;
@@ -531,14 +542,14 @@ Error Sensor::subscribeToMessage(PacketQueue_Interface* queueToSubscribe, const
 }
 
 Error Sensor::subscribeToMessage(PacketQueue_Interface* queueToSubscribe, const BinaryOutputMeasurements& binaryOutputMeasurmenetFilter,
-                                 const FaSubscriberFilterType filterType) noexcept
+                                 const FaSubscriberFilterType filterType, const uint16_t decimation) noexcept
 {
 #if THREADING_ENABLE
     LockGuard lock(_sensorMutex);
 #endif
     std::optional<EnabledMeasurements> filterMeas = binaryOutputMeasurmenetFilter.toBinaryHeader().toMeasurementHeader();
     if (!filterMeas.has_value()) { return Error::ParsingFailed; }
-    return _faPacketDispatcher.addSubscriber(queueToSubscribe, filterMeas.value(), filterType);
+    return _faPacketDispatcher.addSubscriber(queueToSubscribe, filterMeas.value(), filterType, decimation);
 }
 
 Error Sensor::subscribeToMessage(PacketQueue_Interface* queueToSubscribe, const AsciiHeader& asciiHeaderFilter,
@@ -657,12 +668,14 @@ Errored Sensor::processNextPacket() noexcept { return _packetSynchronizer.dispat
 
 void Sensor::_listen() noexcept
 {
+    VN_PROFILER_SET_THREAD_NAME("Sensor listener");
     if (_connectionType == ConnectionType::File)
     {
         _mainByteBuffer.reset();
         while (_listening)
         {
             {
+                VN_PROFILER_TIME_SCOPE("Sensor::_listen file pass");
                 LockGuard lock(_sensorMutex);
                 Error lastError = loadMainBufferFromFile();
                 if (lastError != Error::None) { _asyncErrorQueue.put(AsyncError(lastError, now())); }
@@ -678,6 +691,7 @@ void Sensor::_listen() noexcept
         while (_listening)
         {
             {
+                VN_PROFILER_TIME_SCOPE("Sensor::_listen serial pass");
                 LockGuard lock(_sensorMutex);
                 Error lastError = loadMainBufferFromSerial();
                 if (lastError != Error::None) { _asyncErrorQueue.put(AsyncError(lastError, now())); }
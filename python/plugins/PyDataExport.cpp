@@ -46,11 +46,16 @@ void init_data_export(py::module& m)
     py::module Plugins = m.def_submodule("Plugins", "Plugins Module");
     py::module DataExport = Plugins.def_submodule("DataExport", "DataExport Module");
 
+    py::class_<VN::DataExport::ExporterPool>(DataExport, "ExporterPool")
+        .def(py::init<uint8_t>(), py::arg("numThreads") = 1);
+
     py::class_<VN::DataExport::Exporter>(DataExport, "Exporter")
         .def("getQueuePtr", &VN::DataExport::Exporter::getQueuePtr, py::return_value_policy::reference)
-        .def("start", &VN::DataExport::Exporter::start)
+        .def("start", py::overload_cast<>(&VN::DataExport::Exporter::start))
+        .def("start", py::overload_cast<VN::DataExport::ExporterPool&>(&VN::DataExport::Exporter::start), py::arg("pool"), py::keep_alive<1, 2>())
         .def("stop", &VN::DataExport::Exporter::stop)
-        .def("isLogging", &VN::DataExport::Exporter::isLogging);
+        .def("isLogging", &VN::DataExport::Exporter::isLogging)
+        .def("droppedPackets", &VN::DataExport::Exporter::droppedPackets);
 
     py::class_<VN::DataExport::ExporterCsv, VN::DataExport::Exporter>(DataExport, "ExporterCsv")
         .def(py::init<const Filesystem::FilePath&, VN::DataExport::Exporter::PacketQueueMode, bool>(), 
@@ -127,6 +127,7 @@ ext_modules = [
             '../cpp/src/Implementation/BinaryHeader.cpp',
             '../cpp/src/Implementation/CommandProcessor.cpp',
             '../cpp/src/Implementation/FaPacketDispatcher.cpp',
+            '../cpp/src/Implementation/MeasurementReducer.cpp',
             '../cpp/src/Implementation/FaPacketProtocol.cpp',
             '../cpp/src/Implementation/FbPacketDispatcher.cpp',
             '../cpp/src/Implementation/FbPacketProtocol.cpp',